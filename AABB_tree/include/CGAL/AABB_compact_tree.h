@@ -0,0 +1,665 @@
+// Copyright (c) 2026 agent.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : agent
+
+#ifndef CGAL_AABB_COMPACT_TREE_H
+#define CGAL_AABB_COMPACT_TREE_H
+
+#include <CGAL/license/AABB_tree.h>
+
+#include <CGAL/disable_warnings.h>
+
+#include <CGAL/AABB_tree/internal/AABB_compact_node.h>
+#include <CGAL/AABB_tree/internal/Has_nested_type_Shared_data.h>
+#include <CGAL/AABB_tree/internal/Primitive_helper.h>
+#include <CGAL/assertions.h>
+#include <CGAL/number_utils.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <variant>
+#include <vector>
+
+/// \file AABB_compact_tree.h
+
+namespace CGAL {
+
+namespace internal { namespace AABB_tree {
+
+// returns the parameter along the ray of an intersection, used to sort them
+template <typename AABBTraits>
+struct Ray_parameter_visitor
+{
+  typedef typename AABBTraits::FT FT;
+  typedef typename AABBTraits::Point_3 Point;
+  typedef typename AABBTraits::Ray_3 Ray;
+  typedef typename AABBTraits::Geom_traits::Vector_3 Vector;
+
+  Ray_parameter_visitor(const Ray& ray)
+    : m_source(ray.source()), m_v(ray.to_vector()), m_max_i(0)
+  {
+    for(int i=1; i<3; ++i)
+      if(CGAL::abs(m_v[i]) > CGAL::abs(m_v[m_max_i]))
+        m_max_i = i;
+  }
+
+  template<typename T>
+  FT operator()(const T& s) const
+  {
+    // intersection is a segment, returns the min relative distance
+    // of its endpoints
+    return (std::min)(this->operator()(s[0]), this->operator()(s[1]));
+  }
+
+  FT operator()(const Point& p) const
+  {
+    return Vector(m_source, p)[m_max_i] / m_v[m_max_i];
+  }
+
+private:
+  Point m_source;
+  Vector m_v;
+  int m_max_i;
+};
+
+} } // end namespace internal::AABB_tree
+
+/// \addtogroup PkgAABBTreeRef
+/// @{
+
+/**
+ * Cache-compact alternative to `AABB_tree`, offering the most common
+ * intersection and distance queries.
+ *
+ * The hierarchy has the same shape as the one of `AABB_tree`, but it is stored
+ * as a flat array of 32-byte nodes in depth-first order: each node holds its
+ * bounding box with single precision coordinates rounded outward, and the indices
+ * of its two children. Leaves refer to primitives by index, and the primitives are
+ * stored contiguously in the order of the leaves, so that the primitives of a subtree
+ * are next to each other in memory. Using a primitive caching its datum (see
+ * `AABBPrimitive`) thus also stores the geometric data contiguously.
+ *
+ * Rounding is conservative, so the results of the queries are the same
+ * as with `AABB_tree`, only the number of visited nodes can be slightly larger.
+ *
+ * Contrary to `AABB_tree`, the tree is not lazily built: the constructor taking
+ * a range of primitives calls `build()`, and `build()` must be called again after
+ * any call to `insert()` before querying the tree. The number of primitives is
+ * limited to \f$2^{31}\f$.
+ *
+ * \tparam AABBTraits must be a model of `AABBTraits`. `AABBTraits::Bounding_box`
+ * must be `Bbox_3`.
+ *
+ * \sa `AABB_tree`
+ */
+template <typename AABBTraits>
+class AABB_compact_tree
+{
+  typedef internal::AABB_tree::AABB_compact_node Node;
+  typedef typename Node::Index Index;
+  typedef internal::Primitive_helper<AABBTraits> Helper;
+  typedef AABB_compact_tree<AABBTraits> Self;
+
+public:
+  typedef AABBTraits AABB_traits;
+
+  /// \name Types
+  ///@{
+
+  /// Number type returned by the distance queries.
+  typedef typename AABBTraits::FT FT;
+  /// Type of 3D point.
+  typedef typename AABBTraits::Point_3 Point;
+  /// Type of input primitive.
+  typedef typename AABBTraits::Primitive Primitive;
+  /// Identifier for a primitive in the tree.
+  typedef typename Primitive::Id Primitive_id;
+  /// Unsigned integral size type.
+  typedef typename std::vector<Primitive>::size_type size_type;
+  /// Type of bounding box.
+  typedef typename AABBTraits::Bounding_box Bounding_box;
+  /// 3D Point and Primitive Id type
+  typedef typename AABBTraits::Point_and_primitive_id Point_and_primitive_id;
+
+  /*!
+  An alias to `AABBTraits::Intersection_and_primitive_id<Query>`
+  */
+  #ifdef DOXYGEN_RUNNING
+  template<typename Query>
+  using Intersection_and_primitive_id = AABBTraits::Intersection_and_primitive_id<Query>;
+  #else
+  template<typename Query>
+  struct Intersection_and_primitive_id {
+    typedef typename AABBTraits::template Intersection_and_primitive_id<Query>::Type Type;
+  };
+  #endif
+  ///@}
+
+  static_assert(std::is_same<Bounding_box, Bbox_3>::value,
+                "AABB_compact_tree requires Bbox_3 as bounding box type");
+
+  /// \name Creation
+  ///@{
+
+  /// constructs an empty tree, and initializes the internally stored traits
+  /// class using `traits`.
+  AABB_compact_tree(const AABBTraits& traits = AABBTraits())
+    : m_traits(traits)
+  {}
+
+  /// constructs the tree from a sequence of primitives, as `AABB_tree`
+  /// does, and calls `build()`.
+  template<typename InputIterator, typename ... T>
+  AABB_compact_tree(InputIterator first, InputIterator beyond, T&& ... t)
+  {
+    insert(first, beyond, std::forward<T>(t)...);
+    build();
+  }
+
+  AABB_compact_tree(Self&&) = default;
+  Self& operator=(Self&&) = default;
+
+  // Disabled copy constructor & assignment operator
+  AABB_compact_tree(const Self&) = delete;
+  Self& operator=(const Self&) = delete;
+
+  /// (re)constructs the internal tree structure. Must be called
+  /// after `insert()` before querying the tree.
+  void build();
+
+  ///@}
+
+  /// \name Operations
+  ///@{
+
+  /// adds a sequence of primitives to the set of primitives of the tree.
+  /// See `AABB_tree::insert()`.
+  template<typename InputIterator, typename ... T>
+  void insert(InputIterator first, InputIterator beyond, T&& ... t)
+  {
+    set_shared_data(std::forward<T>(t)...);
+    for(; first != beyond; ++first)
+      m_primitives.push_back(Primitive(first, std::forward<T>(t)...));
+    m_need_build = true;
+  }
+
+  /// adds a primitive to the set of primitives of the tree.
+  void insert(const Primitive& p)
+  {
+    m_primitives.push_back(p);
+    m_need_build = true;
+  }
+
+  /// clears the tree.
+  void clear()
+  {
+    m_nodes.clear();
+    m_primitives.clear();
+    m_need_build = false;
+  }
+
+  /// returns a const reference to the internally stored traits class.
+  const AABBTraits& traits() const { return m_traits; }
+
+  /// returns the axis-aligned bounding box of the whole tree.
+  /// \pre `!empty()`
+  Bounding_box bbox() const
+  {
+    CGAL_precondition(!empty() && !m_need_build);
+    if(size() > 1)
+      return m_nodes[0].bbox();
+    return m_traits.compute_bbox_object()(m_primitives.begin(), m_primitives.end());
+  }
+
+  /// returns the number of primitives in the tree.
+  size_type size() const { return m_primitives.size(); }
+
+  /// returns \c true, iff the tree contains no primitive.
+  bool empty() const { return m_primitives.empty(); }
+
+  /// returns the number of bytes used by the nodes and the primitives of the tree.
+  std::size_t memory_usage() const
+  {
+    return m_nodes.capacity() * sizeof(Node) + m_primitives.capacity() * sizeof(Primitive);
+  }
+  ///@}
+
+  /// \name Intersection Tests and Intersections
+  ///@{
+
+  /// returns `true`, iff the query intersects at least one of
+  /// the input primitives.
+  template<typename Query>
+  bool do_intersect(const Query& query) const;
+
+  /// puts in `out` the ids of all intersected primitives.
+  template<typename Query, typename OutputIterator>
+  OutputIterator all_intersected_primitives(const Query& query, OutputIterator out) const;
+
+  /// returns the number of primitives intersected by the query.
+  template<typename Query>
+  size_type number_of_intersected_primitives(const Query& query) const
+  {
+    size_type n = 0;
+    visit_intersected_primitives(query, [&n](const Primitive&){ ++n; return true; });
+    return n;
+  }
+
+  /// returns the intersection and primitive id closest to the source point of the ray
+  /// query. See `AABB_tree::first_intersection()`.
+  template<typename Ray, typename SkipFunctor>
+  std::optional< typename Intersection_and_primitive_id<Ray>::Type >
+  first_intersection(const Ray& query, const SkipFunctor& skip) const;
+
+  /// \cond
+  template<typename Ray>
+  std::optional< typename Intersection_and_primitive_id<Ray>::Type >
+  first_intersection(const Ray& query) const
+  {
+    return first_intersection(query, [](Primitive_id){ return false; });
+  }
+  /// \endcond
+
+  /// returns the primitive id closest to the source point of the ray query.
+  template<typename Ray>
+  std::optional<Primitive_id>
+  first_intersected_primitive(const Ray& query) const
+  {
+    auto res = first_intersection(query);
+    if(res)
+      return res->second;
+    return std::nullopt;
+  }
+  ///@}
+
+  /// \name Distance Queries
+  /// Without a user-provided hint, the hint is the reference point of the primitive
+  /// found by descending the tree towards the query, always going to the closest child.
+  ///@{
+
+  /// returns the point in the union of all input primitives which
+  /// is closest to the query.
+  /// \pre `!empty()`
+  Point closest_point(const Point& query) const
+  {
+    return closest_point_and_primitive(query).first;
+  }
+
+  /// same as above, using `hint` as initial closest point.
+  /// \pre `!empty()`
+  Point closest_point(const Point& query, const Point& hint) const
+  {
+    CGAL_precondition(!empty());
+    return closest_point_and_primitive(query, Point_and_primitive_id(hint, m_primitives[0].id())).first;
+  }
+
+  /// returns the minimum squared distance between the query point
+  /// and all input primitives.
+  /// \pre `!empty()`
+  FT squared_distance(const Point& query) const
+  {
+    return m_traits.squared_distance_object()(query, closest_point(query));
+  }
+
+  /// returns a `Point_and_primitive_id` which realizes the
+  /// smallest distance between the query point and all input primitives.
+  /// \pre `!empty()`
+  Point_and_primitive_id closest_point_and_primitive(const Point& query) const
+  {
+    CGAL_precondition(!empty());
+    return closest_point_and_primitive(query, descent_hint(query));
+  }
+
+  /// same as above, using `hint` as initial closest point.
+  /// \pre `!empty()`
+  Point_and_primitive_id closest_point_and_primitive(const Point& query,
+                                                     const Point_and_primitive_id& hint) const;
+  ///@}
+
+private:
+  template <typename ... T>
+  void set_primitive_data_impl(CGAL::Boolean_tag<false>, T ... ){}
+  template <typename ... T>
+  void set_primitive_data_impl(CGAL::Boolean_tag<true>, T&& ... t)
+  { m_traits.set_shared_data(std::forward<T>(t)...); }
+
+  template <typename ... T>
+  void set_shared_data(T&& ... t)
+  {
+    set_primitive_data_impl(CGAL::Boolean_tag<internal::Has_nested_type_Shared_data<Primitive>::value>(),
+                            std::forward<T>(t)...);
+  }
+
+  // stores in m_nodes[node] the subtree of the `range` primitives starting at `first`,
+  // the same way `AABB_tree::expand()` does
+  void expand(const Index node, const Index first, const Index range);
+
+  // calls `f(primitive)` for all primitives intersected by the query until `f` returns `false`
+  template <typename Query, typename F>
+  void visit_intersected_primitives(const Query& query, const F& f) const;
+
+  Point_and_primitive_id descent_hint(const Point& query) const;
+
+  static void to_double(const Point& p, double d[3])
+  {
+    for(int i=0; i<3; ++i)
+      d[i] = CGAL::to_double(p[i]);
+  }
+
+  // the tree is balanced, the depth is at most 31 given the number of primitives
+  static constexpr int stack_size = 64;
+
+private:
+  AABBTraits m_traits;
+  // primitives, in the order of the leaves
+  std::vector<Primitive> m_primitives;
+  // nodes in depth-first order, the first node is the root node
+  std::vector<Node> m_nodes;
+  bool m_need_build = false;
+};
+
+/// @}
+
+template <typename Tr>
+void AABB_compact_tree<Tr>::expand(const Index node, const Index first, const Index range)
+{
+  auto begin = m_primitives.begin() + first;
+  auto beyond = begin + range;
+  Node& n = m_nodes[node];
+  const Bbox_3 bbox = m_traits.compute_bbox_object()(begin, beyond);
+  n.set_bbox(bbox);
+  m_traits.split_primitives_object()(begin, beyond, bbox);
+
+  switch(range)
+  {
+  case 2:
+    n.set_left_primitive(first);
+    n.set_right_primitive(first+1);
+    break;
+  case 3:
+    n.set_left_primitive(first);
+    n.set_right_child(node+1);
+    expand(node+1, first+1, 2);
+    break;
+  default:
+    const Index new_range = range/2;
+    n.set_left_child(node+1);
+    n.set_right_child(node+new_range);
+    expand(node+1, first, new_range);
+    expand(node+new_range, first+new_range, range-new_range);
+  }
+}
+
+template <typename Tr>
+void AABB_compact_tree<Tr>::build()
+{
+  CGAL_precondition(m_primitives.size() <= std::size_t(Node::max_index));
+
+  m_nodes.clear();
+  if(m_primitives.size() > 1)
+  {
+    m_nodes.resize(m_primitives.size()-1);
+    m_nodes.shrink_to_fit();
+    expand(0, 0, static_cast<Index>(m_primitives.size()));
+  }
+  m_need_build = false;
+}
+
+template <typename Tr>
+template <typename Query, typename F>
+void AABB_compact_tree<Tr>::visit_intersected_primitives(const Query& query, const F& f) const
+{
+  CGAL_precondition(!m_need_build);
+
+  const typename Tr::Do_intersect do_intersect = m_traits.do_intersect_object();
+  switch(size())
+  {
+  case 0:
+    return;
+  case 1:
+    if(do_intersect(query, m_primitives[0]))
+      f(m_primitives[0]);
+    return;
+  default:
+    if(!do_intersect(query, m_nodes[0].bbox()))
+      return;
+  }
+
+  Index stack[stack_size];
+  int top = 0;
+  stack[top++] = 0;
+  while(top != 0)
+  {
+    const Node& n = m_nodes[stack[--top]];
+
+    // push the right child first so that the left child is visited first
+    if(n.is_right_primitive())
+    {
+      const Primitive& pr = m_primitives[n.right()];
+      if(do_intersect(query, pr) && !f(pr))
+        return;
+    }
+    else if(do_intersect(query, m_nodes[n.right()].bbox()))
+      stack[top++] = n.right();
+
+    if(n.is_left_primitive())
+    {
+      const Primitive& pr = m_primitives[n.left()];
+      if(do_intersect(query, pr) && !f(pr))
+        return;
+    }
+    else if(do_intersect(query, m_nodes[n.left()].bbox()))
+      stack[top++] = n.left();
+  }
+}
+
+template <typename Tr>
+template <typename Query>
+bool AABB_compact_tree<Tr>::do_intersect(const Query& query) const
+{
+  bool found = false;
+  visit_intersected_primitives(query, [&found](const Primitive&){ found = true; return false; });
+  return found;
+}
+
+template <typename Tr>
+template <typename Query, typename OutputIterator>
+OutputIterator
+AABB_compact_tree<Tr>::all_intersected_primitives(const Query& query, OutputIterator out) const
+{
+  visit_intersected_primitives(query, [&out](const Primitive& pr){ *out++ = pr.id(); return true; });
+  return out;
+}
+
+template <typename Tr>
+template <typename Ray, typename SkipFunctor>
+std::optional< typename AABB_compact_tree<Tr>::template Intersection_and_primitive_id<Ray>::Type >
+AABB_compact_tree<Tr>::first_intersection(const Ray& query, const SkipFunctor& skip) const
+{
+  static_assert(std::is_same<Ray, typename Tr::Ray_3>::value,
+                "Ray and Ray_3 must be the same type");
+  CGAL_precondition(!m_need_build);
+
+  typedef typename Intersection_and_primitive_id<Ray>::Type Result;
+  std::optional<Result> res;
+
+  const typename Tr::Intersection intersection = m_traits.intersection_object();
+  const typename Tr::Intersection_distance intersection_distance = m_traits.intersection_distance_object();
+  const internal::AABB_tree::Ray_parameter_visitor<Tr> parameter(query);
+
+  // this is not the right way to do it, but using
+  // numeric_limits<FT>::{max,infinity} will not work with Epeck.
+  FT t = (std::numeric_limits<double>::max)();
+
+  auto handle_primitive = [&](const Primitive& pr)
+  {
+    if(skip(pr.id()))
+      return;
+    std::optional<Result> inter = intersection(query, pr);
+    if(inter)
+    {
+      FT ray_distance = std::visit(parameter, inter->first);
+      if(ray_distance < t)
+      {
+        t = ray_distance;
+        res = inter;
+      }
+    }
+  };
+
+  switch(size())
+  {
+  case 0:
+    return res;
+  case 1:
+    handle_primitive(m_primitives[0]);
+    return res;
+  default:
+    break;
+  }
+
+  std::optional<FT> root_dist = intersection_distance(query, m_nodes[0].bbox());
+  if(!root_dist)
+    return res;
+
+  std::pair<Index, FT> stack[stack_size];
+  int top = 0;
+  stack[top++] = std::make_pair(Index(0), *root_dist);
+  while(top != 0)
+  {
+    const std::pair<Index, FT> current = stack[--top];
+    if(!(current.second < t))
+      continue;
+
+    const Node& n = m_nodes[current.first];
+    if(n.is_left_primitive())
+      handle_primitive(m_primitives[n.left()]);
+    if(n.is_right_primitive())
+      handle_primitive(m_primitives[n.right()]);
+
+    std::optional<FT> dl, dr;
+    if(!n.is_left_primitive())
+      dl = intersection_distance(query, m_nodes[n.left()].bbox());
+    if(!n.is_right_primitive())
+      dr = intersection_distance(query, m_nodes[n.right()].bbox());
+
+    // push the farthest child first so that the closest one is visited first
+    if(dl && dr && *dr < *dl)
+    {
+      stack[top++] = std::make_pair(n.left(), *dl);
+      stack[top++] = std::make_pair(n.right(), *dr);
+    }
+    else
+    {
+      if(dr) stack[top++] = std::make_pair(n.right(), *dr);
+      if(dl) stack[top++] = std::make_pair(n.left(), *dl);
+    }
+  }
+
+  return res;
+}
+
+template <typename Tr>
+typename AABB_compact_tree<Tr>::Point_and_primitive_id
+AABB_compact_tree<Tr>::descent_hint(const Point& query) const
+{
+  CGAL_precondition(!m_need_build);
+  if(size() == 1)
+    return Point_and_primitive_id(Helper::get_reference_point(m_primitives[0], m_traits),
+                                  m_primitives[0].id());
+
+  double q[3];
+  to_double(query, q);
+
+  Index current = 0;
+  for(;;)
+  {
+    const Node& n = m_nodes[current];
+    // a primitive child is considered at distance 0
+    const double dl = n.is_left_primitive() ? 0. : m_nodes[n.left()].squared_distance(q);
+    const double dr = n.is_right_primitive() ? 0. : m_nodes[n.right()].squared_distance(q);
+    const bool go_left = (dl <= dr);
+    const bool is_primitive = go_left ? n.is_left_primitive() : n.is_right_primitive();
+    const Index next = go_left ? n.left() : n.right();
+    if(is_primitive)
+      return Point_and_primitive_id(Helper::get_reference_point(m_primitives[next], m_traits),
+                                    m_primitives[next].id());
+    current = next;
+  }
+}
+
+template <typename Tr>
+typename AABB_compact_tree<Tr>::Point_and_primitive_id
+AABB_compact_tree<Tr>::closest_point_and_primitive(const Point& query,
+                                                   const Point_and_primitive_id& hint) const
+{
+  CGAL_precondition(!empty() && !m_need_build);
+
+  const typename Tr::Closest_point closest_point = m_traits.closest_point_object();
+  const typename Tr::Compare_distance compare_distance = m_traits.compare_distance_object();
+  const typename Tr::Equal_3 equal = m_traits.equal_3_object();
+
+  Point_and_primitive_id res = hint;
+  auto handle_primitive = [&](const Primitive& pr)
+  {
+    Point new_closest_point = closest_point(query, pr, res.first);
+    if(!equal(new_closest_point, res.first))
+      res = Point_and_primitive_id(new_closest_point, pr.id());
+  };
+
+  if(size() == 1)
+  {
+    handle_primitive(m_primitives[0]);
+    return res;
+  }
+
+  double q[3];
+  to_double(query, q);
+
+  Index stack[stack_size];
+  int top = 0;
+  stack[top++] = 0;
+  while(top != 0)
+  {
+    const Node& n = m_nodes[stack[--top]];
+    if(compare_distance(query, n.bbox(), res.first) != CGAL::SMALLER)
+      continue;
+
+    if(n.is_left_primitive())
+      handle_primitive(m_primitives[n.left()]);
+    if(n.is_right_primitive())
+      handle_primitive(m_primitives[n.right()]);
+
+    // push the farthest child first so that the closest one is visited first
+    if(!n.is_left_primitive() && !n.is_right_primitive() &&
+       m_nodes[n.right()].squared_distance(q) < m_nodes[n.left()].squared_distance(q))
+    {
+      stack[top++] = n.left();
+      stack[top++] = n.right();
+    }
+    else
+    {
+      if(!n.is_right_primitive()) stack[top++] = n.right();
+      if(!n.is_left_primitive()) stack[top++] = n.left();
+    }
+  }
+
+  return res;
+}
+
+} // end namespace CGAL
+
+#include <CGAL/enable_warnings.h>
+
+#endif // CGAL_AABB_COMPACT_TREE_H
@@ -27,6 +27,8 @@
 #include <CGAL/Kernel_23/internal/Has_boolean_tags.h>
 
 
+#include <algorithm>
+#include <limits>
 #include <optional>
 
 /// \file AABB_traits.h
@@ -290,6 +292,103 @@ public:
 
   Split_primitives split_primitives_object() const {return Split_primitives(*this);}
 
+  /**
+   * @internal
+   * @brief Sorts [first,beyond[ using the surface area heuristic
+   * @param first iterator on first element
+   * @param beyond iterator on beyond element
+   * @param bbox the bounding box of [first,beyond[
+   *
+   * Alternative to `Split_primitives` that can be passed to `AABB_tree::custom_build()`.
+   * As the tree stores as many primitives in the first half as in the second half
+   * of the range of a node, the split position remains the median. However, instead
+   * of always using the longest axis of `bbox`, the three axes are tried and the one
+   * minimizing the surface area heuristic (sum over the two halves of the area of the
+   * bounding box times the number of primitives) is kept. This is about four times
+   * more expensive than `Split_primitives` but produces tighter trees, which pays off
+   * for ray-heavy workloads.
+   */
+  class Split_primitives_SAH
+  {
+    typedef AABB_traits<GeomTraits,AABBPrimitive,BboxMap> Traits;
+    const Traits& m_traits;
+
+    static double half_area(const Bounding_box& bbox)
+    {
+      const double dx = bbox.xmax() - bbox.xmin();
+      const double dy = bbox.ymax() - bbox.ymin();
+      const double dz = bbox.zmax() - bbox.zmin();
+      return dx*dy + dy*dz + dz*dx;
+    }
+
+    template<typename PrimitiveIterator>
+    void split_along_axis(PrimitiveIterator first,
+                          PrimitiveIterator middle,
+                          PrimitiveIterator beyond,
+                          const int axis) const
+    {
+      switch(axis)
+      {
+      case AT::CGAL_AXIS_X:
+        std::nth_element(first, middle, beyond, [this](const Primitive& p1, const Primitive& p2){ return Traits::less_x(p1, p2, this->m_traits); });
+        break;
+      case AT::CGAL_AXIS_Y:
+        std::nth_element(first, middle, beyond, [this](const Primitive& p1, const Primitive& p2){ return Traits::less_y(p1, p2, this->m_traits); });
+        break;
+      case AT::CGAL_AXIS_Z:
+        std::nth_element(first, middle, beyond, [this](const Primitive& p1, const Primitive& p2){ return Traits::less_z(p1, p2, this->m_traits); });
+        break;
+      default:
+        CGAL_error();
+      }
+    }
+
+  public:
+    Split_primitives_SAH(const AABB_traits<GeomTraits,AABBPrimitive,BboxMap>& traits)
+      : m_traits(traits) {}
+
+    typedef void result_type;
+    template<typename PrimitiveIterator>
+    void operator()(PrimitiveIterator first,
+                    PrimitiveIterator beyond,
+                    const typename AT::Bounding_box& bbox) const
+      {
+        const std::ptrdiff_t n = beyond - first;
+        PrimitiveIterator middle = first + n/2;
+
+        // with less than 4 primitives, one of the children is a primitive
+        // and the choice of the axis hardly matters
+        if(n < 4)
+        {
+          split_along_axis(first, middle, beyond, Traits::longest_axis(bbox));
+          return;
+        }
+
+        const typename AT::Compute_bbox compute_bbox = m_traits.compute_bbox_object();
+        const double n_left = double(n/2), n_right = double(n - n/2);
+
+        int best_axis = -1, last_axis = -1;
+        double best_cost = (std::numeric_limits<double>::max)();
+        for(int axis=0; axis<3; ++axis)
+        {
+          split_along_axis(first, middle, beyond, axis);
+          last_axis = axis;
+          const double cost = n_left * half_area(compute_bbox(first, middle)) +
+                              n_right * half_area(compute_bbox(middle, beyond));
+          if(cost < best_cost)
+          {
+            best_cost = cost;
+            best_axis = axis;
+          }
+        }
+
+        if(best_axis != last_axis)
+          split_along_axis(first, middle, beyond, best_axis);
+      }
+  };
+
+  Split_primitives_SAH split_primitives_SAH_object() const {return Split_primitives_SAH(*this);}
+
 
   /*
    * Computes the bounding box of a set of primitives
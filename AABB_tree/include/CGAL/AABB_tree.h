@@ -26,12 +26,17 @@
 #include <CGAL/AABB_tree/internal/AABB_search_tree.h>
 #include <CGAL/AABB_tree/internal/Has_nested_type_Shared_data.h>
 #include <CGAL/AABB_tree/internal/Primitive_helper.h>
+#include <CGAL/tags.h>
 #include <optional>
 
 #ifdef CGAL_HAS_THREADS
 #include <CGAL/mutex.h>
 #endif
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_invoke.h>
+#endif
+
 /// \file AABB_tree.h
 
 namespace CGAL {
@@ -148,19 +153,57 @@ namespace CGAL {
     void build(T&& ...);
 #ifndef DOXYGEN_RUNNING
     void build();
+#endif
+
+    /// triggers the (re)construction of the internal tree structure similarly to a call to `build()`.
+    /// If `Parallel_tag` is used, the two subtrees of any node having enough primitives
+    /// are constructed in parallel using \ref thirdpartyTBB. The resulting tree is identical
+    /// to the one obtained with `Sequential_tag`.
+    /// Note that `AABBTraits::Compute_bbox` and `AABBTraits::Split_primitives` must then
+    /// be safe to call concurrently on disjoint ranges of primitives, which is the case
+    /// for the traits classes provided by \cgal.
+    void build(Sequential_tag);
+    /// \copydoc build(Sequential_tag)
+    void build(Parallel_tag);
 
+#ifndef DOXYGEN_RUNNING
     /// triggers the (re)construction of the tree similarly to a call to `build()`
     /// but the traits functors `Compute_bbox` and `Split_primitives` are ignored
     /// and `compute_bbox` and `split_primitives` are used instead.
+    /// For example, `AABB_traits::Split_primitives_SAH` can be used as `split_primitives`.
     template <class ComputeBbox, class SplitPrimitives>
     void custom_build(const ComputeBbox& compute_bbox,
                       const SplitPrimitives& split_primitives);
+
+    /// same as above, using the concurrency policy `ConcurrencyTag`.
+    template <class ComputeBbox, class SplitPrimitives, class ConcurrencyTag>
+    void custom_build(const ComputeBbox& compute_bbox,
+                      const SplitPrimitives& split_primitives,
+                      const ConcurrencyTag& tag);
 #endif
     ///@}
 
     /// \name Operations
     ///@{
 
+    /// updates the internal tree structure after the geometry of the primitives
+    /// has changed (for example after moving the vertices of the mesh the primitives
+    /// are built upon), without changing its topology: the bounding boxes of the nodes
+    /// are recomputed bottom-up. This is much faster than `build()`, but the quality of the
+    /// tree degrades if the primitives move a lot.
+    /// If the internal KD-tree used to accelerate the distance queries was built
+    /// by the tree, it is cleared and will be rebuilt by the next distance query.
+    /// A KD-tree built from user-provided points is not updated.
+    /// This function has a complexity of \cgalBigO{n}, where \f$n\f$ is the number of primitives.
+    /// \note Primitives caching their datum must not be used, as their datum is not updated.
+    void refit();
+
+    /// same as `refit()`, but the subtrees whose quality dropped are rebuilt:
+    /// a subtree is rebuilt if the area of the intersection of the bounding boxes of
+    /// its two children is larger than `max_overlap` times the area of its bounding box.
+    /// \pre `0 <= max_overlap <= 1`
+    void refit(double max_overlap);
+
     /// is equivalent to calling `clear()`, `insert(first,last,t...)`, and `build()`
     template<typename ConstPrimitiveIterator,typename ... T>
     void rebuild(ConstPrimitiveIterator first, ConstPrimitiveIterator beyond,T&& ...);
@@ -378,6 +421,48 @@ public:
     Point_and_primitive_id closest_point_and_primitive(const Point& query) const;
 
 
+    ///@}
+
+    /// \name Batched Queries
+    ///
+    /// The following functions answer a range of queries at once, which is
+    /// much faster than calling the corresponding query function once per query.
+    /// The queries are first sorted along a Hilbert curve (using the source of the rays
+    /// for ray queries), such that consecutive queries visit the same part of the tree.
+    /// For distance queries, the result of a query is used as hint for the next one,
+    /// the hint being obtained from the internal KD-tree only at the beginning of a batch.
+    /// If `ConcurrencyTag` is `Parallel_tag`, batches of consecutive queries are
+    /// processed in parallel using \ref thirdpartyTBB.
+    /// In any case, the results are put in `out` in the order of the input queries.
+    ///
+    /// `AABBTraits` must have a nested type `Geom_traits` that is a model of `SpatialSortingTraits_3`.
+    ///@{
+
+    /// puts in `out` the closest points of the queries, as `closest_point()` would.
+    /// \tparam PointRange a model of `ConstRange` with value type `Point`.
+    /// \pre `!empty()`
+    template <typename PointRange, typename OutputIterator, typename ConcurrencyTag = Sequential_tag>
+    OutputIterator closest_points(const PointRange& queries,
+                                  OutputIterator out,
+                                  const ConcurrencyTag& tag = ConcurrencyTag()) const;
+
+    /// puts in `out` the `Point_and_primitive_id` of the queries,
+    /// as `closest_point_and_primitive()` would.
+    /// \tparam PointRange a model of `ConstRange` with value type `Point`.
+    /// \pre `!empty()`
+    template <typename PointRange, typename OutputIterator, typename ConcurrencyTag = Sequential_tag>
+    OutputIterator closest_points_and_primitives(const PointRange& queries,
+                                                 OutputIterator out,
+                                                 const ConcurrencyTag& tag = ConcurrencyTag()) const;
+
+    /// puts in `out` the results of `first_intersection()` for each ray of `queries`,
+    /// as objects of type `std::optional<Intersection_and_primitive_id<Ray>::%Type>`.
+    /// \tparam RayRange a model of `ConstRange` with value type `AABBTraits::Ray_3`.
+    template <typename RayRange, typename OutputIterator, typename ConcurrencyTag = Sequential_tag>
+    OutputIterator first_intersections(const RayRange& queries,
+                                       OutputIterator out,
+                                       const ConcurrencyTag& tag = ConcurrencyTag()) const;
+
     ///@}
 
     /// \name Accelerating the Distance Queries
@@ -483,6 +568,16 @@ public:
     template<typename AABBTree, typename SkipFunctor>
     friend class AABB_ray_intersection;
 
+    // Number of consecutive queries processed by a thread in batched queries
+    static constexpr std::size_t batched_queries_grain_size = 512;
+
+    // Sorts `sites` along a Hilbert curve, and calls `process(order, b, e)` on consecutive
+    // ranges of the resulting order, possibly in parallel.
+    template <typename ConcurrencyTag, typename ProcessRange>
+    void coherent_batch_traversal(const std::vector<Point>& sites,
+                                  const ProcessRange& process,
+                                  const ConcurrencyTag& tag) const;
+
     // clear nodes
     void clear_nodes()
     {
@@ -559,6 +654,9 @@ public:
   private:
     typedef AABB_node<AABBTraits> Node;
 
+    // Below this number of primitives, subtrees are always built sequentially
+    static constexpr std::size_t parallel_build_threshold = 4096;
+
     /**
      * @brief Builds the tree by recursive expansion.
      * @param node the root node of the subtree to generate
@@ -569,14 +667,61 @@ public:
      * @param split_primitives a functor
      *
      * [first,beyond[ is the range of primitives to be added to the tree.
+     * The `range-1` nodes of the subtree are stored in depth-first order
+     * starting at `node`, so that two subtrees never write to the same
+     * part of `m_nodes`. This is what allows building them concurrently.
      */
-    template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+    template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives, typename ConcurrencyTag>
     void expand(Node& node,
                 ConstPrimitiveIterator first,
                 ConstPrimitiveIterator beyond,
                 const std::size_t range,
                 const ComputeBbox& compute_bbox,
-                const SplitPrimitives& split_primitives);
+                const SplitPrimitives& split_primitives,
+                const ConcurrencyTag& tag);
+
+    template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+    bool try_parallel_expand(Node&, ConstPrimitiveIterator, ConstPrimitiveIterator,
+                             const std::size_t, const ComputeBbox&, const SplitPrimitives&,
+                             const Sequential_tag&)
+    {
+      return false;
+    }
+
+#ifdef CGAL_LINKED_WITH_TBB
+    template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+    bool try_parallel_expand(Node& node,
+                             ConstPrimitiveIterator first,
+                             ConstPrimitiveIterator beyond,
+                             const std::size_t range,
+                             const ComputeBbox& compute_bbox,
+                             const SplitPrimitives& split_primitives,
+                             const Parallel_tag& tag)
+    {
+      if(range < parallel_build_threshold)
+        return false;
+
+      const std::size_t new_range = range/2;
+      Node* p_node = std::addressof(node);
+      tbb::parallel_invoke(
+        [&]{ expand(*(p_node+1), first, first + new_range, new_range, compute_bbox, split_primitives, tag); },
+        [&]{ expand(*(p_node+new_range), first + new_range, beyond, range - new_range, compute_bbox, split_primitives, tag); });
+      return true;
+    }
+#endif
+
+    // recomputes the bounding box of `node` and its descendants
+    template<typename ConstPrimitiveIterator>
+    void refit_node(Node& node,
+                    ConstPrimitiveIterator first,
+                    const std::size_t range);
+
+    // rebuilds the subtrees whose children overlap too much
+    template<typename ConstPrimitiveIterator>
+    void rebuild_degraded_subtrees(Node& node,
+                                   ConstPrimitiveIterator first,
+                                   const std::size_t range,
+                                   const double max_overlap);
 
   public:
     // returns a point which must be on one primitive
@@ -652,11 +797,6 @@ public:
       return std::addressof(m_nodes[0]);
     }
 
-    Node& new_node()
-    {
-      m_nodes.emplace_back();
-      return m_nodes.back();
-    }
   private:
     const Primitive& singleton_data() const {
       CGAL_assertion(size() == 1);
@@ -785,37 +925,150 @@ public:
   }
 
   template<typename Tr>
-  template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+  template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives, typename ConcurrencyTag>
   void
   AABB_tree<Tr>::expand(Node& node,
                         ConstPrimitiveIterator first,
                         ConstPrimitiveIterator beyond,
                         const std::size_t range,
                         const ComputeBbox& compute_bbox,
-                        const SplitPrimitives& split_primitives)
+                        const SplitPrimitives& split_primitives,
+                        const ConcurrencyTag& tag)
   {
     node.set_bbox(compute_bbox(first, beyond));
 
     // sort primitives along longest axis aabb
     split_primitives(first, beyond, node.bbox());
 
+    // the left subtree (range/2 primitives) uses the range/2-1 nodes following `node`,
+    // the right subtree comes right after
+    Node* p_node = std::addressof(node);
     switch(range)
     {
     case 2:
       node.set_children(*first, *(first+1));
       break;
     case 3:
-      node.set_children(*first, new_node());
-      expand(node.right_child(), first+1, beyond, 2, compute_bbox, split_primitives);
+      node.set_children(*first, *(p_node+1));
+      expand(node.right_child(), first+1, beyond, 2, compute_bbox, split_primitives, tag);
+      break;
+    default:
+      const std::size_t new_range = range/2;
+      node.set_children(*(p_node+1), *(p_node+new_range));
+      if(!try_parallel_expand(node, first, beyond, range, compute_bbox, split_primitives, tag))
+      {
+        expand(node.left_child(), first, first + new_range, new_range, compute_bbox, split_primitives, tag);
+        expand(node.right_child(), first + new_range, beyond, range - new_range, compute_bbox, split_primitives, tag);
+      }
+    }
+  }
+
+
+  template<typename Tr>
+  template<typename ConstPrimitiveIterator>
+  void
+  AABB_tree<Tr>::refit_node(Node& node,
+                            ConstPrimitiveIterator first,
+                            const std::size_t range)
+  {
+    const typename Tr::Compute_bbox compute_bbox = m_traits.compute_bbox_object();
+    Node* p_node = std::addressof(node);
+    switch(range)
+    {
+    case 2:
+      node.set_bbox(compute_bbox(first, first+2));
+      break;
+    case 3:
+      refit_node(*(p_node+1), first+1, 2);
+      node.set_bbox(compute_bbox(first, first+1) + (p_node+1)->bbox());
       break;
     default:
       const std::size_t new_range = range/2;
-      node.set_children(new_node(), new_node());
-      expand(node.left_child(), first, first + new_range, new_range, compute_bbox, split_primitives);
-      expand(node.right_child(), first + new_range, beyond, range - new_range, compute_bbox, split_primitives);
+      refit_node(node.left_child(), first, new_range);
+      refit_node(node.right_child(), first + new_range, range - new_range);
+      node.set_bbox(node.left_child().bbox() + node.right_child().bbox());
     }
   }
 
+  template<typename Tr>
+  template<typename ConstPrimitiveIterator>
+  void
+  AABB_tree<Tr>::rebuild_degraded_subtrees(Node& node,
+                                           ConstPrimitiveIterator first,
+                                           const std::size_t range,
+                                           const double max_overlap)
+  {
+    // children of smaller nodes are (mostly) primitives, there is nothing to gain
+    if(range < 4)
+      return;
+
+    auto area = [](const Bounding_box& bb)
+    {
+      const double dx = bb.xmax() - bb.xmin();
+      const double dy = bb.ymax() - bb.ymin();
+      const double dz = bb.zmax() - bb.zmin();
+      return dx*dy + dy*dz + dz*dx;
+    };
+
+    const Bounding_box& lbb = node.left_child().bbox();
+    const Bounding_box& rbb = node.right_child().bbox();
+    double overlap = 0;
+    if(do_overlap(lbb, rbb))
+    {
+      overlap = area(Bounding_box((std::max)(lbb.xmin(), rbb.xmin()),
+                                  (std::max)(lbb.ymin(), rbb.ymin()),
+                                  (std::max)(lbb.zmin(), rbb.zmin()),
+                                  (std::min)(lbb.xmax(), rbb.xmax()),
+                                  (std::min)(lbb.ymax(), rbb.ymax()),
+                                  (std::min)(lbb.zmax(), rbb.zmax())));
+    }
+
+    if(overlap > max_overlap * area(node.bbox()))
+    {
+      // the nodes and primitives of a subtree are contiguous and
+      // can be rebuilt in place
+      expand(node, first, first + range, range,
+             m_traits.compute_bbox_object(), m_traits.split_primitives_object(),
+             Sequential_tag());
+      return;
+    }
+
+    const std::size_t new_range = range/2;
+    rebuild_degraded_subtrees(node.left_child(), first, new_range, max_overlap);
+    rebuild_degraded_subtrees(node.right_child(), first + new_range, range - new_range, max_overlap);
+  }
+
+  template<typename Tr>
+  void AABB_tree<Tr>::refit()
+  {
+    refit(1.);
+  }
+
+  template<typename Tr>
+  void AABB_tree<Tr>::refit(double max_overlap)
+  {
+    CGAL_precondition(max_overlap >= 0 && max_overlap <= 1);
+
+    if(m_use_default_search_tree)
+      clear_search_tree();
+
+#ifdef CGAL_HAS_THREADS
+    bool m_need_build = m_atomic_need_build.load(std::memory_order_relaxed);
+#endif
+    // primitives were inserted since the last build: there is nothing to refit
+    if(m_need_build)
+    {
+      build();
+      return;
+    }
+
+    if(m_primitives.size() < 2)
+      return;
+
+    refit_node(m_nodes[0], m_primitives.begin(), m_primitives.size());
+    if(max_overlap < 1)
+      rebuild_degraded_subtrees(m_nodes[0], m_primitives.begin(), m_primitives.size(), max_overlap);
+  }
 
   // Build the data structure, after calls to insert(..)
   template<typename Tr>
@@ -824,27 +1077,57 @@ public:
     custom_build(m_traits.compute_bbox_object(),
                  m_traits.split_primitives_object());
   }
+
+  template<typename Tr>
+  void AABB_tree<Tr>::build(Sequential_tag)
+  {
+    build();
+  }
+
+  template<typename Tr>
+  void AABB_tree<Tr>::build(Parallel_tag)
+  {
+    custom_build(m_traits.compute_bbox_object(),
+                 m_traits.split_primitives_object(),
+                 Parallel_tag());
+  }
 #ifndef DOXYGEN_RUNNING
-  // Build the data structure, after calls to insert(..)
   template<typename Tr>
   template <class ComputeBbox, class SplitPrimitives>
   void AABB_tree<Tr>::custom_build(
     const ComputeBbox& compute_bbox,
     const SplitPrimitives& split_primitives)
   {
+    custom_build(compute_bbox, split_primitives, Sequential_tag());
+  }
+
+  // Build the data structure, after calls to insert(..)
+  template<typename Tr>
+  template <class ComputeBbox, class SplitPrimitives, class ConcurrencyTag>
+  void AABB_tree<Tr>::custom_build(
+    const ComputeBbox& compute_bbox,
+    const SplitPrimitives& split_primitives,
+    const ConcurrencyTag& tag)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
     clear_nodes();
 
     if(m_primitives.size() > 1) {
 
       // allocates tree nodes
-      m_nodes.reserve(m_primitives.size()-1);
+      m_nodes.resize(m_primitives.size()-1);
 
       // constructs the tree
-      expand(new_node(),
+      expand(m_nodes[0],
              m_primitives.begin(), m_primitives.end(),
              m_primitives.size(),
              compute_bbox,
-             split_primitives);
+             split_primitives,
+             tag);
     }
 #ifdef CGAL_HAS_THREADS
     m_atomic_need_build.store(false, std::memory_order_release); // in case build() is triggered by a call to root_node()
@@ -1058,6 +1341,7 @@ public:
 } // end namespace CGAL
 
 #include <CGAL/AABB_tree/internal/AABB_ray_intersection.h>
+#include <CGAL/AABB_tree/internal/AABB_batched_queries.h>
 
 #include <CGAL/enable_warnings.h>
 
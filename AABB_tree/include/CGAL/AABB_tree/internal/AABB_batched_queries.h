@@ -0,0 +1,152 @@
+// Copyright (c) 2026 agent.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : agent
+//
+
+#ifndef CGAL_AABB_BATCHED_QUERIES_H
+#define CGAL_AABB_BATCHED_QUERIES_H
+
+#include <CGAL/license/AABB_tree.h>
+
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/property_map.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+#include <CGAL/tags.h>
+
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#  include <tbb/blocked_range.h>
+#  include <tbb/parallel_for.h>
+#endif
+
+namespace CGAL {
+
+template <typename Tr>
+template <typename ConcurrencyTag, typename ProcessRange>
+void
+AABB_tree<Tr>::coherent_batch_traversal(const std::vector<Point>& sites,
+                                        const ProcessRange& process,
+                                        const ConcurrencyTag&) const
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  std::vector<std::size_t> order(sites.size());
+  std::iota(order.begin(), order.end(), std::size_t(0));
+
+  typedef typename Pointer_property_map<Point>::const_type Pmap;
+  typedef Spatial_sort_traits_adapter_3<typename Tr::Geom_traits, Pmap> Sort_traits;
+  hilbert_sort<ConcurrencyTag>(order.begin(), order.end(),
+                               Sort_traits(make_property_map(sites)));
+
+#ifdef CGAL_LINKED_WITH_TBB
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    // trigger the lazy construction of the tree before the threads compete for it
+    if(size() > 1)
+      root_node();
+
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, order.size(), batched_queries_grain_size),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        process(order, r.begin(), r.end());
+                      });
+    return;
+  }
+#endif
+
+  process(order, std::size_t(0), order.size());
+}
+
+template <typename Tr>
+template <typename PointRange, typename OutputIterator, typename ConcurrencyTag>
+OutputIterator
+AABB_tree<Tr>::closest_points_and_primitives(const PointRange& queries,
+                                             OutputIterator out,
+                                             const ConcurrencyTag& tag) const
+{
+  CGAL_precondition(!empty());
+
+  const std::vector<Point> sites(std::begin(queries), std::end(queries));
+  std::vector<std::optional<Point_and_primitive_id> > results(sites.size());
+
+  auto process = [&](const std::vector<std::size_t>& order, std::size_t b, std::size_t e)
+  {
+    for(std::size_t k=b; k<e; ++k)
+    {
+      const std::size_t i = order[k];
+      // the closest point of the previous (nearby) query is a good hint
+      const Point_and_primitive_id hint = (k == b) ? best_hint(sites[i])
+                                                   : *results[order[k-1]];
+      results[i] = closest_point_and_primitive(sites[i], hint);
+    }
+  };
+  coherent_batch_traversal(sites, process, tag);
+
+  for(const std::optional<Point_and_primitive_id>& r : results)
+    *out++ = *r;
+  return out;
+}
+
+template <typename Tr>
+template <typename PointRange, typename OutputIterator, typename ConcurrencyTag>
+OutputIterator
+AABB_tree<Tr>::closest_points(const PointRange& queries,
+                              OutputIterator out,
+                              const ConcurrencyTag& tag) const
+{
+  std::vector<Point_and_primitive_id> results;
+  results.reserve(std::distance(std::begin(queries), std::end(queries)));
+  closest_points_and_primitives(queries, std::back_inserter(results), tag);
+
+  for(const Point_and_primitive_id& r : results)
+    *out++ = r.first;
+  return out;
+}
+
+template <typename Tr>
+template <typename RayRange, typename OutputIterator, typename ConcurrencyTag>
+OutputIterator
+AABB_tree<Tr>::first_intersections(const RayRange& queries,
+                                   OutputIterator out,
+                                   const ConcurrencyTag& tag) const
+{
+  typedef typename Tr::Ray_3 Ray;
+  typedef std::optional<typename Intersection_and_primitive_id<Ray>::Type> Result;
+
+  const std::vector<Ray> rays(std::begin(queries), std::end(queries));
+  std::vector<Point> sources;
+  sources.reserve(rays.size());
+  for(const Ray& r : rays)
+    sources.push_back(r.source());
+
+  std::vector<Result> results(rays.size());
+  auto process = [&](const std::vector<std::size_t>& order, std::size_t b, std::size_t e)
+  {
+    for(std::size_t k=b; k<e; ++k)
+      results[order[k]] = first_intersection(rays[order[k]]);
+  };
+  coherent_batch_traversal(sources, process, tag);
+
+  for(const Result& r : results)
+    *out++ = r;
+  return out;
+}
+
+} // end namespace CGAL
+
+#endif // CGAL_AABB_BATCHED_QUERIES_H
@@ -0,0 +1,131 @@
+// Copyright (c) 2026 agent.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : agent
+
+#ifndef CGAL_AABB_COMPACT_NODE_H
+#define CGAL_AABB_COMPACT_NODE_H
+
+#include <CGAL/license/AABB_tree.h>
+
+#include <CGAL/Bbox_3.h>
+#include <CGAL/assertions.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace CGAL {
+namespace internal {
+namespace AABB_tree {
+
+/**
+ * @class AABB_compact_node
+ *
+ * Node of `AABB_compact_tree`, fitting in 32 bytes: the bounding box is stored
+ * with single precision coordinates rounded outward, and the two children are
+ * indices, either in the node array or in the primitive array.
+ */
+class AABB_compact_node
+{
+public:
+  typedef std::uint32_t Index;
+
+  // high bit of a child index set <=> the child is a primitive
+  static constexpr Index primitive_flag = Index(1) << 31;
+  static constexpr Index max_index = primitive_flag - 1;
+
+  AABB_compact_node()
+    : m_left(0), m_right(0)
+  {
+    for(int i=0; i<6; ++i)
+      m_bbox[i] = 0.f;
+  }
+
+  /// Returns a box containing the bounding box given to `set_bbox()`
+  Bbox_3 bbox() const
+  {
+    return Bbox_3(m_bbox[0], m_bbox[1], m_bbox[2],
+                  m_bbox[3], m_bbox[4], m_bbox[5]);
+  }
+
+  void set_bbox(const Bbox_3& bbox)
+  {
+    for(int i=0; i<3; ++i)
+    {
+      m_bbox[i] = round_down(bbox.min(i));
+      m_bbox[i+3] = round_up(bbox.max(i));
+    }
+  }
+
+  /// Returns the squared distance between `p` and the box, in double precision.
+  /// Only meant to order the visit of the children.
+  double squared_distance(const double p[3]) const
+  {
+    double sd = 0;
+    for(int i=0; i<3; ++i)
+    {
+      double d = 0;
+      if(p[i] < m_bbox[i])
+        d = m_bbox[i] - p[i];
+      else if(p[i] > m_bbox[i+3])
+        d = p[i] - m_bbox[i+3];
+      sd += d*d;
+    }
+    return sd;
+  }
+
+  void set_left_child(Index i)     { CGAL_assertion(i <= max_index); m_left = i; }
+  void set_right_child(Index i)    { CGAL_assertion(i <= max_index); m_right = i; }
+  void set_left_primitive(Index i) { CGAL_assertion(i <= max_index); m_left = i | primitive_flag; }
+  void set_right_primitive(Index i){ CGAL_assertion(i <= max_index); m_right = i | primitive_flag; }
+
+  bool is_left_primitive() const  { return (m_left & primitive_flag) != 0; }
+  bool is_right_primitive() const { return (m_right & primitive_flag) != 0; }
+
+  /// index in the node array or in the primitive array, depending on `is_left_primitive()`
+  Index left() const  { return m_left & max_index; }
+  /// index in the node array or in the primitive array, depending on `is_right_primitive()`
+  Index right() const { return m_right & max_index; }
+
+private:
+  static float round_down(double d)
+  {
+    constexpr double fmax = (std::numeric_limits<float>::max)();
+    if(d > fmax) return float(fmax);
+    if(d < -fmax) return -std::numeric_limits<float>::infinity();
+    float f = static_cast<float>(d);
+    if(static_cast<double>(f) > d)
+      f = std::nextafter(f, -std::numeric_limits<float>::infinity());
+    return f;
+  }
+
+  static float round_up(double d)
+  {
+    constexpr double fmax = (std::numeric_limits<float>::max)();
+    if(d > fmax) return std::numeric_limits<float>::infinity();
+    if(d < -fmax) return -float(fmax);
+    float f = static_cast<float>(d);
+    if(static_cast<double>(f) < d)
+      f = std::nextafter(f, std::numeric_limits<float>::infinity());
+    return f;
+  }
+
+  // xmin, ymin, zmin, xmax, ymax, zmax
+  float m_bbox[6];
+  Index m_left;
+  Index m_right;
+};
+
+static_assert(sizeof(AABB_compact_node) == 32, "AABB_compact_node must fit in 32 bytes");
+
+} } } // end namespace CGAL::internal::AABB_tree
+
+#endif // CGAL_AABB_COMPACT_NODE_H
@@ -0,0 +1,92 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Random.h>
+
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Epick K;
+typedef K::FT FT;
+typedef K::Point_3 Point;
+typedef K::Ray_3 Ray;
+
+typedef CGAL::Surface_mesh<Point> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+typedef std::optional<Tree::Intersection_and_primitive_id<Ray>::Type> Ray_intersection;
+
+Point random_point(CGAL::Random& rnd, const CGAL::Bbox_3& bb)
+{
+  return Point(rnd.get_double(bb.xmin(), bb.xmax()),
+               rnd.get_double(bb.ymin(), bb.ymax()),
+               rnd.get_double(bb.zmin(), bb.zmax()));
+}
+
+template <typename ConcurrencyTag>
+void test(const Tree& tree, const std::vector<Point>& points, const std::vector<Ray>& rays)
+{
+  std::vector<Tree::Point_and_primitive_id> closest;
+  tree.closest_points_and_primitives(points, std::back_inserter(closest), ConcurrencyTag());
+  assert(closest.size() == points.size());
+
+  std::vector<Point> closest_points;
+  tree.closest_points(points, std::back_inserter(closest_points), ConcurrencyTag());
+  assert(closest_points.size() == points.size());
+
+  for(std::size_t i=0; i<points.size(); ++i)
+  {
+    // the hints differ from the ones used by the sequential queries,
+    // so the closest points might differ by rounding errors
+    const FT d = tree.squared_distance(points[i]);
+    assert(CGAL::abs(CGAL::squared_distance(points[i], closest[i].first) - d) <= 1e-12);
+    assert(CGAL::abs(CGAL::squared_distance(points[i], closest_points[i]) - d) <= 1e-12);
+  }
+
+  std::vector<Ray_intersection> intersections;
+  tree.first_intersections(rays, std::back_inserter(intersections), ConcurrencyTag());
+  assert(intersections.size() == rays.size());
+  for(std::size_t i=0; i<rays.size(); ++i)
+  {
+    Ray_intersection inter = tree.first_intersection(rays[i]);
+    assert(bool(inter) == bool(intersections[i]));
+    if(inter)
+      assert(inter->first == intersections[i]->first && inter->second == intersections[i]->second);
+  }
+}
+
+int main()
+{
+  Mesh m;
+  std::ifstream in("data/bunny00.off");
+  assert(in);
+  in >> m;
+
+  Tree tree(faces(m).first, faces(m).second, m);
+  const CGAL::Bbox_3 bb = tree.bbox();
+
+  CGAL::Random rnd(0);
+  std::vector<Point> points;
+  std::vector<Ray> rays;
+  for(int i=0; i<5000; ++i)
+  {
+    points.push_back(random_point(rnd, bb));
+    rays.emplace_back(points.back(), random_point(rnd, bb));
+  }
+
+  test<CGAL::Sequential_tag>(tree, points, rays);
+  test<CGAL::Parallel_if_available_tag>(tree, points, rays);
+
+  // empty range
+  std::vector<Point> no_points;
+  std::vector<Point> out;
+  tree.closest_points(no_points, std::back_inserter(out));
+  assert(out.empty());
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,108 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_compact_tree.h>
+#include <CGAL/AABB_traits.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Epick K;
+typedef K::FT FT;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef K::Segment_3 Segment;
+
+typedef CGAL::Surface_mesh<Point> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh, CGAL::Default, CGAL::Tag_true, CGAL::Tag_true> Primitive;
+typedef CGAL::AABB_traits<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+typedef CGAL::AABB_compact_tree<Traits> Compact_tree;
+
+Point random_point(CGAL::Random& rnd, const CGAL::Bbox_3& bb)
+{
+  return Point(rnd.get_double(bb.xmin(), bb.xmax()),
+               rnd.get_double(bb.ymin(), bb.ymax()),
+               rnd.get_double(bb.zmin(), bb.zmax()));
+}
+
+int main()
+{
+  Mesh m;
+  std::ifstream in("data/bunny00.off");
+  assert(in);
+  in >> m;
+  assert(!m.is_empty());
+
+  Tree tree(faces(m).first, faces(m).second, m);
+  Compact_tree compact_tree(faces(m).first, faces(m).second, m);
+
+  assert(tree.size() == compact_tree.size());
+  const CGAL::Bbox_3 bb = tree.bbox();
+  const CGAL::Bbox_3 cbb = compact_tree.bbox();
+  // boxes are rounded outward
+  for(int i=0; i<3; ++i)
+  {
+    assert(cbb.min(i) <= bb.min(i));
+    assert(cbb.max(i) >= bb.max(i));
+  }
+  std::cout << "Compact tree memory: " << compact_tree.memory_usage() << " bytes" << std::endl;
+
+  CGAL::Random rnd(0);
+  for(int i=0; i<500; ++i)
+  {
+    const Point p = random_point(rnd, bb);
+    assert(tree.squared_distance(p) == compact_tree.squared_distance(p));
+    assert(tree.squared_distance(p, tree.closest_point(p)) ==
+           compact_tree.squared_distance(p));
+
+    const Segment s(p, random_point(rnd, bb));
+    assert(tree.do_intersect(s) == compact_tree.do_intersect(s));
+    assert(tree.number_of_intersected_primitives(s) == compact_tree.number_of_intersected_primitives(s));
+
+    std::vector<Primitive::Id> ids, cids;
+    tree.all_intersected_primitives(s, std::back_inserter(ids));
+    compact_tree.all_intersected_primitives(s, std::back_inserter(cids));
+    std::sort(ids.begin(), ids.end());
+    std::sort(cids.begin(), cids.end());
+    assert(ids == cids);
+
+    const Ray r(p, random_point(rnd, bb));
+    auto inter = tree.first_intersection(r);
+    auto cinter = compact_tree.first_intersection(r);
+    assert(bool(inter) == bool(cinter));
+    if(inter)
+      assert(inter->first == cinter->first);
+  }
+
+  // skip functor
+  const Ray r(Point(bb.xmin()-1, 0.5*(bb.ymin()+bb.ymax()), 0.5*(bb.zmin()+bb.zmax())), Vector(1, 0, 0));
+  auto first = compact_tree.first_intersected_primitive(r);
+  assert(first);
+  auto second = compact_tree.first_intersection(r, [&](Primitive::Id id){ return id == *first; });
+  assert(second && second->second != *first);
+
+  // degenerate sizes
+  Compact_tree empty_tree;
+  assert(empty_tree.empty());
+  assert(!empty_tree.do_intersect(r));
+  assert(!empty_tree.first_intersection(r));
+
+  Compact_tree small_tree;
+  small_tree.insert(faces(m).first, std::next(faces(m).first), m);
+  small_tree.build();
+  assert(small_tree.size() == 1);
+  small_tree.insert(std::next(faces(m).first), std::next(faces(m).first, 3), m);
+  small_tree.build();
+  assert(small_tree.size() == 3);
+  const Point p = m.point(target(halfedge(*std::next(faces(m).first, 2), m), m));
+  assert(small_tree.squared_distance(p) == 0);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,109 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits.h>
+#include <CGAL/AABB_triangle_primitive.h>
+#include <CGAL/Random.h>
+#include <CGAL/Timer.h>
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Simple_cartesian<double> K;
+typedef K::FT FT;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef K::Segment_3 Segment;
+typedef K::Triangle_3 Triangle;
+
+typedef std::vector<Triangle>::const_iterator Iterator;
+typedef CGAL::AABB_triangle_primitive<K, Iterator> Primitive;
+typedef CGAL::AABB_traits<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+
+Point random_point(CGAL::Random& rnd)
+{
+  return Point(rnd.get_double(-1., 1.), rnd.get_double(-1., 1.), rnd.get_double(-1., 1.));
+}
+
+void compare_trees(const Tree& reference, const Tree& tree, CGAL::Random& rnd, bool same_layout)
+{
+  assert(reference.size() == tree.size());
+  assert(reference.bbox() == tree.bbox());
+
+  for(int i=0; i<200; ++i)
+  {
+    const Point p = random_point(rnd);
+    assert(reference.squared_distance(p) == tree.squared_distance(p));
+
+    const Segment s(p, random_point(rnd));
+    assert(reference.do_intersect(s) == tree.do_intersect(s));
+    assert(reference.number_of_intersected_primitives(s) == tree.number_of_intersected_primitives(s));
+
+    const Ray r(p, Vector(rnd.get_double(-1., 1.), rnd.get_double(-1., 1.), rnd.get_double(-1., 1.)));
+    auto ref_inter = reference.first_intersection(r);
+    auto inter = tree.first_intersection(r);
+    assert(bool(ref_inter) == bool(inter));
+    if(ref_inter)
+      assert(ref_inter->second == inter->second);
+
+    if(same_layout)
+    {
+      // identical trees report the primitives in the same order
+      std::vector<Primitive::Id> ref_ids, ids;
+      reference.all_intersected_primitives(s, std::back_inserter(ref_ids));
+      tree.all_intersected_primitives(s, std::back_inserter(ids));
+      assert(ref_ids == ids);
+    }
+  }
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+
+  std::vector<Triangle> triangles;
+  for(int i=0; i<50000; ++i)
+  {
+    const Point p = random_point(rnd);
+    const Vector v1(rnd.get_double(0., 0.05), rnd.get_double(0., 0.05), rnd.get_double(0., 0.05));
+    const Vector v2(rnd.get_double(0., 0.05), rnd.get_double(0., 0.05), rnd.get_double(0., 0.05));
+    triangles.emplace_back(p, p + v1, p + v2);
+  }
+
+  CGAL::Timer timer;
+
+  Tree sequential_tree(triangles.begin(), triangles.end());
+  timer.start();
+  sequential_tree.build(CGAL::Sequential_tag());
+  timer.stop();
+  std::cout << "Sequential build: " << timer.time() << " sec." << std::endl;
+
+  Tree parallel_tree(triangles.begin(), triangles.end());
+  timer.reset();
+  timer.start();
+  parallel_tree.build(CGAL::Parallel_if_available_tag());
+  timer.stop();
+  std::cout << "Parallel (if available) build: " << timer.time() << " sec." << std::endl;
+
+  Tree sah_tree(triangles.begin(), triangles.end());
+  timer.reset();
+  timer.start();
+  sah_tree.custom_build(sah_tree.traits().compute_bbox_object(),
+                        sah_tree.traits().split_primitives_SAH_object(),
+                        CGAL::Parallel_if_available_tag());
+  timer.stop();
+  std::cout << "SAH build: " << timer.time() << " sec." << std::endl;
+
+  compare_trees(sequential_tree, parallel_tree, rnd, true);
+  compare_trees(sequential_tree, sah_tree, rnd, false);
+
+  // small trees do not go through the parallel code path
+  Tree small_tree(triangles.begin(), triangles.begin() + 3);
+  small_tree.build(CGAL::Parallel_if_available_tag());
+  assert(small_tree.size() == 3);
+  assert(small_tree.do_intersect(triangles[1]));
+
+  return EXIT_SUCCESS;
+}
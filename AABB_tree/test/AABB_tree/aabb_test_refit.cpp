@@ -0,0 +1,99 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Random.h>
+
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Epick K;
+typedef K::FT FT;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef K::Segment_3 Segment;
+
+typedef CGAL::Surface_mesh<Point> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+
+Point random_point(CGAL::Random& rnd, const CGAL::Bbox_3& bb)
+{
+  return Point(rnd.get_double(bb.xmin(), bb.xmax()),
+               rnd.get_double(bb.ymin(), bb.ymax()),
+               rnd.get_double(bb.zmin(), bb.zmax()));
+}
+
+void compare(const Tree& reference, const Tree& tree, CGAL::Random& rnd)
+{
+  const CGAL::Bbox_3 bb = reference.bbox();
+  assert(bb == tree.bbox());
+  for(int i=0; i<300; ++i)
+  {
+    const Point p = random_point(rnd, bb);
+    assert(reference.squared_distance(p) == tree.squared_distance(p));
+
+    const Segment s(p, random_point(rnd, bb));
+    assert(reference.do_intersect(s) == tree.do_intersect(s));
+    assert(reference.number_of_intersected_primitives(s) == tree.number_of_intersected_primitives(s));
+
+    const Ray r(p, random_point(rnd, bb));
+    auto inter = reference.first_intersection(r);
+    auto tinter = tree.first_intersection(r);
+    assert(bool(inter) == bool(tinter));
+    if(inter)
+      assert(inter->second == tinter->second);
+  }
+}
+
+int main()
+{
+  Mesh m;
+  std::ifstream in("data/bunny00.off");
+  assert(in);
+  in >> m;
+
+  Tree tree(faces(m).first, faces(m).second, m);
+  Tree tree_with_rebuild(faces(m).first, faces(m).second, m);
+  tree.build();
+  tree_with_rebuild.build();
+  // build the internal KD-tree, to check it is updated
+  tree.accelerate_distance_queries();
+
+  CGAL::Random rnd(0);
+  const CGAL::Bbox_3 bb = tree.bbox();
+  const double amplitude = 0.05 * (bb.xmax() - bb.xmin());
+
+  for(int iteration=0; iteration<3; ++iteration)
+  {
+    // deform the mesh
+    for(Mesh::Vertex_index v : vertices(m))
+    {
+      const Vector noise(rnd.get_double(-amplitude, amplitude),
+                         rnd.get_double(-amplitude, amplitude),
+                         rnd.get_double(-amplitude, amplitude));
+      m.point(v) = Point(1.2 * m.point(v).x(), m.point(v).y(), m.point(v).z()) + noise;
+    }
+
+    tree.refit();
+    tree_with_rebuild.refit(0.3);
+
+    Tree reference(faces(m).first, faces(m).second, m);
+    compare(reference, tree, rnd);
+    compare(reference, tree_with_rebuild, rnd);
+  }
+
+  // refit right after an insertion builds the tree
+  Tree small_tree;
+  small_tree.insert(faces(m).first, std::next(faces(m).first, 5), m);
+  small_tree.refit();
+  assert(small_tree.size() == 5);
+  assert(small_tree.do_intersect(small_tree.bbox()));
+
+  return EXIT_SUCCESS;
+}
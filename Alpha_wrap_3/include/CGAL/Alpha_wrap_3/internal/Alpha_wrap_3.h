@@ -48,6 +48,7 @@
 #include <CGAL/boost/graph/Euler_operations.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/Default.h>
+#include <CGAL/iterator.h>
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/Modifiable_priority_queue.h>
 #include <CGAL/Polygon_mesh_processing/bbox.h>
@@ -59,6 +60,12 @@
 #include <CGAL/Polygon_mesh_processing/stitch_borders.h> // only if non-manifoldness is not treated
 #include <CGAL/property_map.h>
 #include <CGAL/Real_timer.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/blocked_range.h>
+# include <tbb/parallel_for.h>
+#endif
 
 #include <algorithm>
 #include <array>
@@ -69,6 +76,7 @@
 #include <queue>
 #include <string>
 #include <type_traits>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -242,6 +250,14 @@ public:
 
     const bool do_enforce_manifoldness = choose_parameter(get_parameter(in_np, internal_np::do_enforce_manifoldness), true);
 
+    using Concurrency_tag = typename internal_np::Lookup_named_param_def<
+                              internal_np::concurrency_tag_t, InputNamedParameters, CGAL::Sequential_tag>::type;
+
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<Concurrency_tag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
 #ifdef CGAL_AW3_TIMER
     CGAL::Real_timer t;
     t.start();
@@ -258,7 +274,7 @@ public:
                                  CGAL::parameters::vertex_point_map(ovpm).stream_precision(17));
 #endif
 
-    alpha_flood_fill(visitor);
+    alpha_flood_fill<Concurrency_tag>(visitor);
 
 #ifdef CGAL_AW3_TIMER
     t.stop();
@@ -1012,7 +1028,113 @@ private:
       return initialize_with_cavities(seeds);
   }
 
-  template <typename Visitor>
+  // Inserts the Steiner point, computed from the gate `ch` -> `neighbor`,
+  // and updates the queue. The cells that are destroyed by the insertion are output in `destroyed_cells`.
+  template <typename Visitor, typename CellOutputIterator>
+  void insert_steiner_point(const Point_3& steiner_point,
+                            const Cell_handle neighbor,
+                            Visitor& visitor,
+                            CellOutputIterator destroyed_cells)
+  {
+//    std::cout << CGAL::abs(CGAL::approximate_sqrt(m_oracle.squared_distance(steiner_point)) - m_offset)
+//              << " vs " << 1e-2 * m_offset << std::endl;
+    CGAL_assertion(CGAL::abs(CGAL::approximate_sqrt(m_oracle.squared_distance(steiner_point)) - m_offset) <= 1e-2 * m_offset);
+
+    // locate cells that are going to be destroyed and remove their facet from the queue
+    int li, lj = 0;
+    Locate_type lt;
+    const Cell_handle conflict_cell = m_tr.locate(steiner_point, lt, li, lj, neighbor);
+    CGAL_assertion(lt != Triangulation::VERTEX);
+
+    // Using small vectors like in Triangulation_3 does not bring any runtime improvement
+    std::vector<Facet> boundary_facets;
+    std::vector<Cell_handle> conflict_zone;
+    boundary_facets.reserve(32);
+    conflict_zone.reserve(32);
+
+    m_tr.find_conflicts(steiner_point, conflict_cell,
+                        std::back_inserter(boundary_facets),
+                        std::back_inserter(conflict_zone));
+
+    // Purge the queue of facets that will be deleted/modified by the Steiner point insertion,
+    // and which might have been gates
+    for(const Cell_handle& cch : conflict_zone)
+    {
+      *destroyed_cells++ = cch;
+
+      for(int i=0; i<4; ++i)
+      {
+        const Facet cf = std::make_pair(cch, i);
+        if(m_queue.contains_with_bounds_check(Gate(cf)))
+          m_queue.erase(Gate(cf));
+      }
+    }
+
+    for(const Facet& f : boundary_facets)
+    {
+      const Facet mf = m_tr.mirror_facet(f); // boundary facets have incident cells in the CZ
+      if(m_queue.contains_with_bounds_check(Gate(mf)))
+        m_queue.erase(Gate(mf));
+    }
+
+    visitor.before_Steiner_point_insertion(*this, steiner_point);
+
+    // Actual insertion of the Steiner point
+    // We could use TDS functions to avoid recomputing the conflict zone, but in practice
+    // it does not bring any runtime improvements
+    Vertex_handle vh = m_tr.insert(steiner_point, lt, conflict_cell, li, lj);
+    vh->type() = AW3i::Vertex_type:: DEFAULT;
+
+    visitor.after_Steiner_point_insertion(*this, vh);
+
+    std::vector<Cell_handle> new_cells;
+    new_cells.reserve(32);
+    m_tr.incident_cells(vh, std::back_inserter(new_cells));
+    for(const Cell_handle& ch : new_cells)
+    {
+      // std::cout << "new cell has time stamp " << ch->time_stamp() << std::endl;
+      ch->is_outside() = m_tr.is_infinite(ch);
+    }
+
+    // Push all new boundary facets to the queue.
+    // It is not performed by looking at the facets on the boundary of the conflict zones
+    // because we need to handle internal facets, infinite facets, and also more subtle changes
+    // such as a new cell being marked inside which now creates a boundary
+    // with its incident "outside" flagged cell.
+    for(Cell_handle ch : new_cells)
+    {
+      for(int i=0; i<4; ++i)
+      {
+        if(m_tr.is_infinite(ch, i))
+          continue;
+
+        const Cell_handle nh = ch->neighbor(i);
+        if(nh->is_outside() == ch->is_outside()) // not on the boundary
+          continue;
+
+        const Facet boundary_f = std::make_pair(ch, i);
+        if(ch->is_outside())
+          push_facet(boundary_f);
+        else
+          push_facet(m_tr.mirror_facet(boundary_f));
+      }
+    }
+  }
+
+  void carve(const Cell_handle neighbor)
+  {
+    // tag neighbor as OUTSIDE
+    neighbor->is_outside() = true;
+
+    // for each finite facet of neighbor, push it to the queue
+    for(int i=0; i<4; ++i)
+    {
+      const Facet neighbor_f = std::make_pair(neighbor, i);
+      push_facet(neighbor_f);
+    }
+  }
+
+  template <typename ConcurrencyTag, typename Visitor>
   void alpha_flood_fill(Visitor& visitor)
   {
 #ifdef CGAL_AW3_DEBUG
@@ -1021,6 +1143,11 @@ private:
 
     visitor.on_flood_fill_begin(*this);
 
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+      alpha_flood_fill_in_batches(visitor);
+#endif
+
     // Explore all finite cells that are reachable from one of the initial outside cells.
     while(!m_queue.empty())
     {
@@ -1071,113 +1198,129 @@ private:
 
       Point_3 steiner_point;
       if(compute_steiner_point(ch, neighbor, steiner_point))
-      {
-//        std::cout << CGAL::abs(CGAL::approximate_sqrt(m_oracle.squared_distance(steiner_point)) - m_offset)
-//                  << " vs " << 1e-2 * m_offset << std::endl;
-        CGAL_assertion(CGAL::abs(CGAL::approximate_sqrt(m_oracle.squared_distance(steiner_point)) - m_offset) <= 1e-2 * m_offset);
-
-        // locate cells that are going to be destroyed and remove their facet from the queue
-        int li, lj = 0;
-        Locate_type lt;
-        const Cell_handle conflict_cell = m_tr.locate(steiner_point, lt, li, lj, neighbor);
-        CGAL_assertion(lt != Triangulation::VERTEX);
-
-        // Using small vectors like in Triangulation_3 does not bring any runtime improvement
-        std::vector<Facet> boundary_facets;
-        std::vector<Cell_handle> conflict_zone;
-        boundary_facets.reserve(32);
-        conflict_zone.reserve(32);
-
-        m_tr.find_conflicts(steiner_point, conflict_cell,
-                            std::back_inserter(boundary_facets),
-                            std::back_inserter(conflict_zone));
-
-        // Purge the queue of facets that will be deleted/modified by the Steiner point insertion,
-        // and which might have been gates
-        for(const Cell_handle& cch : conflict_zone)
-        {
-          for(int i=0; i<4; ++i)
-          {
-            const Facet cf = std::make_pair(cch, i);
-            if(m_queue.contains_with_bounds_check(Gate(cf)))
-              m_queue.erase(Gate(cf));
-          }
-        }
+        insert_steiner_point(steiner_point, neighbor, visitor, CGAL::Emptyset_iterator());
+      else
+        carve(neighbor);
+    } // while(!queue.empty())
 
-        for(const Facet& f : boundary_facets)
-        {
-          const Facet mf = m_tr.mirror_facet(f); // boundary facets have incident cells in the CZ
-          if(m_queue.contains_with_bounds_check(Gate(mf)))
-            m_queue.erase(Gate(mf));
-        }
+    visitor.on_flood_fill_end(*this);
 
-        visitor.before_Steiner_point_insertion(*this, steiner_point);
+    // Check that no useful facet has been ignored
+    CGAL_postcondition_code(for(auto fit=m_tr.finite_facets_begin(), fend=m_tr.finite_facets_end(); fit!=fend; ++fit) {)
+    CGAL_postcondition_code(  if(fit->first->is_outside() == fit->first->neighbor(fit->second)->is_outside()) continue;)
+    CGAL_postcondition_code(  Facet f = *fit;)
+    CGAL_postcondition_code(  if(!fit->first->is_outside()) f = m_tr.mirror_facet(f);)
+    CGAL_postcondition(       facet_status(f) == IRRELEVANT);
+    CGAL_postcondition_code(})
+  }
 
-        // Actual insertion of the Steiner point
-        // We could use TDS functions to avoid recomputing the conflict zone, but in practice
-        // it does not bring any runtime improvements
-        Vertex_handle vh = m_tr.insert(steiner_point, lt, conflict_cell, li, lj);
-        vh->type() = AW3i::Vertex_type:: DEFAULT;
+#ifdef CGAL_LINKED_WITH_TBB
+  // Number of gates that are popped at once from the queue in parallel mode
+  static constexpr std::size_t flood_fill_batch_size = 256;
+
+  // Parallel version of the flood fill: the gates are popped by batches from the queue,
+  // and their Steiner points are computed concurrently. The gates are then treated sequentially
+  // in priority order.
+  // A gate whose incident cells were destroyed by a Steiner point inserted earlier in the batch
+  // is dropped, as it would have been purged from the queue in the sequential version.
+  // Besides the two cells incident to the gate and the oracle, the Steiner point depends on
+  // the outside flags of the cells adjacent to the neighbor, which an earlier carving or insertion
+  // of the batch may have changed without destroying the neighbor: the Steiner point of such a gate
+  // is computed again sequentially.
+  unsigned char adjacent_outside_flags(const Cell_handle c) const
+  {
+    unsigned char flags = 0;
+    for(int i=0; i<4; ++i)
+      if(c->neighbor(i)->is_outside())
+        flags |= static_cast<unsigned char>(1 << i);
+    return flags;
+  }
+
+  template <typename Visitor>
+  void alpha_flood_fill_in_batches(Visitor& visitor)
+  {
+    m_oracle.build_trees();
 
-        visitor.after_Steiner_point_insertion(*this, vh);
+    std::vector<Gate> batch;
+    std::vector<Cell_handle> neighbors;
+    std::vector<Point_3> steiner_points;
+    std::vector<char> has_steiner_point; // not std::vector<bool>, which cannot be written concurrently
+    std::vector<unsigned char> outside_flags; // outside flags of the cells adjacent to the neighbor
+    std::unordered_set<Cell_handle> destroyed_cells;
 
-        std::vector<Cell_handle> new_cells;
-        new_cells.reserve(32);
-        m_tr.incident_cells(vh, std::back_inserter(new_cells));
-        for(const Cell_handle& ch : new_cells)
-        {
-          // std::cout << "new cell has time stamp " << ch->time_stamp() << std::endl;
-          ch->is_outside() = m_tr.is_infinite(ch);
-        }
+    batch.reserve(flood_fill_batch_size);
+    neighbors.reserve(flood_fill_batch_size);
 
-        // Push all new boundary facets to the queue.
-        // It is not performed by looking at the facets on the boundary of the conflict zones
-        // because we need to handle internal facets, infinite facets, and also more subtle changes
-        // such as a new cell being marked inside which now creates a boundary
-        // with its incident "outside" flagged cell.
-        for(Cell_handle ch : new_cells)
+    while(!m_queue.empty())
+    {
+      batch.clear();
+      neighbors.clear();
+      outside_flags.clear();
+      while(!m_queue.empty() && batch.size() < flood_fill_batch_size)
+      {
+        batch.push_back(m_queue.top());
+        m_queue.pop();
+
+        const Facet& f = batch.back().facet();
+        CGAL_precondition(!m_tr.is_infinite(f));
+        neighbors.push_back(f.first->neighbor(f.second));
+        outside_flags.push_back(adjacent_outside_flags(neighbors.back()));
+
+        // circumcenters are lazily cached in the cells: compute them before the threads read them
+        if(!m_tr.is_infinite(neighbors.back()))
         {
-          for(int i=0; i<4; ++i)
-          {
-            if(m_tr.is_infinite(ch, i))
-              continue;
-
-            const Cell_handle nh = ch->neighbor(i);
-            if(nh->is_outside() == ch->is_outside()) // not on the boundary
-              continue;
-
-            const Facet boundary_f = std::make_pair(ch, i);
-            if(ch->is_outside())
-              push_facet(boundary_f);
-            else
-              push_facet(m_tr.mirror_facet(boundary_f));
-          }
+          if(!m_tr.is_infinite(f.first))
+            circumcenter(f.first);
+          circumcenter(neighbors.back());
         }
       }
-      else
+
+      steiner_points.resize(batch.size());
+      has_steiner_point.assign(batch.size(), false);
+
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, batch.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                          {
+                            if(m_tr.is_infinite(neighbors[i]))
+                              continue;
+
+                            has_steiner_point[i] = compute_steiner_point(batch[i].facet().first, neighbors[i],
+                                                                         steiner_points[i]);
+                          }
+                        });
+
+      destroyed_cells.clear();
+      for(std::size_t i=0; i<batch.size(); ++i)
       {
-        // tag neighbor as OUTSIDE
-        neighbor->is_outside() = true;
+        const Gate& gate = batch[i];
+        const Cell_handle ch = gate.facet().first;
+        const Cell_handle neighbor = neighbors[i];
+
+        if(destroyed_cells.count(ch) != 0 || destroyed_cells.count(neighbor) != 0)
+          continue;
 
-        // for each finite facet of neighbor, push it to the queue
-        for(int i=0; i<4; ++i)
+        visitor.before_facet_treatment(*this, gate);
+
+        if(m_tr.is_infinite(neighbor))
         {
-          const Facet neighbor_f = std::make_pair(neighbor, i);
-          push_facet(neighbor_f);
+          neighbor->is_outside() = true;
+          continue;
         }
-      }
-    } // while(!queue.empty())
 
-    visitor.on_flood_fill_end(*this);
+        if(adjacent_outside_flags(neighbor) != outside_flags[i])
+          has_steiner_point[i] = compute_steiner_point(ch, neighbor, steiner_points[i]);
 
-    // Check that no useful facet has been ignored
-    CGAL_postcondition_code(for(auto fit=m_tr.finite_facets_begin(), fend=m_tr.finite_facets_end(); fit!=fend; ++fit) {)
-    CGAL_postcondition_code(  if(fit->first->is_outside() == fit->first->neighbor(fit->second)->is_outside()) continue;)
-    CGAL_postcondition_code(  Facet f = *fit;)
-    CGAL_postcondition_code(  if(!fit->first->is_outside()) f = m_tr.mirror_facet(f);)
-    CGAL_postcondition(       facet_status(f) == IRRELEVANT);
-    CGAL_postcondition_code(})
+        if(has_steiner_point[i])
+          insert_steiner_point(steiner_points[i], neighbor, visitor,
+                               std::inserter(destroyed_cells, destroyed_cells.end()));
+        else
+          carve(neighbor);
+      }
+    }
   }
+#endif
 
 private:
   bool is_non_manifold(Vertex_handle v) const
@@ -51,6 +51,15 @@ struct AABB_tree_oracle_helper
   using FT = typename AABB_traits::FT;
   using Point_3 = typename AABB_traits::Point_3;
 
+  // triggers the lazy constructions of the tree and of its internal KD-tree
+  static void build_tree(const AABBTree& tree)
+  {
+    CGAL_precondition(!tree.empty());
+
+    const auto bb = tree.bbox();
+    tree.best_hint(Point_3(bb.xmin(), bb.ymin(), bb.zmin()));
+  }
+
   template <typename Query>
   static bool do_intersect(const Query& query,
                            const AABBTree& tree)
@@ -147,6 +156,17 @@ public:
 
   void clear() { m_tree_ptr->clear() && base().clear(); }
 
+  // The trees are built lazily upon the first query. Triggering the constructions beforehand
+  // avoids threads competing for it when the (const) queries are called concurrently.
+  void build_trees() const
+  {
+    if(base().do_call())
+      base().build_trees();
+
+    if(!empty())
+      AABB_helper::build_tree(tree());
+  }
+
 public:
   typename AABB_tree::Bounding_box bbox() const
   {
@@ -317,6 +337,12 @@ public:
 
   void clear() { m_tree_ptr->clear(); }
 
+  void build_trees() const
+  {
+    if(!empty())
+      AABB_helper::build_tree(tree());
+  }
+
 public:
   typename AABB_tree::Bounding_box bbox() const
   {
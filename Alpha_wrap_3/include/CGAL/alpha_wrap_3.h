@@ -71,6 +71,15 @@ namespace CGAL {
 *     \cgalParamExtra{<ul><li>The geometric traits class must be compatible with the point type.</li>
 *                         <li>The geometric traits should use a floating point number type (see \ref aw3_interface).</li></ul>}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating whether the Steiner points should be computed in parallel}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{With `CGAL::Parallel_tag`, the gates are extracted by batches from the priority queue
+*                     and their Steiner points are computed concurrently, before being inserted in priority order.
+*                     The output may thus slightly differ from the sequential version.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * \param out_np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
@@ -218,6 +227,15 @@ void alpha_wrap_3(const PointRange& points,
 *     \cgalParamExtra{<ul><li>The geometric traits class must be compatible with the point type.</li>
 *                         <li>The geometric traits should use a floating point number type (see \ref aw3_interface).</li></ul>}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating whether the Steiner points should be computed in parallel}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{With `CGAL::Parallel_tag`, the gates are extracted by batches from the priority queue
+*                     and their Steiner points are computed concurrently, before being inserted in priority order.
+*                     The output may thus slightly differ from the sequential version.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * \param out_np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
@@ -304,6 +322,15 @@ void alpha_wrap_3(const TriangleMesh& tmesh,
 *     \cgalParamExtra{<ul><li>The geometric traits class must be compatible with the point type.</li>
 *                         <li>The geometric traits should use a floating point number type (see \ref aw3_interface).</li></ul>}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating whether the Steiner points should be computed in parallel}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{With `CGAL::Parallel_tag`, the gates are extracted by batches from the priority queue
+*                     and their Steiner points are computed concurrently, before being inserted in priority order.
+*                     The output may thus slightly differ from the sequential version.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * \param out_np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
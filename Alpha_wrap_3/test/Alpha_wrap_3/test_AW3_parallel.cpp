@@ -0,0 +1,165 @@
+#define CGAL_AW3_TIMER
+//#define CGAL_AW3_DEBUG
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/alpha_wrap_3.h>
+#include "alpha_wrap_validation.h"
+
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/IO/polygon_soup_io.h>
+#include <CGAL/Polygon_mesh_processing/bbox.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+#include <CGAL/tags.h>
+
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using Kernel = CGAL::Exact_predicates_inexact_constructions_kernel;
+using Point_3 = Kernel::Point_3;
+using Vector_3 = Kernel::Vector_3;
+
+using Points = std::vector<Point_3>;
+using Face = std::vector<std::size_t>;
+using Faces = std::vector<Face>;
+
+using Mesh = CGAL::Surface_mesh<Point_3>;
+
+#ifdef CGAL_LINKED_WITH_TBB
+using Concurrency_tag = CGAL::Parallel_tag;
+#else
+using Concurrency_tag = CGAL::Sequential_tag;
+#endif
+
+namespace AW3 = CGAL::Alpha_wraps_3;
+
+double diagonal_length(const Mesh& mesh)
+{
+  const CGAL::Bbox_3 bbox = CGAL::Polygon_mesh_processing::bbox(mesh);
+  const Vector_3 diag = Point_3(bbox.xmax(), bbox.ymax(), bbox.zmax()) -
+                        Point_3(bbox.xmin(), bbox.ymin(), bbox.zmin());
+  return CGAL::to_double(CGAL::approximate_sqrt(diag.squared_length()));
+}
+
+// the parallel wrap only differs from the sequential one by the order in which gates are treated
+void check_close(const Mesh& wrap, const Mesh& seq_wrap)
+{
+  std::cout << "Result: " << num_vertices(wrap) << " vertices ("
+            << num_vertices(seq_wrap) << " sequentially)" << std::endl;
+
+  assert(num_vertices(wrap) > 0.8 * num_vertices(seq_wrap));
+  assert(num_vertices(wrap) < 1.2 * num_vertices(seq_wrap));
+}
+
+void alpha_wrap_triangle_mesh(const std::string& filename,
+                              const double alpha_rel,
+                              const double offset_rel)
+{
+  std::cout << "== Triangle mesh " << filename << std::endl;
+
+  Mesh input_mesh;
+  bool res = CGAL::Polygon_mesh_processing::IO::read_polygon_mesh(filename, input_mesh);
+  assert(res);
+  assert(!is_empty(input_mesh) && is_triangle_mesh(input_mesh));
+
+  const double alpha = diagonal_length(input_mesh) / alpha_rel;
+  const double offset = diagonal_length(input_mesh) / offset_rel;
+
+  Mesh wrap, seq_wrap;
+  CGAL::alpha_wrap_3(input_mesh, alpha, offset, wrap,
+                     CGAL::parameters::concurrency_tag(Concurrency_tag()));
+  CGAL::alpha_wrap_3(input_mesh, alpha, offset, seq_wrap);
+
+  assert(AW3::internal::is_valid_wrap(wrap, true /*manifoldness*/));
+  assert(AW3::internal::is_outer_wrap_of_triangle_mesh(wrap, input_mesh));
+  check_close(wrap, seq_wrap);
+
+  // the oracle can be reused for several (parallel) wraps
+  using Oracle = AW3::internal::Triangle_mesh_oracle<Kernel>;
+  using Wrapper = AW3::internal::Alpha_wrap_3<Oracle>;
+
+  Oracle oracle(alpha);
+  oracle.add_triangle_mesh(input_mesh);
+  Wrapper wrapper(oracle);
+
+  Mesh first_wrap, second_wrap;
+  wrapper(alpha, offset, first_wrap, CGAL::parameters::concurrency_tag(Concurrency_tag()));
+  wrapper(alpha, offset, second_wrap, CGAL::parameters::concurrency_tag(Concurrency_tag()));
+
+  // the batches are treated in a deterministic order
+  assert(num_vertices(first_wrap) == num_vertices(second_wrap));
+  assert(num_faces(first_wrap) == num_faces(second_wrap));
+  assert(num_vertices(first_wrap) == num_vertices(wrap));
+}
+
+void alpha_wrap_point_set(const std::string& filename,
+                          const double alpha_rel,
+                          const double offset_rel)
+{
+  std::cout << "== Point set " << filename << std::endl;
+
+  Mesh input_mesh;
+  bool res = CGAL::Polygon_mesh_processing::IO::read_polygon_mesh(filename, input_mesh);
+  assert(res);
+
+  Points points(input_mesh.points().begin(), input_mesh.points().end());
+
+  const double alpha = diagonal_length(input_mesh) / alpha_rel;
+  const double offset = diagonal_length(input_mesh) / offset_rel;
+
+  Mesh wrap, seq_wrap;
+  CGAL::alpha_wrap_3(points, alpha, offset, wrap,
+                     CGAL::parameters::concurrency_tag(Concurrency_tag()));
+  CGAL::alpha_wrap_3(points, alpha, offset, seq_wrap);
+
+  assert(AW3::internal::is_valid_wrap(wrap, true /*manifoldness*/));
+  assert(AW3::internal::is_outer_wrap_of_point_set(wrap, points));
+  check_close(wrap, seq_wrap);
+}
+
+void alpha_wrap_triangle_soup(const std::string& filename,
+                              const double alpha_rel,
+                              const double offset_rel)
+{
+  std::cout << "== Triangle soup " << filename << std::endl;
+
+  Points points;
+  Faces faces;
+  bool res = CGAL::IO::read_polygon_soup(filename, points, faces);
+  assert(res && !faces.empty());
+
+  const CGAL::Bbox_3 bbox = CGAL::bbox_3(points.begin(), points.end());
+  const Vector_3 diag = Point_3(bbox.xmax(), bbox.ymax(), bbox.zmax()) -
+                        Point_3(bbox.xmin(), bbox.ymin(), bbox.zmin());
+  const double diag_length = CGAL::to_double(CGAL::approximate_sqrt(diag.squared_length()));
+
+  const double alpha = diag_length / alpha_rel;
+  const double offset = diag_length / offset_rel;
+
+  Mesh wrap, seq_wrap;
+  CGAL::alpha_wrap_3(points, faces, alpha, offset, wrap,
+                     CGAL::parameters::concurrency_tag(Concurrency_tag()));
+  CGAL::alpha_wrap_3(points, faces, alpha, offset, seq_wrap);
+
+  assert(AW3::internal::is_valid_wrap(wrap, true /*manifoldness*/));
+  assert(AW3::internal::is_outer_wrap_of_triangle_soup(wrap, points, faces));
+  check_close(wrap, seq_wrap);
+}
+
+int main(int argc, char** argv)
+{
+  std::cout.precision(17);
+  std::cerr.precision(17);
+
+  const std::string filename = (argc > 1) ? argv[1] : "data/bunny_random_perturbation.off";
+
+  alpha_wrap_triangle_mesh(filename, 50., 600.);
+  alpha_wrap_triangle_mesh("data/two_knives.off", 20., 300.);
+  alpha_wrap_point_set(filename, 30., 300.);
+  alpha_wrap_triangle_soup("data/non_manifold.off", 20., 200.);
+
+  std::cout << "Done!" << std::endl;
+  return EXIT_SUCCESS;
+}
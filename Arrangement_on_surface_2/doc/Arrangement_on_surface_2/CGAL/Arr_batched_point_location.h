@@ -14,6 +14,12 @@ pairs in the output sequence are sorted in increasing \f$ xy\f$-lexicographical
 order of the query points. The function returns a past-the-end iterator of
 the output sequence.
 
+If `ConcurrencyTag` is `Parallel_tag` and the \ref thirdpartyTBB library
+is available, the query points are split into vertical slabs, which are swept
+in parallel. For bounded arrangements, each sweep only processes the curves
+that intersect its slab. The results are identical to the sequential ones,
+and are reported in the same order.
+
 \cgalHeading{Requirements}
 
 <UL>
@@ -25,7 +31,8 @@ the output sequence.
 \sa `CGAL::Arr_point_location_result<Arrangement>`
 
 */
-template<typename Traits, typename Dcel,
+template<typename ConcurrencyTag = Sequential_tag,
+typename Traits, typename Dcel,
 typename InputIterator, typename OutputIterator>
 OutputIterator locate (const Arrangement_2<Traits,Dcel>& arr,
 InputIterator points_begin,
@@ -47,6 +47,10 @@ when the application frequently issues point-location queries on a
 rather static arrangement that the changes applied to it are mainly
 insertions of curves and not deletions of them.
 
+The queries do not modify the point-location structure. Hence, they can
+be issued concurrently from several threads, as long as the arrangement is
+not modified.
+
 \cgalModels{ArrangementPointLocation_2,ArrangementVerticalRayShoot_2}
 
 \sa `ArrangementPointLocation_2`
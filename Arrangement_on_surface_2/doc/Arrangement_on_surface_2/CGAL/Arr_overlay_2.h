@@ -17,6 +17,21 @@ of both input arrangements have to be convertible to the types in the
 resulting arrangement. A given overlay-traits object is used to properly
 construct the overlaid \dcel that represents the resulting arrangement.
 
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+  Possible values are `Sequential_tag` (the default) and `Parallel_tag`.
+  With `Parallel_tag`, the plane is split into vertical slabs, which are swept
+  concurrently to compute the intersections of the curves of both
+  arrangements. The curves are then split at these intersections, and the
+  overlaid arrangement is constructed by a single sweep that computes no
+  intersections, which issues the same calls to `ovl_tr` as the sequential
+  overlay. The parallel version applies to arrangements of bounded curves in
+  the plane; it falls back to the sequential one otherwise, if the
+  arrangements have fewer than 2048 curves in total, or if a single thread is
+  available.
+  The \dcel of the result is not constructed per slab and merged along the
+  slab bounds, but by one global sequential sweep: only the computation of the
+  intersections runs in parallel, which bounds the speedup.
+
 \pre `res` does not refer to either `arr1` or `arr2` (that is, "self overlay" is not supported).
 
 \pre The overlay-traits object `ovl_tr` must model the `OverlayTraits`
@@ -25,7 +40,8 @@ construct the overlaid \dcel that represents the resulting arrangement.
 
 \sa `OverlayTraits`
 */
-template <class GeomTraitsA, class GeomTraitsB,
+template <class ConcurrencyTag = Sequential_tag,
+          class GeomTraitsA, class GeomTraitsB,
           class GeomTraitsRes, class TopTraitsA,
           class TopTraitsB, class TopTraitsRes,
           class OverlayTraits>
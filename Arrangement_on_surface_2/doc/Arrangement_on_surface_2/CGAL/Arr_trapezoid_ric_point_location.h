@@ -26,6 +26,19 @@ is relatively large.
 
 This strategy supports arbitrary subdivisions, including unbounded ones.
 
+During a global change of the arrangement, such as an aggregated insertion,
+the search structure is updated without checking its size and depth, and is
+rebuilt once the change is over if needed. If the change more than doubles
+the number of curves, the search structure is constructed from scratch
+instead of being updated.
+
+\tparam Arrangement an instance of `Arrangement_on_surface_2`.
+\tparam ConcurrencyTag enables sequential versus parallel construction of the search structure.
+With `CGAL::Parallel_tag`, the endpoints of the curves are located concurrently when
+the search structure is built from scratch.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+The default value is `Sequential_tag`.
+
 \cgalModels{ArrangementPointLocation_2,ArrangementVerticalRayShoot_2}
 
 \sa `ArrangementPointLocation_2`
@@ -33,7 +46,7 @@ This strategy supports arbitrary subdivisions, including unbounded ones.
 \sa `CGAL::Arr_point_location_result<Arrangement>`
 
 */
-template< typename Arrangement >
+template< typename Arrangement, typename ConcurrencyTag = Sequential_tag >
 class Arr_trapezoid_ric_point_location {
 public:
 
@@ -60,6 +73,31 @@ If with_guarantees is set to true, the structure will guarantee linear size and
 */
 void with_guarantees (bool with_guarantees);
 
+/*!
+If read_only is set to true, the queries do not record the located trapezoids as hints for the next update of the search structure. The queries can then be issued concurrently from several threads, as long as the arrangement is not modified. By default, the queries are not read-only.
+*/
+void read_only_queries (bool read_only);
+
+/// @}
+
+/// \name Statistics
+/// @{
+
+/*!
+returns the number of times the search structure was rebuilt from scratch.
+*/
+unsigned long number_of_rebuilds() const;
+
+/*!
+returns the time, in seconds, taken by the last reconstruction of the search structure.
+*/
+double last_rebuild_time() const;
+
+/*!
+returns the total time, in seconds, taken by the reconstructions of the search structure.
+*/
+double total_rebuild_time() const;
+
 /// @}
 
 }; /* end Arr_trapezoid_ric_point_location */
@@ -25,14 +25,155 @@
 #include <CGAL/Surface_sweep_2/No_overlap_subcurve.h>
 #include <CGAL/Surface_sweep_2/Arr_batched_pl_ss_visitor.h>
 
+#include <CGAL/Arr_tags.h>
+#include <CGAL/Arrangement_2/Arr_traits_adaptor_2.h>
+#include <CGAL/tags.h>
+
 #include <vector>
+#include <type_traits>
 #include <boost/mpl/if.hpp>
 #include <boost/type_traits.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/task_arena.h>
+#endif
+
 namespace CGAL {
 
 namespace Ss2 = Surface_sweep_2;
 
+#ifdef CGAL_LINKED_WITH_TBB
+namespace internal {
+
+// Whether the x-range of the given curve (of a bounded arrangement)
+// intersects the slab [x_min, x_max].
+template <typename Arr, typename Xcv>
+bool is_curve_in_slab(const Arr& arr, const Xcv& xcv,
+                      const typename Arr::Point_2& x_min,
+                      const typename Arr::Point_2& x_max,
+                      Arr_all_sides_oblivious_tag)
+{
+  auto compare_x = arr.geometry_traits()->compare_x_2_object();
+
+  // The associated halfedge is directed from right to left.
+  return
+    (compare_x(xcv.halfedge_handle()->source()->point(), x_min) != SMALLER) &&
+    (compare_x(xcv.halfedge_handle()->target()->point(), x_max) != LARGER);
+}
+
+template <typename Arr, typename Pt>
+bool is_point_in_slab(const Arr& arr, const Pt& pt,
+                      const typename Arr::Point_2& x_min,
+                      const typename Arr::Point_2& x_max,
+                      Arr_all_sides_oblivious_tag)
+{
+  auto compare_x = arr.geometry_traits()->compare_x_2_object();
+  return (compare_x(pt.base(), x_min) != SMALLER) &&
+    (compare_x(pt.base(), x_max) != LARGER);
+}
+
+// With unbounded curves or on a surface, the features to the left of a slab
+// may determine the top face of the slab queries, so all of them are swept.
+template <typename Arr, typename Xcv>
+bool is_curve_in_slab(const Arr&, const Xcv&,
+                      const typename Arr::Point_2&, const typename Arr::Point_2&,
+                      Arr_not_all_sides_oblivious_tag)
+{ return true; }
+
+template <typename Arr, typename Pt>
+bool is_point_in_slab(const Arr&, const Pt&,
+                      const typename Arr::Point_2&, const typename Arr::Point_2&,
+                      Arr_not_all_sides_oblivious_tag)
+{ return true; }
+
+// Splits the (sorted) query points into vertical slabs and sweeps each slab
+// independently, with the curves and isolated points that intersect it.
+// The results are gathered in the same order as the sequential sweep.
+template <typename Bpl_helper, typename Arr, typename Bgt2,
+          typename PointsIterator, typename OutputIterator,
+          typename AllSidesObliviousCategory>
+OutputIterator
+parallel_batched_locate(const Arr& arr, const Bgt2& ex_traits,
+                        const std::vector<typename Bgt2::X_monotone_curve_2>& xcurves,
+                        const std::vector<typename Bgt2::Point_2>& iso_pts,
+                        PointsIterator points_begin, PointsIterator points_end,
+                        OutputIterator oi,
+                        AllSidesObliviousCategory category)
+{
+  typedef typename Arr::Point_2                         Point_2;
+  typedef Arr_point_location_result<Arr>                Pl_result;
+  typedef std::pair<Point_2, typename Pl_result::Type>  Query_result;
+  typedef std::vector<Query_result>                     Query_results;
+  typedef std::back_insert_iterator<Query_results>      Slab_output_iterator;
+  typedef Arr_batched_pl_ss_visitor<Bpl_helper, Slab_output_iterator>
+                                                        Slab_visitor;
+
+  // minimal number of queries per slab, below which the slab sweeps cost
+  // more than they save
+  const std::size_t min_slab_size = 256;
+
+  std::vector<Point_2> queries(points_begin, points_end);
+  if (queries.empty()) return oi;
+
+  auto compare_xy = arr.geometry_traits()->compare_xy_2_object();
+  tbb::parallel_sort(queries.begin(), queries.end(),
+                     [&](const Point_2& p, const Point_2& q)
+                     { return compare_xy(p, q) == SMALLER; });
+
+  // Cut the queries into slabs of (about) the same size, without separating
+  // equal points, which are reported once.
+  const std::size_t nb_slabs =
+    (std::max)(std::size_t(1),
+               (std::min)(std::size_t(4 * tbb::this_task_arena::max_concurrency()),
+                          queries.size() / min_slab_size));
+  std::vector<std::size_t> bounds(1, 0);
+  for (std::size_t i = 1; i < nb_slabs; ++i) {
+    std::size_t b = (std::max)(bounds.back(), i * queries.size() / nb_slabs);
+    while (b > bounds.back() && b < queries.size() &&
+           compare_xy(queries[b - 1], queries[b]) == EQUAL)
+      ++b;
+    if (b > bounds.back() && b < queries.size()) bounds.push_back(b);
+  }
+  bounds.push_back(queries.size());
+
+  std::vector<Query_results> results(bounds.size() - 1);
+  tbb::parallel_for(std::size_t(0), results.size(), [&](std::size_t i)
+  {
+    const Point_2& x_min = queries[bounds[i]];
+    const Point_2& x_max = queries[bounds[i + 1] - 1];
+
+    std::vector<typename Bgt2::X_monotone_curve_2> slab_xcurves;
+    for (const auto& xcv : xcurves)
+      if (is_curve_in_slab(arr, xcv, x_min, x_max, category))
+        slab_xcurves.push_back(xcv);
+
+    std::vector<typename Bgt2::Point_2> slab_iso_pts;
+    for (const auto& pt : iso_pts)
+      if (is_point_in_slab(arr, pt, x_min, x_max, category))
+        slab_iso_pts.push_back(pt);
+
+    Slab_output_iterator slab_oi(results[i]);
+    Slab_visitor visitor(&arr, slab_oi);
+    Ss2::No_intersection_surface_sweep_2<Slab_visitor>
+      surface_sweep(&ex_traits, &visitor);
+    surface_sweep.sweep(slab_xcurves.begin(), slab_xcurves.end(),
+                        slab_iso_pts.begin(), slab_iso_pts.end(),
+                        queries.begin() + bounds[i],
+                        queries.begin() + bounds[i + 1]);
+  });
+
+  for (const Query_results& slab_results : results)
+    for (const Query_result& res : slab_results)
+      *oi++ = res;
+
+  return oi;
+}
+
+} // namespace internal
+#endif
+
 /*! Issue a batched point-location query on an arrangement given an input
  * range of points.
  * \param arr The arrangement.
@@ -45,14 +186,22 @@ namespace Ss2 = Surface_sweep_2;
  *                                      Halfedge_const_handle,
  *                                      Face_const_handle> >.
  *      It represents the arrangement feature containing the point.
+ * \tparam ConcurrencyTag If `Parallel_tag`, the query points are split into
+ *      vertical slabs, which are swept concurrently.
  */
-template <typename GeometryTraits_2, typename TopologyTraits,
+template <typename ConcurrencyTag = Sequential_tag,
+          typename GeometryTraits_2, typename TopologyTraits,
           typename PointsIterator, typename OutputIterator>
 OutputIterator
 locate(const Arrangement_on_surface_2<GeometryTraits_2, TopologyTraits>& arr,
        PointsIterator points_begin, PointsIterator points_end,
        OutputIterator oi)
 {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
   typedef GeometryTraits_2                              Gt2;
   typedef TopologyTraits                                Tt;
   typedef OutputIterator                                Output_iterator;
@@ -123,6 +272,22 @@ locate(const Arrangement_on_surface_2<GeometryTraits_2, TopologyTraits>& arr,
   typename boost::mpl::if_<std::is_same<Gt2, Bgt2>, const Bgt2&, Bgt2>::type
     ex_traits(*geom_traits);
 
+#ifdef CGAL_LINKED_WITH_TBB
+  if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+    typedef Arr_traits_basic_adaptor_2<Gt2>             Traits_adaptor_2;
+    typedef typename Arr_all_sides_oblivious_category<
+      typename Traits_adaptor_2::Left_side_category,
+      typename Traits_adaptor_2::Bottom_side_category,
+      typename Traits_adaptor_2::Top_side_category,
+      typename Traits_adaptor_2::Right_side_category>::result
+                                                        All_sides_oblivious_category;
+
+    return internal::parallel_batched_locate<Bpl_helper>
+      (arr, ex_traits, xcurves_vec, iso_pts_vec, points_begin, points_end, oi,
+       All_sides_oblivious_category());
+  }
+#endif
+
   // Define the sweep-line visitor and perform the sweep.
   Bpl_visitor visitor(&arr, oi);
   Ss2::No_intersection_surface_sweep_2<Bpl_visitor>
@@ -25,21 +25,180 @@
 
 #include <vector>
 #include <optional>
+#include <type_traits>
 #include <boost/mpl/if.hpp>
 #include <boost/mpl/or.hpp>
 #include <boost/type_traits.hpp>
 
 #include <CGAL/Arrangement_on_surface_2.h>
 #include <CGAL/Surface_sweep_2.h>
+#include <CGAL/No_intersection_surface_sweep_2.h>
+#include <CGAL/Surface_sweep_2/Slab_surface_sweep_2.h>
 #include <CGAL/Surface_sweep_2/Arr_default_overlay_traits_base.h>
 #include <CGAL/Surface_sweep_2/Arr_overlay_traits_2.h>
 #include <CGAL/Surface_sweep_2/Arr_overlay_ss_visitor.h>
 #include <CGAL/Surface_sweep_2/Arr_overlay_event.h>
 #include <CGAL/Surface_sweep_2/Arr_overlay_subcurve.h>
+#include <CGAL/Arr_tags.h>
 #include <CGAL/assertions.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/task_arena.h>
+#endif
 
 namespace CGAL {
 
+#ifdef CGAL_LINKED_WITH_TBB
+namespace internal {
+
+// Splits the curves of the overlay at their intersection points, which are
+// computed by sweeping vertical slabs concurrently, and merges each pair of
+// overlapping red and blue subcurves into a single red-blue subcurve. The
+// resulting curves are pairwise interior-disjoint. Their ends are indexed
+// in end_indices (2i for the min end of the i-th curve, and 2i+1 for its max
+// end), such that equal points have equal indices. Returns false (and leaves
+// the curves unchanged) if there are too few curves to make the slabs worth
+// it.
+template <typename Ovl_gt2>
+bool split_overlay_curves(std::vector<typename Ovl_gt2::X_monotone_curve_2>& xcurves,
+                          const std::vector<typename Ovl_gt2::Point_2>& iso_pts,
+                          const Ovl_gt2& ex_traits,
+                          std::vector<std::size_t>& end_indices,
+                          Arr_all_sides_oblivious_tag)
+{
+  typedef typename Ovl_gt2::Geometry_traits_2           Gt2;
+  typedef typename Gt2::X_monotone_curve_2              X_monotone_curve_2;
+  typedef typename Gt2::Point_2                         Point_2;
+  typedef typename Ovl_gt2::X_monotone_curve_2          Ovl_x_monotone_curve_2;
+  typedef typename Ovl_x_monotone_curve_2::HH_red       HH_red;
+  typedef typename Ovl_x_monotone_curve_2::HH_blue      HH_blue;
+
+  // The intersections do not depend on the halfedges of the curves, so the
+  // slabs are swept with the underlying curves and traits.
+  const Gt2& tr = *ex_traits.base_traits();
+  std::vector<X_monotone_curve_2> base_xcurves(xcurves.size());
+  for (std::size_t i = 0; i < xcurves.size(); ++i)
+    base_xcurves[i] = xcurves[i].base();
+  std::vector<Point_2> base_iso_pts(iso_pts.size());
+  for (std::size_t i = 0; i < iso_pts.size(); ++i)
+    base_iso_pts[i] = iso_pts[i].base();
+
+  std::vector<Point_2> bounds;
+  std::vector<Ss2::Slab_events_visitor<Gt2> > visitors;
+  if (! Ss2::slab_sweep(base_xcurves, base_iso_pts, false, true, tr,
+                        bounds, visitors))
+    return false;
+
+  std::vector<X_monotone_curve_2> pieces;
+  std::vector<std::size_t> first;
+  Ss2::split_at_slab_events(base_xcurves, visitors, tr, pieces, first);
+  std::vector<std::size_t> same;
+  Ss2::find_identical_pieces(pieces, first, visitors, tr, same);
+
+  // Each subcurve keeps the halfedge of its curve. The curves of an
+  // arrangement are interior-disjoint, so identical subcurves come in pairs
+  // of a red and a blue one, which are merged.
+  std::vector<Ovl_x_monotone_curve_2> ovl_pieces(pieces.size());
+  for (std::size_t i = 0; i < xcurves.size(); ++i)
+    for (std::size_t j = first[i]; j < first[i + 1]; ++j)
+      ovl_pieces[j] =
+        Ovl_x_monotone_curve_2(pieces[j], xcurves[i].red_halfedge_handle(),
+                               xcurves[i].blue_halfedge_handle());
+  for (std::size_t j = 0; j < pieces.size(); ++j) {
+    if (same[j] == j) continue;
+    Ovl_x_monotone_curve_2& xcv = ovl_pieces[same[j]];
+    if (ovl_pieces[j].red_halfedge_handle() != HH_red())
+      xcv.set_red_halfedge_handle(ovl_pieces[j].red_halfedge_handle());
+    if (ovl_pieces[j].blue_halfedge_handle() != HH_blue())
+      xcv.set_blue_halfedge_handle(ovl_pieces[j].blue_halfedge_handle());
+  }
+
+  xcurves.clear();
+  for (std::size_t j = 0; j < pieces.size(); ++j)
+    if (same[j] == j) xcurves.push_back(ovl_pieces[j]);
+
+  // Index the curve ends by sorting them.
+  typedef std::pair<Point_2, std::size_t>               Indexed_point;
+  std::vector<Indexed_point> ends(2 * xcurves.size());
+  auto min_vertex = tr.construct_min_vertex_2_object();
+  auto max_vertex = tr.construct_max_vertex_2_object();
+  tbb::parallel_for(std::size_t(0), xcurves.size(), [&](std::size_t i)
+  {
+    ends[2 * i] = Indexed_point(min_vertex(xcurves[i].base()), 2 * i);
+    ends[2 * i + 1] = Indexed_point(max_vertex(xcurves[i].base()), 2 * i + 1);
+  });
+
+  auto compare_xy = tr.compare_xy_2_object();
+  tbb::parallel_sort(ends.begin(), ends.end(),
+                     [&](const Indexed_point& p, const Indexed_point& q)
+                     { return compare_xy(p.first, q.first) == SMALLER; });
+
+  end_indices.resize(ends.size());
+  std::size_t index = 0;
+  for (std::size_t k = 0; k < ends.size(); ++k) {
+    if ((k > 0) && (compare_xy(ends[k - 1].first, ends[k].first) != EQUAL))
+      ++index;
+    end_indices[ends[k].second] = index;
+  }
+  return true;
+}
+
+// The slabs may not cut a surface, or unbounded curves.
+template <typename Ovl_gt2>
+bool split_overlay_curves(std::vector<typename Ovl_gt2::X_monotone_curve_2>&,
+                          const std::vector<typename Ovl_gt2::Point_2>&,
+                          const Ovl_gt2&,
+                          std::vector<std::size_t>&,
+                          Arr_not_all_sides_oblivious_tag)
+{ return false; }
+
+/*! An accessor for the indexed sweep of the curves split by
+ * split_overlay_curves(), which are given by a range that refers to the
+ * curves themselves.
+ */
+template <typename Curve>
+class Split_curves_accessor
+{
+  const std::vector<Curve>& curves;
+  const std::vector<std::size_t>& end_indices;
+
+public:
+
+  Split_curves_accessor (const std::vector<Curve>& curves,
+                         const std::vector<std::size_t>& end_indices)
+    : curves(curves), end_indices(end_indices) { }
+
+  std::size_t nb_vertices() const
+  {
+    return end_indices.size();
+  }
+
+  std::size_t min_end_index (const Curve& c) const
+  {
+    return end_indices[2 * (&c - curves.data())];
+  }
+
+  std::size_t max_end_index (const Curve& c) const
+  {
+    return end_indices[2 * (&c - curves.data()) + 1];
+  }
+
+  const Curve& curve (const Curve& c) const
+  {
+    return c;
+  }
+
+  void before_init() const { }
+
+  void after_init() const { }
+};
+
+} // namespace internal
+#endif
+
 template <typename Arr1, typename Arr2, typename Curve>
 class Indexed_sweep_accessor
 {
@@ -141,8 +300,15 @@ private:
  *               The overlay-traits class defines the various
  *               overlay operations of pairs of DCEL features from
  *               TopologyTraitsA and TopologyTraitsB to the resulting ResDcel.
+ * \tparam ConcurrencyTag If `Parallel_tag`, the intersections of the curves
+ *               are computed by sweeping vertical slabs concurrently. The
+ *               curves are then split at these intersections, and the
+ *               resulting arrangement is constructed by a sweep that need
+ *               not compute intersections. This sweep is sequential, so the
+ *               sequential overlay is used with fewer than 4 threads.
  */
-template <typename GeometryTraitsA_2,
+template <typename ConcurrencyTag = Sequential_tag,
+          typename GeometryTraitsA_2,
           typename GeometryTraitsB_2,
           typename GeometryTraitsRes_2,
           typename TopologyTraitsA,
@@ -155,6 +321,11 @@ overlay(const Arrangement_on_surface_2<GeometryTraitsA_2, TopologyTraitsA>& arr1
         Arrangement_on_surface_2<GeometryTraitsRes_2, TopologyTraitsRes>& arr,
         OverlayTraits& ovl_tr)
 {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
   typedef GeometryTraitsA_2                                     Agt2;
   typedef GeometryTraitsB_2                                     Bgt2;
   typedef GeometryTraitsRes_2                                   Rgt2;
@@ -252,13 +423,79 @@ overlay(const Arrangement_on_surface_2<GeometryTraitsA_2, TopologyTraitsA>& arr1
     ex_traits(*traits_adaptor);
 
   Ovl_visitor visitor(&arr1, &arr2, &arr, &ovl_tr);
-  Ss2::Surface_sweep_2<Ovl_visitor> surface_sweep(&ex_traits, &visitor);
 
-  // In case both arrangement do not contain isolated vertices, go on and
-  // overlay them.
+  // Prepare a vector of extended points that represent all isolated vertices
+  // in both input arrangements.
   const std::size_t total_iso_verts =
     arr1.number_of_isolated_vertices() + arr2.number_of_isolated_vertices();
+  std::vector<Ovl_point_2> pts_vec(total_iso_verts);
+
+  i = 0;
+  if (total_iso_verts != 0) {
+    typename Arr_a::Vertex_const_iterator  vit1;
+    for (vit1 = arr1.vertices_begin(); vit1 != arr1.vertices_end(); ++vit1) {
+      if (vit1->is_isolated()) {
+        typename Arr_a::Vertex_const_handle v1 = vit1;
+        pts_vec[i++] =
+          Ovl_point_2(vit1->point(), std::make_optional(Cell_handle_red(v1)),
+                      std::optional<Cell_handle_blue>());
+      }
+    }
+
+    typename Arr_b::Vertex_const_iterator  vit2;
+    for (vit2 = arr2.vertices_begin(); vit2 != arr2.vertices_end(); ++vit2) {
+      if (vit2->is_isolated()) {
+        typename Arr_b::Vertex_const_handle v2 = vit2;
+        pts_vec[i++] =
+          Ovl_point_2(vit2->point(), std::optional<Cell_handle_red>(),
+                      std::make_optional(Cell_handle_blue(v2)));
+      }
+    }
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+    typedef typename Arr_all_sides_oblivious_category<
+      typename Gt_adaptor_2::Left_side_category,
+      typename Gt_adaptor_2::Bottom_side_category,
+      typename Gt_adaptor_2::Top_side_category,
+      typename Gt_adaptor_2::Right_side_category>::result
+                                                        All_sides_oblivious_category;
+
+    // Once split, the curves intersect only at their endpoints, so the
+    // resulting arrangement is constructed by one global sweep that computes
+    // no intersections. This sweep remains sequential, so only the
+    // computation of the intersections is sped up.
+    // Constructing the DCEL per slab and merging the slab DCELs along the
+    // slab bounds would remove this sequential sweep, but the merge requires
+    // to match the faces and the holes cut by the slab bounds for every
+    // topology traits, and to replay the overlay-traits calls of the merged
+    // features; this is not done.
+    // With a single thread, the slabs would only add work.
+    std::vector<std::size_t> end_indices;
+    if ((tbb::this_task_arena::max_concurrency() > 1) &&
+        internal::split_overlay_curves(xcvs_vec, pts_vec, ex_traits,
+                                       end_indices,
+                                       All_sides_oblivious_category())) {
+      arr.clear();
+      Ss2::No_intersection_surface_sweep_2<Ovl_visitor>
+        surface_sweep(&ex_traits, &visitor);
+      surface_sweep.indexed_sweep (xcvs_vec,
+                                   internal::Split_curves_accessor
+                                   <Ovl_x_monotone_curve_2>
+                                   (xcvs_vec, end_indices),
+                                   pts_vec.begin(), pts_vec.end());
+      xcvs_vec.clear();
+      pts_vec.clear();
+      return;
+    }
+  }
+#endif
+
+  Ss2::Surface_sweep_2<Ovl_visitor> surface_sweep(&ex_traits, &visitor);
 
+  // In case both arrangement do not contain isolated vertices, go on and
+  // overlay them.
   if (total_iso_verts == 0) {
     // Clear the result arrangement and perform the sweep to construct it.
     arr.clear();
@@ -274,31 +511,6 @@ overlay(const Arrangement_on_surface_2<GeometryTraitsA_2, TopologyTraitsA>& arr1
     return;
   }
 
-  // Prepare a vector of extended points that represent all isolated vertices
-  // in both input arrangements.
-  std::vector<Ovl_point_2> pts_vec(total_iso_verts);
-
-  i = 0;
-  typename Arr_a::Vertex_const_iterator  vit1;
-  for (vit1 = arr1.vertices_begin(); vit1 != arr1.vertices_end(); ++vit1) {
-    if (vit1->is_isolated()) {
-      typename Arr_a::Vertex_const_handle v1 = vit1;
-      pts_vec[i++] =
-        Ovl_point_2(vit1->point(), std::make_optional(Cell_handle_red(v1)),
-                    std::optional<Cell_handle_blue>());
-    }
-  }
-
-  typename Arr_b::Vertex_const_iterator  vit2;
-  for (vit2 = arr2.vertices_begin(); vit2 != arr2.vertices_end(); ++vit2) {
-    if (vit2->is_isolated()) {
-      typename Arr_b::Vertex_const_handle v2 = vit2;
-      pts_vec[i++] =
-        Ovl_point_2(vit2->point(), std::optional<Cell_handle_red>(),
-                    std::make_optional(Cell_handle_blue(v2)));
-    }
-  }
-
   // Clear the result arrangement and perform the sweep to construct it.
   arr.clear();
   if (std::is_same<typename Agt2::Bottom_side_category,
@@ -320,7 +532,8 @@ overlay(const Arrangement_on_surface_2<GeometryTraitsA_2, TopologyTraitsA>& arr1
  * \param[in] arr2 the second arrangement.
  * \param[out] arr the resulting arrangement.
  */
-template <typename GeometryTraitsA_2,
+template <typename ConcurrencyTag = Sequential_tag,
+          typename GeometryTraitsA_2,
           typename GeometryTraitsB_2,
           typename GeometryTraitsRes_2,
           typename TopologyTraitsA,
@@ -342,7 +555,7 @@ overlay(const Arrangement_on_surface_2<GeometryTraitsA_2, TopologyTraitsA>& arr1
   typedef Arrangement_on_surface_2<Rgt2, Rtt>                   Arr_res;
 
   _Arr_default_overlay_traits_base<Arr_a, Arr_b, Arr_res> ovl_traits;
-  overlay(arr1, arr2, arr, ovl_traits);
+  overlay<ConcurrencyTag>(arr1, arr2, arr, ovl_traits);
 }
 
 } // namespace CGAL
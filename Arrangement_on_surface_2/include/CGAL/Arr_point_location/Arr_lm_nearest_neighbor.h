@@ -173,6 +173,9 @@ public:
 
     if (begin != end) {
       m_tree = new Tree(begin, end);
+      // Build the tree right away, such that the (const) queries do not
+      // modify it and can be issued concurrently.
+      m_tree->build();
       m_is_empty = false;
     }
     else {
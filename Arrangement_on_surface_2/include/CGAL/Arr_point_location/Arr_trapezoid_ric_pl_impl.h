@@ -34,9 +34,9 @@ namespace CGAL {
 //-----------------------------------------------------------------------------
 // Locate the arrangement feature containing the given point.
 //
-template <class Arrangement_2>
-typename Arr_trapezoid_ric_point_location<Arrangement_2>::result_type
-Arr_trapezoid_ric_point_location<Arrangement_2>::locate(const Point_2& p) const
+template <class Arrangement_2, class ConcurrencyTag>
+typename Arr_trapezoid_ric_point_location<Arrangement_2, ConcurrencyTag>::result_type
+Arr_trapezoid_ric_point_location<Arrangement_2, ConcurrencyTag>::locate(const Point_2& p) const
 {
   CGAL_TRAP_PRINT_DEBUG("locate point "<<p);
 
@@ -140,9 +140,9 @@ Arr_trapezoid_ric_point_location<Arrangement_2>::locate(const Point_2& p) const
 
 /*! gets the unbounded face that contains the point when the trapezoid is unbounded
    */
-template <class Arrangement>
-typename Arr_trapezoid_ric_point_location<Arrangement>::Face_const_handle
-Arr_trapezoid_ric_point_location<Arrangement>::
+template <class Arrangement, class ConcurrencyTag>
+typename Arr_trapezoid_ric_point_location<Arrangement, ConcurrencyTag>::Face_const_handle
+Arr_trapezoid_ric_point_location<Arrangement, ConcurrencyTag>::
 _get_unbounded_face(const Td_map_item& /* item */, const Point_2& /* p */,
                     Arr_all_sides_oblivious_tag) const
 {
@@ -154,9 +154,9 @@ _get_unbounded_face(const Td_map_item& /* item */, const Point_2& /* p */,
 /*! gets the unbounded face that contains the point when the trapezoid
  * is unbounded
  */
-template <class Arrangement>
-typename Arr_trapezoid_ric_point_location<Arrangement>::Face_const_handle
-Arr_trapezoid_ric_point_location<Arrangement>::
+template <class Arrangement, class ConcurrencyTag>
+typename Arr_trapezoid_ric_point_location<Arrangement, ConcurrencyTag>::Face_const_handle
+Arr_trapezoid_ric_point_location<Arrangement, ConcurrencyTag>::
 _get_unbounded_face(const Td_map_item& item,const Point_2& p,
                     Arr_not_all_sides_oblivious_tag) const
 {
@@ -248,9 +248,9 @@ _get_unbounded_face(const Td_map_item& item,const Point_2& p,
 // Locate the arrangement feature which a vertical ray emanating from the
 // given point hits, considering isolated vertices.
 //
-template <class Arrangement>
-typename Arr_trapezoid_ric_point_location<Arrangement>::result_type
-Arr_trapezoid_ric_point_location<Arrangement>::
+template <class Arrangement, class ConcurrencyTag>
+typename Arr_trapezoid_ric_point_location<Arrangement, ConcurrencyTag>::result_type
+Arr_trapezoid_ric_point_location<Arrangement, ConcurrencyTag>::
 _vertical_ray_shoot(const Point_2& p, bool shoot_up) const
 {
   //trying to workaround internal compiler error
@@ -316,9 +316,9 @@ _vertical_ray_shoot(const Point_2& p, bool shoot_up) const
 // face) we check the isolated vertices inside the face to check whether there
 // is an isolated vertex right above/below the query point.
 //
-template <typename Arrangement>
-typename Arr_trapezoid_ric_point_location<Arrangement>::result_type
-Arr_trapezoid_ric_point_location<Arrangement>::
+template <typename Arrangement, typename ConcurrencyTag>
+typename Arr_trapezoid_ric_point_location<Arrangement, ConcurrencyTag>::result_type
+Arr_trapezoid_ric_point_location<Arrangement, ConcurrencyTag>::
 _check_isolated_for_vertical_ray_shoot (Halfedge_const_handle halfedge_found,
                                         const Point_2& p,
                                         bool shoot_up,
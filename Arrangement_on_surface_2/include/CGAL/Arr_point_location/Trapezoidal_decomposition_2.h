@@ -24,6 +24,7 @@
 #include <CGAL/algorithm.h>
 #include <CGAL/Arr_point_location/Td_predicates.h>
 #include <CGAL/Arr_point_location/Trapezoidal_decomposition_2_misc.h>
+#include <CGAL/Real_timer.h>
 
 #include <optional>
 #include <variant>
@@ -38,6 +39,11 @@
 #include <vector>
 #include <map>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 namespace CGAL {
 
 namespace internal{
@@ -1377,6 +1383,82 @@ protected:
 
   bool is_last_edge(Halfedge_const_handle he, Td_map_item& vtx_item);
 
+  Td_map_item insert(Halfedge_const_handle he,
+                     Dag_node* min_node, Dag_node* max_node);
+
+  //---------------------------------------------------------------------------
+  // Description:
+  //  inserts the (already shuffled) range of halfedges into the search
+  //  structure, and returns false as soon as the structure exceeds its limits
+  //  (if check_limits is set), in which case the insertion is interrupted.
+  //  With parallel_build set, the halfedges are inserted in rounds: the
+  //  endpoints of the halfedges of a round are located concurrently in the
+  //  Dag of the previous rounds, which every round at least doubles. As the
+  //  Dag is only refined by insertions, each halfedge of the round is then
+  //  inserted by resuming these searches, which are expected to be short.
+  template <class Halfedge_iterator>
+  bool insert_range(Halfedge_iterator begin, Halfedge_iterator end,
+                    bool check_limits)
+  {
+    std::size_t n = static_cast<std::size_t>(end - begin);
+    std::size_t i = 0;
+
+#ifdef CGAL_LINKED_WITH_TBB
+    //minimal number of halfedges per round, as well as the number of halfedges
+    // inserted sequentially before the first round
+    const std::size_t min_round_size = 1024;
+
+    if (m_parallel_build && n >= 2 * min_round_size)
+    {
+      for (; i < min_round_size; ++i)
+      {
+        if (check_limits && not_within_limits())
+          return false;
+        insert(Halfedge_const_handle(begin[i]));
+      }
+
+      std::vector<Dag_node> min_nodes, max_nodes;
+      while (i < n)
+      {
+        const std::size_t round_end = (std::min)(n, 2 * i);
+        min_nodes.assign(round_end - i, *m_dag_root);
+        max_nodes.assign(round_end - i, *m_dag_root);
+
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(i, round_end),
+                          [&](const tbb::blocked_range<std::size_t>& r)
+        {
+          for (std::size_t j = r.begin(); j != r.end(); ++j)
+          {
+            Halfedge_const_handle he = begin[j];
+            search_using_dag(min_nodes[j - i], traits,
+                             Curve_end(he, ARR_MIN_END), m_empty_he_handle);
+            search_using_dag(max_nodes[j - i], traits,
+                             Curve_end(he, ARR_MAX_END), m_empty_he_handle);
+          }
+        });
+
+        for (std::size_t j = i; j < round_end; ++j)
+        {
+          if (check_limits && not_within_limits())
+            return false;
+          insert(Halfedge_const_handle(begin[j]),
+                 &min_nodes[j - i], &max_nodes[j - i]);
+        }
+        i = round_end;
+      }
+      return true;
+    }
+#endif
+
+    for (; i < n; ++i)
+    {
+      if (check_limits && not_within_limits())
+        return false;
+      insert(Halfedge_const_handle(begin[i]));
+    }
+    return true;
+  }
+
   /*==============================================
     Trapezoidal_decomposition_2 public member functions
     ==============================================*/
@@ -1389,7 +1471,12 @@ public:
     traits(0),
     m_arr(0),
     m_depth_threshold(CGAL_TD_DEFAULT_DEPTH_THRESHOLD),
-    m_size_threshold(CGAL_TD_DEFAULT_SIZE_THRESHOLD)
+    m_size_threshold(CGAL_TD_DEFAULT_SIZE_THRESHOLD),
+    m_read_only_queries(false),
+    m_parallel_build(false),
+    m_number_of_rebuilds(0),
+    m_last_rebuild_time(0),
+    m_total_rebuild_time(0)
   {
     init();
     set_with_guarantees(with_guarantees);
@@ -1403,7 +1490,12 @@ public:
     traits(0),
     m_arr(0),
     m_depth_threshold(depth_th),
-    m_size_threshold(size_th)
+    m_size_threshold(size_th),
+    m_read_only_queries(false),
+    m_parallel_build(false),
+    m_number_of_rebuilds(0),
+    m_last_rebuild_time(0),
+    m_total_rebuild_time(0)
   {
     init();
     set_with_guarantees(with_guarantees);
@@ -1503,7 +1595,10 @@ public:
   //  Given an edge-degenerate trapezoid representing a Halfedge,
   //  all the other trapezoids representing the Halfedge can be extracted
   //  via moving continuously to the left and right neighbors.
-  Td_map_item insert(Halfedge_const_handle he);
+  Td_map_item insert(Halfedge_const_handle he)
+  {
+    return insert(he, nullptr, nullptr);
+  }
 
 
   //---------------------------------------------------------------------------
@@ -1535,30 +1630,14 @@ public:
       //random_shuffle the range
       CGAL::cpp98::random_shuffle(begin,end);
 
-      Halfedge_const_handle he_cst;
-      Halfedge_iterator it = begin;
-      for (; it < end ; ++it)
-      {
-        if (do_rebuild && not_within_limits())
-        {
-#ifdef CGAL_TD_DEBUG
-          std::cout << "starting over after " << number_of_curves() << std::flush;
-#endif
-          start_over = true;
-          clear();
-          break;
-        }
-
-        he_cst = *it;
-        insert(he_cst);
-      }
-      if (it != end)
-        continue;
-
       //after inserting the last halfedge in the range
       //  perform another rebuild check
-      if (do_rebuild && not_within_limits()) //MICHAL: should I use needs_update() instead (with the random check)?
+      if (!insert_range(begin, end, do_rebuild) ||
+          (do_rebuild && not_within_limits())) //MICHAL: should I use needs_update() instead (with the random check)?
       {
+#ifdef CGAL_TD_DEBUG
+        std::cout << "starting over after " << number_of_curves() << std::flush;
+#endif
         start_over = true;
         clear();
       }
@@ -1865,6 +1944,8 @@ public:
     std::cout << "\nrebuild!  " << m_number_of_curves << std::endl
               << std::flush;
 #endif
+    Real_timer timer;
+    timer.start();
 
     Halfedge_container container;
 #ifdef CGAL_TD_DEBUG
@@ -1902,9 +1983,27 @@ public:
 #endif
 
     container.clear();
+
+    timer.stop();
+    ++m_number_of_rebuilds;
+    m_last_rebuild_time = timer.time();
+    m_total_rebuild_time += m_last_rebuild_time;
+#ifdef CGAL_TD_REBUILD_DEBUG
+    std::cout << "\nrebuild of " << m_number_of_curves << " curves took "
+              << m_last_rebuild_time << " sec." << std::endl;
+#endif
     return *this;
   }
 
+  /* returns the number of times the search structure was rebuilt, since
+     its construction */
+  unsigned long number_of_rebuilds() const { return m_number_of_rebuilds; }
+
+  /* returns the duration (in seconds) of the last rebuild, and of all the
+     rebuilds */
+  double last_rebuild_time() const { return m_last_rebuild_time; }
+  double total_rebuild_time() const { return m_total_rebuild_time; }
+
   /*
      Input:
      a list of pointers to Td_map_items and a Td_map_item boolean predicate.
@@ -2003,6 +2102,37 @@ public:
     return old;
   }
 
+  /*
+    Description:
+    determines whether the queries (locate() and vertical_ray_shoot()) leave
+    the structure untouched. By default, the last located items are kept as
+    hints for the next update; when the queries are read-only, they can be
+    issued concurrently, as long as the structure is not updated.
+  */
+  bool set_read_only_queries(bool u)
+  {
+    bool old = m_read_only_queries;
+    m_read_only_queries = u;
+    return old;
+  }
+
+  bool read_only_queries() const { return m_read_only_queries; }
+
+  /*
+    Description:
+    determines whether the (re)constructions of the structure from a range
+    of halfedges locate their endpoints concurrently. This has no effect if
+    TBB is not available.
+  */
+  bool set_parallel_build(bool u)
+  {
+    bool old = m_parallel_build;
+    m_parallel_build = u;
+    return old;
+  }
+
+  bool parallel_build() const { return m_parallel_build; }
+
   //This method occasionally(!) checks the guarantees
   // It is currently not in use, since the guarantees are constantly checked in O(1) time
   bool needs_update()
@@ -2169,6 +2299,8 @@ private:
 
   void locate_opt_push(Td_map_item& cv_tr) const
   {
+    // concurrent queries must not write the shared hints
+    if (m_read_only_queries) return;
     prev_cv = last_cv;
     last_cv = cv_tr;
   }
@@ -2408,6 +2540,11 @@ public:
 protected:
   double m_depth_threshold;
   double m_size_threshold;
+  bool m_read_only_queries; //whether the queries may be issued concurrently
+  bool m_parallel_build; //whether the endpoints are located concurrently in bulk insertions
+  unsigned long m_number_of_rebuilds; //statistics on the rebuilds
+  double m_last_rebuild_time;
+  double m_total_rebuild_time;
 };
 
 } //namespace CGAL
@@ -1444,9 +1444,14 @@ is_last_edge(Halfedge_const_handle /* he */ , Td_map_item& vtx_item)
 //  Given an edge-degenerate trapezoid representing a Halfedge,
 //  all the other trapezoids representing the Halfedge can be extracted
 //  via moving continuously to the left and right neighbors.
+//  If min_node (resp. max_node) is not null, the search for the left (resp.
+//  right) endpoint of the Halfedge resumes from this node, which was reached
+//  by a search of the same endpoint in an earlier state of the Dag.
 template <typename Td_traits>
 typename Trapezoidal_decomposition_2<Td_traits>::Td_map_item
-Trapezoidal_decomposition_2<Td_traits>::insert(Halfedge_const_handle he)
+Trapezoidal_decomposition_2<Td_traits>::insert(Halfedge_const_handle he,
+                                               Dag_node* min_node,
+                                               Dag_node* max_node)
 {
   //print_cv_data(he->curve());
   if (m_with_guarantees) update();
@@ -1471,12 +1476,19 @@ Trapezoidal_decomposition_2<Td_traits>::insert(Halfedge_const_handle he)
   Locate_type lt1;
   Td_map_item item1;
 
+  if (min_node != nullptr) {
+    //the Dag was only refined since min_node was reached
+    lt1 = search_using_dag(*min_node, traits, ce1, m_empty_he_handle);
+    item1 = min_node->get_data();
+  }
+  else {
 #ifndef CGAL_NO_TRAPEZOIDAL_DECOMPOSITION_2_OPTIMIZATION
-  locate_optimization(ce1, item1, lt1);
+    locate_optimization(ce1, item1, lt1);
 #else
-  //location of the left endpoint of the edge we're inserting
-  item1 = locate(ce1, lt1);
+    //location of the left endpoint of the edge we're inserting
+    item1 = locate(ce1, lt1);
 #endif
+  }
 
   //the inserted edge should not cut any existing edge
   if (lt1 == CURVE) {
@@ -1497,14 +1509,23 @@ Trapezoidal_decomposition_2<Td_traits>::insert(Halfedge_const_handle he)
   Locate_type lt2;
   Td_map_item item2;
 
+  if (max_node != nullptr) {
+    lt2 = search_using_dag(*max_node, traits, ce2, m_empty_he_handle);
+    item2 = max_node->get_data();
 #ifndef CGAL_NO_TRAPEZOIDAL_DECOMPOSITION_2_OPTIMIZATION
-  locate_optimization(ce2, item2, lt2);
-  locate_opt_empty();
+    locate_opt_empty();
+#endif
+  }
+  else {
+#ifndef CGAL_NO_TRAPEZOIDAL_DECOMPOSITION_2_OPTIMIZATION
+    locate_optimization(ce2, item2, lt2);
+    locate_opt_empty();
 #else
-  // TODO(oren): locating the second endpoint. this is not necessary,
-  // and time consuming.
-  item2 = locate(ce2, lt2);
+    // TODO(oren): locating the second endpoint. this is not necessary,
+    // and time consuming.
+    item2 = locate(ce2, lt2);
 #endif
+  }
 
   if (lt2 == CURVE) {
     CGAL_precondition_msg(lt2 != CURVE, "Input is not planar as\
@@ -27,6 +27,9 @@
 #include <CGAL/Arr_point_location/Trapezoidal_decomposition_2.h>
 #include <CGAL/Arr_point_location/Td_traits.h>
 #include <CGAL/Arr_observer.h>
+#include <CGAL/tags.h>
+
+#include <type_traits>
 
 namespace CGAL {
 
@@ -34,9 +37,17 @@ namespace CGAL {
  * A class that answers point-location and queries
  * on a planar arrangement using the trapezoid_ric algorithm.
  * The Arrangement parameter corresponds to an arrangement instantiation.
+ * If the ConcurrencyTag parameter is Parallel_tag, the constructions of the
+ * search structure from all the arrangement edges locate their endpoints
+ * concurrently.
  */
-template <typename Arrangement_>
+template <typename Arrangement_, typename ConcurrencyTag = Sequential_tag>
 class Arr_trapezoid_ric_point_location : public Arr_observer <Arrangement_> {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
 public:
   //type of arrangement on surface
   typedef Arrangement_                          Arrangement_on_surface_2;
@@ -121,6 +132,11 @@ protected:
   const Traits_adaptor_2* m_traits; // Its associated traits object.
   TD  td;                           // instance of trapezoidal decomposition
   bool m_with_guarantees;
+  //for the global changes
+  bool m_in_global_change;
+  bool m_ignore_notifications;
+  unsigned long m_global_change_curves;
+  unsigned long m_global_change_new_curves;
   //for the notification functions
   X_monotone_curve_2  m_cv_before_split;
   Halfedge_handle     m_he_after_merge;
@@ -136,9 +152,13 @@ public:
   Arr_trapezoid_ric_point_location(bool with_guarantees = true,
                                    double depth_thrs = CGAL_TD_DEFAULT_DEPTH_THRESHOLD,
                                    double size_thrs = CGAL_TD_DEFAULT_SIZE_THRESHOLD) :
-    m_traits(nullptr), m_with_guarantees(with_guarantees)
+    m_traits(nullptr), m_with_guarantees(with_guarantees),
+    m_in_global_change(false), m_ignore_notifications(false),
+    m_global_change_curves(0), m_global_change_new_curves(0)
   {
     td.set_with_guarantees(with_guarantees);
+    td.set_parallel_build(std::is_convertible<ConcurrencyTag,
+                                              Parallel_tag>::value);
     td.depth_threshold(depth_thrs);
     td.size_threshold(size_thrs);
   }
@@ -150,10 +170,14 @@ public:
                            double size_thrs = CGAL_TD_DEFAULT_SIZE_THRESHOLD) :
     Arr_observer<Arrangement_on_surface_2>
               (const_cast<Arrangement_on_surface_2 &>(arr)),
-    m_with_guarantees(with_guarantees)
+    m_with_guarantees(with_guarantees),
+    m_in_global_change(false), m_ignore_notifications(false),
+    m_global_change_curves(0), m_global_change_new_curves(0)
   {
     m_traits = static_cast<const Traits_adaptor_2*> (arr.geometry_traits());
     td.set_with_guarantees(with_guarantees);
+    td.set_parallel_build(std::is_convertible<ConcurrencyTag,
+                                              Parallel_tag>::value);
     td.init_arrangement_and_traits(&arr);
     td.depth_threshold(depth_thrs);
     td.size_threshold(size_thrs);
@@ -178,6 +202,14 @@ public:
     m_with_guarantees = with_guarantees;
   }
 
+  /*! defines whether the queries leave the underlying search structure
+   *   untouched, such that they can be issued concurrently (as long as the
+   *   arrangement is not modified) */
+  void read_only_queries (bool read_only)
+  {
+    td.set_read_only_queries(read_only);
+  }
+
   /*! returns the depth of the underlying search structure
    *    (the longest path in the DAG)
    */
@@ -186,6 +218,21 @@ public:
     return td.largest_leaf_depth() + 1;
   }
 
+  /*! returns the number of times the underlying search structure was
+   *    rebuilt, in order to keep its guarantees
+   */
+  unsigned long number_of_rebuilds() const { return td.number_of_rebuilds(); }
+
+  /*! returns the duration (in seconds) of the last rebuild of the underlying
+   *    search structure
+   */
+  double last_rebuild_time() const { return td.last_rebuild_time(); }
+
+  /*! returns the total duration (in seconds) of the rebuilds of the
+   *    underlying search structure
+   */
+  double total_rebuild_time() const { return td.total_rebuild_time(); }
+
   /*! returns the longest query path in the underlying search structure */
   unsigned long longest_query_path_length()
   {
@@ -278,8 +325,38 @@ public:
     td.clear();
   }
 
+  /*! Notification before a global operation modifies the arrangement.
+   * The guarantees of the search structure are only checked at the end of
+   * the operation. If the operation adds more curves than the search
+   * structure has, these curves (inserted in an order that is usually not
+   * random) make up most of the final structure, and it is cheaper to
+   * construct the search structure from scratch at the end of the operation.
+   */
+  virtual void before_global_change ()
+  {
+    m_in_global_change = true;
+    m_global_change_curves = td.number_of_curves();
+    m_global_change_new_curves = 0;
+    td.set_with_guarantees(false);
+  }
+
+  /*! Notification after a global operation is completed. */
+  virtual void after_global_change ()
+  {
+    m_in_global_change = false;
+    td.set_with_guarantees(m_with_guarantees);
+    if (m_ignore_notifications)
+    {
+      m_ignore_notifications = false;
+      _construct_td();
+    }
+    else if (m_with_guarantees)
+      td.update();
+  }
+
   virtual void after_create_edge (Halfedge_handle e)
   {
+    if (! _update_td(1)) return;
     td.insert(e);
   }
 
@@ -293,6 +370,7 @@ public:
                                   const X_monotone_curve_2&  /* cv1 */ ,
                                   const X_monotone_curve_2&  /* cv2 */ )
   {
+    if (! _update_td()) return;
 
     ////MICHAL: commented due to inefficient depth update, remove and insert instead
     ////save the curve for the "after" function.
@@ -305,6 +383,7 @@ public:
   virtual void after_split_edge (Halfedge_handle e1,
                                  Halfedge_handle e2)
   {
+    if (! _update_td(1)) return;
     //MICHAL: commented due to inefficient depth update, remove and insert instead
     //td.split_edge(m_cv_before_split,e1,e2);
 
@@ -316,6 +395,7 @@ public:
                                   Halfedge_handle e2,
                                   const X_monotone_curve_2& cv)
   {
+    if (! _update_td()) return;
     //save the halfedge handle for the "after" function.
     m_he_after_merge = e1;
     td.merge_edge (e1, e2, cv);
@@ -323,11 +403,13 @@ public:
 
   virtual void after_merge_edge (Halfedge_handle e)
   {
+    if (! _update_td()) return;
     td.after_merge_edge(e, m_he_after_merge);
   }
 
   virtual void before_remove_edge (Halfedge_handle e)
   {
+    if (! _update_td()) return;
     //called before combinatoric deletion
     td.remove(e);
   }
@@ -344,6 +426,24 @@ public:
 
 protected:
 
+  /*! Records an update of the search structure, which adds the given number
+   * of curves, and returns whether it should be performed. During a global
+   * operation that adds too many curves, the search structure is cleared and
+   * the updates are ignored, until the end of the operation.
+   */
+  bool _update_td (unsigned long nb_new_curves = 0)
+  {
+    if (m_ignore_notifications) return false;
+    if (m_in_global_change &&
+        (m_global_change_new_curves += nb_new_curves) > m_global_change_curves)
+    {
+      td.clear();
+      m_ignore_notifications = true;
+      return false;
+    }
+    return true;
+  }
+
   /*! Construct the trapezoidal decomposition. */
   void _construct_td ()
   {
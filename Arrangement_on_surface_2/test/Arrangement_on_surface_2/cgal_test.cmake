@@ -1367,6 +1367,21 @@ test_batched_point_location_segments()
 test_batched_point_location_linear()
 test_batched_point_location_spherical_arcs()
 
+compile_and_run(test_parallel_point_location)
+find_package(TBB QUIET)
+include(CGAL_TBB_support)
+if(TARGET CGAL::TBB_support)
+  target_link_libraries(test_parallel_point_location CGAL::TBB_support)
+endif()
+compile_and_run(test_trapezoid_ric_construction)
+if(TARGET CGAL::TBB_support)
+  target_link_libraries(test_trapezoid_ric_construction CGAL::TBB_support)
+endif()
+compile_and_run(test_parallel_overlay)
+if(TARGET CGAL::TBB_support)
+  target_link_libraries(test_parallel_overlay CGAL::TBB_support)
+endif()
+
 test_vertical_decomposition_segments()
 test_vertical_decomposition_linear()
 # test_vertical_decomposition_spherical_arcs
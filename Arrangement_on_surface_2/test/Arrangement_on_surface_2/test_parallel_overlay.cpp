@@ -0,0 +1,210 @@
+#include <CGAL/config.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Arr_extended_dcel.h>
+#include <CGAL/Arrangement_2.h>
+#include <CGAL/Arr_overlay_2.h>
+#include <CGAL/Arr_default_overlay_traits.h>
+#include <CGAL/Random.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+#endif
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel     Kernel;
+typedef CGAL::Arr_segment_traits_2<Kernel>                    Traits;
+typedef Traits::Point_2                                       Point_2;
+typedef Traits::Segment_2                                     Segment_2;
+typedef CGAL::Arr_extended_dcel<Traits, int, int, int>        Dcel;
+typedef CGAL::Arrangement_2<Traits, Dcel>                     Arrangement;
+typedef CGAL::Arr_default_overlay_traits<Arrangement>         Default_overlay_traits;
+typedef CGAL::Arr_face_overlay_traits<Arrangement, Arrangement, Arrangement,
+                                      std::plus<int> >        Face_overlay_traits;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+// Sets the data of all the features of the given arrangement.
+void set_data(Arrangement& arr, int data)
+{
+  for (Arrangement::Vertex_iterator vit = arr.vertices_begin(); vit != arr.vertices_end(); ++vit)
+    vit->set_data(data);
+  for (Arrangement::Halfedge_iterator hit = arr.halfedges_begin(); hit != arr.halfedges_end(); ++hit)
+    hit->set_data(data);
+  for (Arrangement::Face_iterator fit = arr.faces_begin(); fit != arr.faces_end(); ++fit)
+    fit->set_data(data);
+}
+
+// A grid of n x n cells, whose lines are shifted by the given offset, with
+// random short segments and isolated vertices.
+void construct_arrangement(Arrangement& arr, CGAL::Random& rnd, int n,
+                           int offset, int data)
+{
+  std::list<Segment_2> segments;
+  for (int i = 0; i <= n; ++i) {
+    segments.push_back(Segment_2(Point_2(10 * i + offset, 0), Point_2(10 * i + offset, 10 * n)));
+    segments.push_back(Segment_2(Point_2(0, 10 * i), Point_2(10 * n, 10 * i)));
+  }
+  for (int i = 0; i < n * n / 4; ++i) {
+    const Point_2 p(rnd.get_int(0, 10 * n), rnd.get_int(0, 10 * n));
+    const Point_2 q(p.x() + rnd.get_int(-15, 15), p.y() + rnd.get_int(-15, 15));
+    if (p != q)
+      segments.push_back(Segment_2(p, q));
+  }
+  std::list<Point_2> points;
+  for (int i = 0; i < n; ++i)
+    points.push_back(Point_2(rnd.get_double(0, 10 * n), rnd.get_double(0, 10 * n)));
+
+  CGAL::insert(arr, segments.begin(), segments.end());
+  for (const Point_2& p : points)
+    CGAL::insert_point(arr, p);
+  set_data(arr, data);
+}
+
+// Adds to blue isolated vertices lying on vertices, on edges, and on isolated
+// vertices of red. The slab bounds are chosen among the left endpoints of the
+// curves, so some of them also lie on the vertical line of a slab bound.
+void add_degenerate_isolated_vertices(Arrangement& blue, const Arrangement& red,
+                                      int data)
+{
+  std::list<Point_2> points;
+  int k = 0;
+  for (Arrangement::Vertex_const_iterator vit = red.vertices_begin(); vit != red.vertices_end(); ++vit) {
+    if ((k++ % 7) != 0)
+      continue;
+    // on a vertex, or on an isolated vertex
+    points.push_back(vit->point());
+    // on the vertical line through the vertex
+    points.push_back(Point_2(vit->point().x(), vit->point().y() + Kernel::FT(1) / 4));
+  }
+  k = 0;
+  for (Arrangement::Edge_const_iterator eit = red.edges_begin(); eit != red.edges_end(); ++eit) {
+    // in the interior of an edge
+    if ((k++ % 7) == 0)
+      points.push_back(CGAL::midpoint(eit->source()->point(), eit->target()->point()));
+  }
+
+  for (const Point_2& p : points)
+    CGAL::insert_point(blue, p);
+  set_data(blue, data);
+}
+
+// Checks that both overlays have the same features, and, if the overlay
+// traits set it, the same face data.
+void check_same_overlays(const Arrangement& arr1, const Arrangement& arr2,
+                         bool check_data)
+{
+  std::cout << "  " << arr2.number_of_vertices() << " vertices, "
+            << arr2.number_of_edges() << " edges, "
+            << arr2.number_of_faces() << " faces" << std::endl;
+
+  assert(arr1.number_of_vertices() == arr2.number_of_vertices());
+  assert(arr1.number_of_isolated_vertices() == arr2.number_of_isolated_vertices());
+  assert(arr1.number_of_edges() == arr2.number_of_edges());
+  assert(arr1.number_of_faces() == arr2.number_of_faces());
+  assert(arr1.number_of_unbounded_faces() == arr2.number_of_unbounded_faces());
+  assert(arr2.is_valid());
+
+  std::vector<Point_2> points1, points2;
+  for (Arrangement::Vertex_const_iterator vit = arr1.vertices_begin(); vit != arr1.vertices_end(); ++vit)
+    points1.push_back(vit->point());
+  for (Arrangement::Vertex_const_iterator vit = arr2.vertices_begin(); vit != arr2.vertices_end(); ++vit)
+    points2.push_back(vit->point());
+  std::sort(points1.begin(), points1.end());
+  std::sort(points2.begin(), points2.end());
+  assert(points1 == points2);
+
+  if (! check_data)
+    return;
+
+  std::vector<int> data1, data2;
+  for (Arrangement::Face_const_iterator fit = arr1.faces_begin(); fit != arr1.faces_end(); ++fit)
+    data1.push_back(fit->data());
+  for (Arrangement::Face_const_iterator fit = arr2.faces_begin(); fit != arr2.faces_end(); ++fit)
+    data2.push_back(fit->data());
+  std::sort(data1.begin(), data1.end());
+  std::sort(data2.begin(), data2.end());
+  assert(data1 == data2);
+}
+
+template <typename OverlayTraits>
+void test_overlay(const Arrangement& red, const Arrangement& blue,
+                  bool check_data)
+{
+  OverlayTraits ovl_traits;
+  Arrangement seq_arr, par_arr;
+  CGAL::overlay(red, blue, seq_arr, ovl_traits);
+  CGAL::overlay<Concurrency_tag>(red, blue, par_arr, ovl_traits);
+  check_same_overlays(seq_arr, par_arr, check_data);
+}
+
+void test(CGAL::Random& rnd)
+{
+  std::cout << "== small arrangements" << std::endl;
+  Arrangement small_red, small_blue;
+  construct_arrangement(small_red, rnd, 5, 0, 1);
+  construct_arrangement(small_blue, rnd, 5, 5, 2);
+  test_overlay<Default_overlay_traits>(small_red, small_blue, false);
+  test_overlay<Face_overlay_traits>(small_red, small_blue, true);
+
+  // The horizontal lines of the grids overlap.
+  std::cout << "== large arrangements" << std::endl;
+  Arrangement red, blue;
+  construct_arrangement(red, rnd, 60, 0, 1);
+  construct_arrangement(blue, rnd, 60, 5, 2);
+  test_overlay<Default_overlay_traits>(red, blue, false);
+  test_overlay<Face_overlay_traits>(red, blue, true);
+
+  // The grids overlap completely.
+  std::cout << "== overlapping arrangements" << std::endl;
+  Arrangement blue2;
+  construct_arrangement(blue2, rnd, 60, 0, 2);
+  test_overlay<Face_overlay_traits>(red, blue2, true);
+
+  // Isolated vertices on the vertices, on the edges, and on the isolated
+  // vertices of the other arrangement, and on slab bounds.
+  std::cout << "== degenerate isolated vertices" << std::endl;
+  Arrangement blue3 = blue;
+  add_degenerate_isolated_vertices(blue3, red, 2);
+  test_overlay<Face_overlay_traits>(red, blue3, true);
+  Arrangement red3 = red;
+  add_degenerate_isolated_vertices(red3, blue, 1);
+  test_overlay<Face_overlay_traits>(red3, blue, true);
+
+  // The simple overlay.
+  std::cout << "== simple overlay" << std::endl;
+  Arrangement seq_arr, par_arr;
+  CGAL::overlay(red, blue, seq_arr);
+  CGAL::overlay<Concurrency_tag>(red, blue, par_arr);
+  check_same_overlays(seq_arr, par_arr, false);
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // overlay with several slabs and threads, whatever the number of cores
+  tbb::global_control c(tbb::global_control::max_allowed_parallelism, 4);
+  tbb::task_arena arena(4);
+  arena.execute([&]{ test(rnd); });
+#else
+  test(rnd);
+#endif
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,217 @@
+#include <CGAL/config.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Arr_linear_traits_2.h>
+#include <CGAL/Arrangement_2.h>
+#include <CGAL/Arr_batched_point_location.h>
+#include <CGAL/Arr_landmarks_point_location.h>
+#include <CGAL/Arr_trapezoid_ric_point_location.h>
+#include <CGAL/Random.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <utility>
+#include <variant>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel  Kernel;
+typedef Kernel::FT                                         FT;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+template <typename Arrangement>
+bool same_feature(const typename CGAL::Arr_point_location_result<Arrangement>::Type& r1,
+                  const typename CGAL::Arr_point_location_result<Arrangement>::Type& r2)
+{
+  typedef typename Arrangement::Halfedge_const_handle Halfedge_const_handle;
+
+  if(r1.index() != r2.index())
+    return false;
+  if(const Halfedge_const_handle* h1 = std::get_if<Halfedge_const_handle>(&r1))
+  {
+    const Halfedge_const_handle h2 = std::get<Halfedge_const_handle>(r2);
+    return (*h1 == h2) || (*h1 == h2->twin());
+  }
+  return r1 == r2;
+}
+
+// Locates the queries with the sequential and the parallel batched point
+// location, and checks that the results are the same, in the same order.
+template <typename Arrangement, typename Point_2>
+std::vector<std::pair<Point_2, typename CGAL::Arr_point_location_result<Arrangement>::Type> >
+test_batched_locate(const Arrangement& arr, const std::vector<Point_2>& queries)
+{
+  typedef typename CGAL::Arr_point_location_result<Arrangement>::Type  Result_type;
+  typedef std::pair<Point_2, Result_type>                              Query_result;
+
+  std::vector<Query_result> seq_results, par_results;
+  CGAL::locate(arr, queries.begin(), queries.end(), std::back_inserter(seq_results));
+  CGAL::locate<Concurrency_tag>(arr, queries.begin(), queries.end(), std::back_inserter(par_results));
+
+  std::cout << par_results.size() << " results ("
+            << seq_results.size() << " sequentially)" << std::endl;
+
+  assert(par_results.size() == seq_results.size());
+  for(std::size_t i=0; i<seq_results.size(); ++i)
+  {
+    assert(par_results[i].first == seq_results[i].first);
+    assert(same_feature<Arrangement>(par_results[i].second, seq_results[i].second));
+  }
+
+  return seq_results;
+}
+
+// Issues the queries concurrently with a read-only point location strategy.
+template <typename Arrangement, typename Point_location, typename Query_result>
+void test_concurrent_queries(const Point_location& pl, const std::vector<Query_result>& results)
+{
+  typedef typename CGAL::Arr_point_location_result<Arrangement>::Type  Result_type;
+
+  std::vector<Result_type> pl_results(results.size());
+#ifdef CGAL_LINKED_WITH_TBB
+  tbb::parallel_for(std::size_t(0), results.size(), [&](std::size_t i)
+  {
+    pl_results[i] = pl.locate(results[i].first);
+  });
+#else
+  for(std::size_t i=0; i<results.size(); ++i)
+    pl_results[i] = pl.locate(results[i].first);
+#endif
+
+  for(std::size_t i=0; i<results.size(); ++i)
+    assert(same_feature<Arrangement>(pl_results[i], results[i].second));
+}
+
+void test_segments(CGAL::Random& rnd)
+{
+  typedef CGAL::Arr_segment_traits_2<Kernel>                    Traits;
+  typedef Traits::Point_2                                       Point_2;
+  typedef Traits::Segment_2                                     Segment_2;
+  typedef CGAL::Arrangement_2<Traits>                           Arrangement;
+  typedef CGAL::Arr_landmarks_point_location<Arrangement>       Landmarks_pl;
+  typedef CGAL::Arr_trapezoid_ric_point_location<Arrangement>   Trapezoid_ric_pl;
+
+  std::cout << "== segments" << std::endl;
+
+  // a grid of square regions, with a few isolated vertices
+  const int n = 20;
+  std::list<Segment_2> segments;
+  for(int i=0; i<=n; ++i)
+  {
+    segments.push_back(Segment_2(Point_2(i, 0), Point_2(i, n)));
+    segments.push_back(Segment_2(Point_2(0, i), Point_2(n, i)));
+  }
+  for(int i=0; i<n; ++i)
+    segments.push_back(Segment_2(Point_2(i, i), Point_2(FT(i) + FT(1)/2, FT(i) + FT(1)/3)));
+
+  Arrangement arr;
+  CGAL::insert(arr, segments.begin(), segments.end());
+  for(int i=0; i<n; ++i)
+    CGAL::insert_point(arr, Point_2(FT(i) + FT(3)/4, FT(n - i) - FT(1)/4));
+
+  Landmarks_pl landmarks_pl(arr);
+  Trapezoid_ric_pl trapezoid_pl(arr);
+  trapezoid_pl.read_only_queries(true);
+
+  std::vector<Point_2> queries;
+  for(int i=0; i<5000; ++i)
+    queries.push_back(Point_2(rnd.get_double(-1, n + 1), rnd.get_double(-1, n + 1)));
+  // queries on vertices, on edges, on isolated vertices, and duplicates
+  for(Arrangement::Vertex_const_handle v : arr.vertex_handles())
+    queries.push_back(v->point());
+  for(int i=0; i<=n; ++i)
+    queries.push_back(Point_2(i, FT(i) / 7));
+  for(int i=0; i<500; ++i)
+    queries.push_back(queries[rnd.get_int(0, int(queries.size()))]);
+
+  auto results = test_batched_locate(arr, queries);
+  test_concurrent_queries<Arrangement>(landmarks_pl, results);
+  test_concurrent_queries<Arrangement>(trapezoid_pl, results);
+
+  // the structure can still be updated after read-only queries
+  CGAL::insert(arr, Segment_2(Point_2(-1, -1), Point_2(n + 1, n + 2)));
+  trapezoid_pl.read_only_queries(false);
+  results = test_batched_locate(arr, queries);
+  test_concurrent_queries<Arrangement>(landmarks_pl, results);
+  for(std::size_t i=0; i<results.size(); ++i)
+    assert(same_feature<Arrangement>(trapezoid_pl.locate(results[i].first), results[i].second));
+
+  // fewer queries than slabs
+  test_batched_locate(arr, std::vector<Point_2>(queries.begin(), queries.begin() + 3));
+  test_batched_locate(arr, std::vector<Point_2>());
+}
+
+void test_unbounded(CGAL::Random& rnd)
+{
+  typedef CGAL::Arr_linear_traits_2<Kernel>                     Traits;
+  typedef Traits::Point_2                                       Point_2;
+  typedef Traits::Line_2                                        Line_2;
+  typedef Traits::Ray_2                                         Ray_2;
+  typedef Traits::X_monotone_curve_2                            X_monotone_curve_2;
+  typedef CGAL::Arrangement_2<Traits>                           Arrangement;
+
+  std::cout << "== lines and rays" << std::endl;
+
+  std::list<X_monotone_curve_2> curves;
+  for(int i=0; i<30; ++i)
+  {
+    const Point_2 p(rnd.get_int(-20, 20), rnd.get_int(-20, 20));
+    const Point_2 q(rnd.get_int(-20, 20), rnd.get_int(-20, 20));
+    if(p == q)
+      continue;
+    if(i % 3 == 0)
+      curves.push_back(X_monotone_curve_2(Ray_2(p, q)));
+    else
+      curves.push_back(X_monotone_curve_2(Line_2(p, q)));
+  }
+  // vertical rays going up to the top boundary
+  for(int i=-20; i<=20; i+=5)
+    curves.push_back(X_monotone_curve_2(Ray_2(Point_2(i, 0), Point_2(i, 1))));
+
+  Arrangement arr;
+  CGAL::insert(arr, curves.begin(), curves.end());
+
+  std::vector<Point_2> queries;
+  for(int i=0; i<5000; ++i)
+    queries.push_back(Point_2(rnd.get_double(-30, 30), rnd.get_double(-30, 30)));
+  for(Arrangement::Vertex_const_handle v : arr.vertex_handles())
+    if(!v->is_at_open_boundary())
+      queries.push_back(v->point());
+
+  test_batched_locate(arr, queries);
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // use several slabs and threads, whatever the number of cores
+  tbb::global_control c(tbb::global_control::max_allowed_parallelism, 8);
+  tbb::task_arena arena(8);
+  arena.execute([&]
+  {
+    test_segments(rnd);
+    test_unbounded(rnd);
+  });
+#else
+  test_segments(rnd);
+  test_unbounded(rnd);
+#endif
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,158 @@
+#include <CGAL/config.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Arrangement_2.h>
+#include <CGAL/Arr_naive_point_location.h>
+#include <CGAL/Arr_trapezoid_ric_point_location.h>
+#include <CGAL/Random.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+#endif
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel     Kernel;
+typedef CGAL::Arr_segment_traits_2<Kernel>                    Traits;
+typedef Traits::Point_2                                       Point_2;
+typedef Traits::Segment_2                                     Segment_2;
+typedef CGAL::Arrangement_2<Traits>                           Arrangement;
+typedef CGAL::Arr_naive_point_location<Arrangement>           Naive_pl;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+template <typename Point_location>
+void check_queries(const Arrangement& arr, const Point_location& pl,
+                   CGAL::Random& rnd, double x_min, double x_max,
+                   double y_min, double y_max)
+{
+  Naive_pl naive_pl(arr);
+  for(int i=0; i<1000; ++i)
+  {
+    const Point_2 p(rnd.get_double(x_min, x_max), rnd.get_double(y_min, y_max));
+    assert(pl.locate(p) == naive_pl.locate(p));
+  }
+  for(Arrangement::Vertex_const_iterator vit = arr.vertices_begin(); vit != arr.vertices_end(); ++vit)
+    assert(pl.locate(vit->point()) == naive_pl.locate(vit->point()));
+}
+
+template <typename Point_location>
+void check_statistics(const Point_location& pl)
+{
+  std::cout << "  " << pl.number_of_rebuilds() << " rebuilds, in "
+            << pl.total_rebuild_time() << " sec." << std::endl;
+  assert(pl.last_rebuild_time() >= 0);
+  assert(pl.total_rebuild_time() >= pl.last_rebuild_time());
+  if(pl.number_of_rebuilds() == 0)
+    assert(pl.total_rebuild_time() == 0);
+}
+
+// Constructs the search structure of a grid, large enough for the parallel
+// construction to locate the endpoints by rounds.
+template <typename Point_location>
+void test_construction(CGAL::Random& rnd)
+{
+  const int n = 40;
+  std::list<Segment_2> segments;
+  for(int i=0; i<=n; ++i)
+  {
+    segments.push_back(Segment_2(Point_2(i, 0), Point_2(i, n)));
+    segments.push_back(Segment_2(Point_2(0, i), Point_2(n, i)));
+  }
+
+  Arrangement arr;
+  CGAL::insert(arr, segments.begin(), segments.end());
+  std::cout << "  " << arr.number_of_edges() << " edges" << std::endl;
+
+  Point_location pl(arr);
+  check_queries(arr, pl, rnd, -1, n + 1, -1, n + 1);
+
+  // local updates of the search structure
+  std::vector<Arrangement::Halfedge_handle> edges;
+  for(Arrangement::Edge_iterator eit = arr.edges_begin(); eit != arr.edges_end(); ++eit)
+    if(rnd.get_int(0, 10) == 0)
+      edges.push_back(eit);
+  for(Arrangement::Halfedge_handle e : edges)
+    arr.remove_edge(e);
+  CGAL::insert(arr, Segment_2(Point_2(-1, -1), Point_2(n + 1, n + 2)), pl);
+  check_queries(arr, pl, rnd, -1, n + 1, -1, n + 1);
+
+  // reconstruction from scratch
+  pl.with_guarantees(false);
+  pl.with_guarantees(true);
+  check_queries(arr, pl, rnd, -1, n + 1, -1, n + 1);
+  check_statistics(pl);
+}
+
+// Inserts many disjoint segments, ordered by their y-coordinates.
+template <typename Point_location>
+void test_sorted_insertions(CGAL::Random& rnd)
+{
+  const int n = 2000;
+  std::list<Segment_2> segments;
+  for(int i=0; i<n; ++i)
+    segments.push_back(Segment_2(Point_2(i % 7, i), Point_2(1000 + i % 5, i)));
+
+  // with an aggregated insertion
+  Arrangement arr;
+  Point_location pl(arr);
+  CGAL::insert(arr, Segment_2(Point_2(-5, -5), Point_2(2000, -5)), pl);
+  CGAL::insert(arr, segments.begin(), segments.end());
+  check_queries(arr, pl, rnd, -6, 2001, -6, n + 1);
+  check_statistics(pl);
+
+  // with incremental insertions, which force the search structure to be
+  // rebuilt
+  Arrangement arr2;
+  Point_location pl2(arr2);
+  std::list<Segment_2>::const_iterator it = segments.begin();
+  for(int i=0; i<n/4; ++i, ++it)
+    CGAL::insert_non_intersecting_curve(arr2, *it, pl2);
+  check_queries(arr2, pl2, rnd, -1, 1005, -1, n/4 + 1);
+  check_statistics(pl2);
+  assert(pl2.number_of_rebuilds() > 0);
+}
+
+void test(CGAL::Random& rnd)
+{
+  typedef CGAL::Arr_trapezoid_ric_point_location<Arrangement> Trapezoid_ric_pl;
+  typedef CGAL::Arr_trapezoid_ric_point_location<Arrangement, Concurrency_tag>
+                                                              Parallel_trapezoid_ric_pl;
+
+  std::cout << "== construction" << std::endl;
+  test_construction<Trapezoid_ric_pl>(rnd);
+  std::cout << "== parallel construction" << std::endl;
+  test_construction<Parallel_trapezoid_ric_pl>(rnd);
+
+  std::cout << "== sorted insertions" << std::endl;
+  test_sorted_insertions<Trapezoid_ric_pl>(rnd);
+  std::cout << "== sorted insertions, parallel construction" << std::endl;
+  test_sorted_insertions<Parallel_trapezoid_ric_pl>(rnd);
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // locate with several threads, whatever the number of cores
+  tbb::global_control c(tbb::global_control::max_allowed_parallelism, 4);
+  tbb::task_arena arena(4);
+  arena.execute([&]{ test(rnd); });
+#else
+  test(rnd);
+#endif
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -251,6 +251,17 @@ is used to distinguish between the two options.)
 template <class InputIterator>
 void intersection(InputIterator begin, InputIterator end);
 
+/*!
+computes the intersection of a collection of point sets, as the function above.
+If `ConcurrencyTag` is `CGAL::Parallel_tag`, the independent merges of the
+divide-and-conquer algorithm run in parallel, each on its own arrangement.
+In that case, the traits must be safe to use concurrently.
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_if_available_tag`, and `Parallel_tag`.
+*/
+template <class ConcurrencyTag, class InputIterator>
+void intersection(InputIterator begin, InputIterator end);
+
 /*!
 computes the intersection of a collection of point sets. The collection
 consists of the polygons and polygons with holes in the given two ranges
@@ -284,6 +295,18 @@ of the input iterator is used to distinguish between the two options.)
 template <class InputIterator>
 void join(InputIterator begin, InputIterator end);
 
+/*!
+computes the union of the polygons (or polygons with holes) in the
+given range and the point set represented by `gps`, as the function above.
+If `ConcurrencyTag` is `CGAL::Parallel_tag`, the independent merges of the
+divide-and-conquer algorithm run in parallel, each on its own arrangement.
+In that case, the traits must be safe to use concurrently.
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_if_available_tag`, and `Parallel_tag`.
+*/
+template <class ConcurrencyTag, class InputIterator>
+void join(InputIterator begin, InputIterator end);
+
 /*!
 computes the union of the polygons and polygons with holes in the
 given two ranges and the point set represented by `gps`.
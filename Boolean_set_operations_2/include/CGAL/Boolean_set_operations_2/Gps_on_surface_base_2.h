@@ -36,6 +36,17 @@
 #include <CGAL/Boolean_set_operations_2/Gps_polygon_simplifier.h>
 #include <CGAL/Boolean_set_operations_2/Ccb_curve_iterator.h>
 #include <CGAL/Union_find.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_group.h>
+#endif
+
+#include <boost/range/irange.hpp>
+
+#include <type_traits>
+#include <vector>
 
 
 /*!
@@ -813,6 +824,29 @@ public:
     this->_reset_faces();
   }
 
+  // join a range of polygons (or polygons with holes). With `Parallel_tag`,
+  // the arrangements of the polygons are built concurrently, and the
+  // independent merges of the divide-and-conquer run concurrently, each on
+  // its own arrangement (see previous comment about k=5).
+  template <typename ConcurrencyTag, typename InputIterator>
+  void join(InputIterator begin, InputIterator end, unsigned int k = 5)
+  {
+    Join_merge<Aos_2> join_merge;
+    _aggregate<ConcurrencyTag>(begin, end, k, join_merge, false);
+    this->remove_redundant_edges();
+    this->_reset_faces();
+  }
+
+  // intersect a range of polygons (or polygons with holes), see join() above.
+  template <typename ConcurrencyTag, typename InputIterator>
+  void intersection(InputIterator begin, InputIterator end, unsigned int k = 5)
+  {
+    Intersection_merge<Aos_2> intersection_merge;
+    _aggregate<ConcurrencyTag>(begin, end, k, intersection_merge, true);
+    this->remove_redundant_edges();
+    this->_reset_faces();
+  }
+
 
 
   // symmetric_difference of a range of polygons (similar to xor)
@@ -1379,11 +1413,87 @@ protected:
     }
   }
 
-  template <class Merge>
+  template <class ConcurrencyTag, class InputIterator, class Merge>
+  void _aggregate(InputIterator begin, InputIterator end,
+                  unsigned int k, Merge merge_func, bool validate)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    std::vector<InputIterator> pgns;
+    for (InputIterator itr = begin; itr != end; ++itr)
+    {
+      if (validate)
+        ValidationPolicy::is_valid(*itr, *m_traits);
+      pgns.push_back(itr);
+    }
+
+    std::vector<Arr_entry> arr_vec (pgns.size() + 1);
+    arr_vec[0].first = this->m_arr;
+
+    Less_vertex_handle comp (m_traits->compare_xy_2_object());
+    CGAL::for_each<ConcurrencyTag>(
+      boost::irange<std::size_t>(0, arr_vec.size()),
+      [&](std::size_t i) -> bool
+      {
+        if (i != 0)
+        {
+          arr_vec[i].first = new Aos_2(m_traits);
+          _insert(*pgns[i-1], *(arr_vec[i].first));
+        }
+
+        Aos_2* p_arr = arr_vec[i].first;
+        arr_vec[i].second = new std::vector<Vertex_handle>;
+        arr_vec[i].second->reserve (p_arr->number_of_vertices());
+        for (Vertex_iterator vit = p_arr->vertices_begin();
+             vit != p_arr->vertices_end(); ++vit)
+          arr_vec[i].second->push_back(vit);
+        std::sort (arr_vec[i].second->begin(), arr_vec[i].second->end(), comp);
+        return true;
+      });
+
+    _divide_and_conquer<ConcurrencyTag>(0, static_cast<unsigned int>(arr_vec.size()-1),
+                                        arr_vec, k, merge_func);
+
+    //the result arrangement is at index 0
+    this->m_arr = arr_vec[0].first;
+    delete arr_vec[0].second;
+  }
+
+  // The sub-ranges of the recursion are disjoint, so their merges are
+  // independent and each writes in its own entry of `arr_vec`.
+  template <class ConcurrencyTag = Sequential_tag, class Merge>
   void _divide_and_conquer (unsigned int lower, unsigned int upper,
                             std::vector<Arr_entry>& arr_vec,
                             unsigned int k, Merge merge_func)
   {
+#ifdef CGAL_LINKED_WITH_TBB
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value &&
+        (upper - lower) >= k)
+    {
+      unsigned int sub_size = ((upper - lower + 1) / k);
+      unsigned int curr_lower = lower;
+
+      tbb::task_group tasks;
+      for (unsigned int i = 0; i < k-1; ++i, curr_lower += sub_size)
+      {
+        const unsigned int sub_lower = curr_lower;
+        tasks.run([this, sub_lower, sub_size, &arr_vec, k, merge_func]
+                  {
+                    _divide_and_conquer<ConcurrencyTag>(sub_lower, sub_lower + sub_size-1,
+                                                        arr_vec, k, merge_func);
+                  });
+      }
+      _divide_and_conquer<ConcurrencyTag>(curr_lower, upper, arr_vec, k, merge_func);
+      tasks.wait();
+
+      merge_func (lower, curr_lower, sub_size, arr_vec);
+      return;
+    }
+#endif
+
     if ((upper - lower) < k)
     {
       merge_func(lower, upper, 1, arr_vec);
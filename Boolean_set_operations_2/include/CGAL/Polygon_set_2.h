@@ -99,6 +99,12 @@ public:
     Base::intersection(begin, end);
   }
 
+  template <class ConcurrencyTag, class InputIterator>
+  inline void intersection(InputIterator begin, InputIterator end, unsigned int k = 5)
+  {
+    Base::template intersection<ConcurrencyTag>(begin, end, k);
+  }
+
   template <class InputIterator1, class InputIterator2>
   inline void intersection(InputIterator1 begin1, InputIterator1 end1,
                            InputIterator2 begin2, InputIterator2 end2)
@@ -132,6 +138,12 @@ public:
     Base::join(begin, end);
   }
 
+  template <class ConcurrencyTag, class InputIterator>
+  inline void join(InputIterator begin, InputIterator end, unsigned int k = 5)
+  {
+    Base::template join<ConcurrencyTag>(begin, end, k);
+  }
+
   template <class InputIterator1, class InputIterator2>
   inline void join(InputIterator1 begin1, InputIterator1 end1,
                    InputIterator2 begin2, InputIterator2 end2)
@@ -0,0 +1,141 @@
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Boolean_set_operations_2.h>
+#include <CGAL/Polygon_set_2.h>
+#include <CGAL/General_polygon_set_2.h>
+#include <CGAL/Gps_segment_traits_2.h>
+#include <CGAL/tags.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
+typedef Kernel::Point_2                                   Point_2;
+typedef Kernel::FT                                        FT;
+typedef CGAL::Polygon_2<Kernel>                           Polygon_2;
+typedef CGAL::Polygon_with_holes_2<Kernel>                Polygon_with_holes_2;
+typedef CGAL::Polygon_set_2<Kernel>                       Polygon_set_2;
+
+typedef CGAL::Gps_segment_traits_2<Kernel>                Gps_traits;
+typedef CGAL::General_polygon_set_2<Gps_traits>           General_polygon_set_2;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+Polygon_2 square(const FT& x, const FT& y, const FT& size)
+{
+  Polygon_2 pgn;
+  pgn.push_back(Point_2(x, y));
+  pgn.push_back(Point_2(x + size, y));
+  pgn.push_back(Point_2(x + size, y + size));
+  pgn.push_back(Point_2(x, y + size));
+  return pgn;
+}
+
+// a grid of overlapping squares, with a few isolated ones
+std::vector<Polygon_2> footprints(int n)
+{
+  std::vector<Polygon_2> pgns;
+  for(int i=0; i<n; ++i)
+    for(int j=0; j<n; ++j)
+      if((i + j) % 7 != 0)
+        pgns.push_back(square(FT(2 * i), FT(2 * j), FT(3) - FT(i % 3) / 2));
+  for(int i=0; i<n; ++i)
+    pgns.push_back(square(FT(-10), FT(3 * i), FT(1)));
+  return pgns;
+}
+
+FT area(const Polygon_set_2& ps)
+{
+  std::list<Polygon_with_holes_2> res;
+  ps.polygons_with_holes(std::back_inserter(res));
+
+  FT a = 0;
+  for(const Polygon_with_holes_2& pwh : res)
+  {
+    a += pwh.outer_boundary().area();
+    for(const Polygon_2& h : pwh.holes())
+      a += h.area();
+  }
+  return a;
+}
+
+void test_join(int n, unsigned int k)
+{
+  std::cout << "== join of a " << n << "x" << n << " grid (k=" << k << ")" << std::endl;
+
+  const std::vector<Polygon_2> pgns = footprints(n);
+
+  Polygon_set_2 ps, seq_ps;
+  ps.join<Concurrency_tag>(pgns.begin(), pgns.end());
+  seq_ps.join(pgns.begin(), pgns.end());
+
+  std::cout << ps.number_of_polygons_with_holes() << " polygons with holes ("
+            << seq_ps.number_of_polygons_with_holes() << " sequentially)" << std::endl;
+
+  assert(ps.is_valid());
+  assert(ps.number_of_polygons_with_holes() == seq_ps.number_of_polygons_with_holes());
+  assert(ps.arrangement().number_of_vertices() == seq_ps.arrangement().number_of_vertices());
+  assert(area(ps) == area(seq_ps));
+
+  // the result does not depend on the arity of the recursion
+  General_polygon_set_2 gps, other_gps;
+  gps.join<Concurrency_tag>(pgns.begin(), pgns.end(), k);
+  other_gps.join<CGAL::Sequential_tag>(pgns.begin(), pgns.end(), k);
+  assert(gps.number_of_polygons_with_holes() == seq_ps.number_of_polygons_with_holes());
+  assert(other_gps.number_of_polygons_with_holes() == seq_ps.number_of_polygons_with_holes());
+  Polygon_set_2 k_ps;
+  k_ps.join<Concurrency_tag>(pgns.begin(), pgns.end(), k);
+  assert(k_ps.number_of_polygons_with_holes() == seq_ps.number_of_polygons_with_holes());
+  assert(area(k_ps) == area(seq_ps));
+}
+
+void test_intersection(int n)
+{
+  std::cout << "== intersection of " << n << " squares" << std::endl;
+
+  std::vector<Polygon_with_holes_2> pgns;
+  for(int i=0; i<n; ++i)
+  {
+    Polygon_with_holes_2 pwh(square(FT(i) / n, FT(i) / (2 * n), FT(10)));
+    Polygon_2 hole = square(FT(5) + FT(i) / n, FT(5), FT(1) / 4);
+    hole.reverse_orientation();
+    pwh.add_hole(hole);
+    pgns.push_back(pwh);
+  }
+
+  Polygon_set_2 ps, seq_ps;
+  ps.insert(square(FT(-1), FT(-1), FT(20)));
+  seq_ps.insert(square(FT(-1), FT(-1), FT(20)));
+  ps.intersection<Concurrency_tag>(pgns.begin(), pgns.end());
+  seq_ps.intersection(pgns.begin(), pgns.end());
+
+  assert(ps.is_valid());
+  assert(ps.number_of_polygons_with_holes() == 1);
+  assert(seq_ps.number_of_polygons_with_holes() == 1);
+  assert(ps.arrangement().number_of_vertices() == seq_ps.arrangement().number_of_vertices());
+  assert(area(ps) == area(seq_ps));
+
+  // the result does not depend on the arity of the recursion
+  Polygon_set_2 k_ps;
+  k_ps.insert(square(FT(-1), FT(-1), FT(20)));
+  k_ps.intersection<Concurrency_tag>(pgns.begin(), pgns.end(), 3);
+  assert(k_ps.number_of_polygons_with_holes() == 1);
+  assert(area(k_ps) == area(seq_ps));
+}
+
+int main()
+{
+  test_join(1, 5);
+  test_join(12, 5);
+  test_join(25, 3);
+  test_intersection(40);
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -25,6 +25,7 @@
 #include <CGAL/Dynamic_property_map.h>
 #include <CGAL/squared_distance_3.h>
 #include <CGAL/number_utils.h>
+#include <CGAL/tags.h>
 #ifdef CGAL_EIGEN3_ENABLED
 #include <CGAL/Eigen_solver_traits.h>
 #endif
@@ -32,9 +33,16 @@
 #include <CGAL/Weights/utils.h>
 #include <boost/range/has_range_iterator.hpp>
 
+#include <iterator>
+#include <type_traits>
 #include <vector>
 #include <set>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 namespace CGAL {
 
 namespace Heat_method_3 {
@@ -238,20 +246,26 @@ private:
 
   void
   update_kronecker_delta()
+  {
+    kronecker_delta(sources(), m_kronecker);
+  }
+
+  void
+  kronecker_delta(const Vertex_const_range& sources, Matrix& kronecker) const
   {
     //currently just working with a single vertex in source set, add the first one for now
     Index i;
     Matrix K(static_cast<int>(num_vertices(tm)), 1);
-    if(sources().empty()) {
+    if(sources.empty()) {
       i = 0;
       K.set_coef(i,0, 1, true);
     } else {
-      for(vertex_descriptor vd : sources()){
+      for(vertex_descriptor vd : sources){
         i = get(vertex_id_map, vd);
         K.set_coef(i,0, 1, true);
       }
     }
-    m_kronecker.swap(K);
+    kronecker.swap(K);
   }
 
   const Matrix&
@@ -284,14 +298,20 @@ private:
 
   void
   compute_unit_gradient()
+  {
+    compute_unit_gradient(m_solved_u, m_X);
+  }
+
+  void
+  compute_unit_gradient(const Vector& solved_u, std::vector<Vector_3>& X) const
   {
     typename Traits::Construct_vector_3 construct_vector = Traits().construct_vector_3_object();
     typename Traits::Construct_sum_of_vectors_3 sum = Traits().construct_sum_of_vectors_3_object();
     typename Traits::Compute_scalar_product_3 scalar_product = Traits().compute_scalar_product_3_object();
     typename Traits::Construct_cross_product_vector_3 cross_product = Traits().construct_cross_product_vector_3_object();
     typename Traits::Construct_scaled_vector_3 scale = Traits().construct_scaled_vector_3_object();
-    if(m_X.empty()){
-      m_X.resize(num_faces(tm));
+    if(X.empty()){
+      X.resize(num_faces(tm));
     }
     CGAL::Vertex_around_face_iterator<TriangleMesh> vbegin, vend, vmiddle;
     for(face_descriptor f : faces(tm)) {
@@ -321,9 +341,9 @@ private:
       double N_cross = (CGAL::sqrt(to_double(scalar_product(cross,cross))));
       Vector_3 unit_cross = scale(cross, 1./N_cross);
       double area_face = N_cross * (1./2);
-      double u_i = CGAL::abs(m_solved_u(i));
-      double u_j = CGAL::abs(m_solved_u(j));
-      double u_k = CGAL::abs(m_solved_u(k));
+      double u_i = CGAL::abs(solved_u(i));
+      double u_j = CGAL::abs(solved_u(j));
+      double u_k = CGAL::abs(solved_u(k));
       double r_Mag = 1./(std::max)((std::max)(u_i, u_j),u_k);
       /* normalize heat values so that they have roughly unit magnitude */
       if(!std::isinf(r_Mag)) {
@@ -336,12 +356,18 @@ private:
       edge_sums = sum(edge_sums, scale(cross_product(unit_cross, construct_vector(p_k,p_i)), u_j));
       edge_sums = scale(edge_sums, (1./area_face));
       double e_magnitude = CGAL::sqrt(to_double(scalar_product(edge_sums,edge_sums)));
-      m_X[face_i] = scale(edge_sums,(1./e_magnitude));
+      X[face_i] = scale(edge_sums,(1./e_magnitude));
     }
   }
 
   void
   compute_divergence()
+  {
+    compute_divergence(m_X, m_index_divergence);
+  }
+
+  void
+  compute_divergence(const std::vector<Vector_3>& X, Matrix& index_divergence) const
   {
     typename Traits::Compute_scalar_product_3 scalar_product = Traits().compute_scalar_product_3_object();
     typename Traits::Construct_vector_3 construct_vector = Traits().construct_vector_3_object();
@@ -372,7 +398,7 @@ private:
       const FT cotan_j = CGAL::Weights::cotangent(p_k, p_j, p_i, traits);
       const FT cotan_k = CGAL::Weights::cotangent(p_j, p_k, p_i, traits);
 
-      const Vector_3& a = m_X[face_i];
+      const Vector_3& a = X[face_i];
       const double i_entry = (CGAL::to_double(scalar_product(a, v_ij) * cotan_k)) +
                              (CGAL::to_double(scalar_product(a, v_ik) * cotan_j));
       const double j_entry = (CGAL::to_double(scalar_product(a, v_jk) * cotan_i)) +
@@ -384,15 +410,21 @@ private:
       indexD.add_coef(j, 0, (1./2)*j_entry);
       indexD.add_coef(k, 0, (1./2)*k_entry);
     }
-    indexD.swap(m_index_divergence);
+    indexD.swap(index_divergence);
   }
 
   // modifies m_solved_phi
   void
   value_at_source_set(const Vector& phi)
+  {
+    value_at_source_set(phi, sources(), m_solved_phi);
+  }
+
+  void
+  value_at_source_set(const Vector& phi, const Vertex_const_range& sources, Vector& solved_phi) const
   {
     Vector source_set_val(dimension);
-    if(sources().empty()) {
+    if(sources.empty()) {
       for(int k = 0; k<dimension; k++) {
         source_set_val(k,0) = phi.coeff(0,0);
       }
@@ -402,7 +434,7 @@ private:
         double min_val = (std::numeric_limits<double>::max)();
         Index vd_index;
         //go through the distances to the sources and leave the minimum distance;
-        for(vertex_descriptor vd : sources()){
+        for(vertex_descriptor vd : sources){
           vd_index = get(vertex_id_map, vd);
           double new_d = CGAL::abs(-phi.coeff(vd_index,0)+phi.coeff(i,0));
           if(phi.coeff(vd_index,0)==phi.coeff(i,0)) {
@@ -415,7 +447,7 @@ private:
         source_set_val(i,0) = min_val;
       }
     }
-    m_solved_phi.swap(source_set_val);
+    solved_phi.swap(source_set_val);
   }
 
   void
@@ -475,6 +507,73 @@ public:
     }
   }
 
+  /**
+   *  Fills the distance property map `vdms[i]` for the source set `source_sets[i]`.
+   *  The source sets are solved with the factorizations computed once at construction.
+   *  With `Parallel_tag`, the source sets are solved concurrently, each with its own buffers,
+   *  so `LA::linear_solver()` must support concurrent calls once the matrix is factorized.
+   **/
+  template <class ConcurrencyTag, class SourceSetRange, class VertexDistanceMapRange, class VertexDistanceMapConverter>
+  void estimate_geodesic_distances(const SourceSetRange& source_sets,
+                                   const VertexDistanceMapRange& vdms,
+                                   const VertexDistanceMapConverter& to_vdm)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert(!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                  "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    if(is_empty(tm)){
+      return;
+    }
+    const std::size_t number_of_source_sets = std::distance(std::begin(source_sets), std::end(source_sets));
+    CGAL_precondition(std::size_t(std::distance(std::begin(vdms), std::end(vdms))) >= number_of_source_sets);
+
+    auto solve = [&](std::size_t s)
+    {
+      Vertex_const_range sources;
+      for(const auto& vd : *(std::next(std::begin(source_sets), s))){
+        sources.insert(v2v(vd));
+      }
+
+      Matrix kronecker, index_divergence;
+      Vector solved_u, phi, solved_phi;
+      std::vector<Vector_3> X;
+      kronecker_delta(sources, kronecker);
+      if(! la.linear_solver(kronecker, solved_u)) {
+        CGAL_error_msg("Eigen Solving in cotan failed");
+      }
+      compute_unit_gradient(solved_u, X);
+      compute_divergence(X, index_divergence);
+      if(! la_cotan.linear_solver(index_divergence, phi)) {
+        CGAL_error_msg("Eigen Solving in solve_phi() failed");
+      }
+      value_at_source_set(phi, sources, solved_phi);
+
+      auto vdm = to_vdm(*(std::next(std::begin(vdms), s)));
+      for(vertex_descriptor vd : vertices(tm)){
+        put(vdm, vd, solved_phi(get(vertex_id_map, vd), 0));
+      }
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, number_of_source_sets, 1),
+                        [&](const tbb::blocked_range<std::size_t>& range)
+      {
+        for(std::size_t s = range.begin(); s != range.end(); ++s){
+          solve(s);
+        }
+      });
+      return;
+    }
+#endif
+
+    for(std::size_t s = 0; s < number_of_source_sets; ++s){
+      solve(s);
+    }
+  }
+
 private:
   void
   build()
@@ -629,6 +728,17 @@ struct Base_helper
         base().triangle_mesh(), Traits()));
     base().estimate_geodesic_distances(vdm);
   }
+
+  template <class ConcurrencyTag, class SourceSetRange, class VertexDistanceMapRange>
+  void estimate_geodesic_distances(const SourceSetRange& source_sets,
+                                   const VertexDistanceMapRange& vdms)
+  {
+    CGAL_assertion(
+      !CGAL::Heat_method_3::internal::has_degenerate_faces(
+        base().triangle_mesh(), Traits()));
+    base().template estimate_geodesic_distances<ConcurrencyTag>(
+      source_sets, vdms, [](const auto& vdm) { return vdm; });
+  }
 };
 
 template<class TriangleMesh,
@@ -688,6 +798,14 @@ struct Base_helper<TriangleMesh, Traits, Intrinsic_Delaunay, LA, VertexPointMap>
   {
     base().estimate_geodesic_distances(this->m_idt.vertex_distance_map(vdm));
   }
+
+  template <class ConcurrencyTag, class SourceSetRange, class VertexDistanceMapRange>
+  void estimate_geodesic_distances(const SourceSetRange& source_sets,
+                                   const VertexDistanceMapRange& vdms)
+  {
+    base().template estimate_geodesic_distances<ConcurrencyTag>(
+      source_sets, vdms, [this](const auto& vdm) { return this->m_idt.vertex_distance_map(vdm); });
+  }
 };
 
 } // namespace internal
@@ -883,6 +1001,34 @@ public:
   {
     Base_helper::estimate_geodesic_distances(vdm);
   }
+
+  /**
+   * fills, for each source set `source_sets[i]`, the distance property map `vdms[i]` with the estimated
+   * geodesic distance of each vertex to the closest vertex of this source set.
+   * All the source sets are solved with the factorizations computed at construction,
+   * which makes the computation of many distance fields (for example, one per landmark vertex) cheap.
+   * The source set of this object is neither used nor modified.
+   *
+   * \tparam ConcurrencyTag enables sequential versus parallel algorithm. Possible values are `Sequential_tag`,
+   *         `Parallel_tag`, and `Parallel_if_available_tag`. With `Parallel_tag`, the source sets are solved concurrently.
+   *         `LA` must then support concurrent calls to `linear_solver()` once the matrix is factorized,
+   *         which is the case of `Eigen_solver_traits` with a direct solver such as the default one.
+   * \tparam SourceSetRange a model of the concept `RandomAccessRange` whose value type is a model of the concept
+   *         `ConstRange` with value type `vertex_descriptor`
+   * \tparam VertexDistanceMapRange a model of the concept `RandomAccessRange` whose value type is
+   *         a property map model of `WritablePropertyMap` with `vertex_descriptor` as key type and `double` as value type
+   * \param source_sets the source sets
+   * \param vdms the vertex distance maps to be filled, one per source set. They must be distinct
+   *         if `ConcurrencyTag` is `Parallel_tag`.
+   * \pre If `Mode` is `Direct`, the support triangle mesh does not have any degenerate faces
+   * \pre `vdms` has at least as many elements as `source_sets`
+   **/
+  template <class ConcurrencyTag = Sequential_tag, class SourceSetRange, class VertexDistanceMapRange>
+  void estimate_geodesic_distances(const SourceSetRange& source_sets,
+                                   const VertexDistanceMapRange& vdms)
+  {
+    Base_helper::template estimate_geodesic_distances<ConcurrencyTag>(source_sets, vdms);
+  }
 };
 
 #if defined(DOXYGEN_RUNNING) || defined(CGAL_EIGEN3_ENABLED)
@@ -0,0 +1,116 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Heat_method_3/Surface_mesh_geodesic_distances_3.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+#endif
+
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+
+typedef CGAL::Simple_cartesian<double>                       Kernel;
+typedef Kernel::Point_3                                      Point_3;
+typedef CGAL::Surface_mesh<Point_3>                          Surface_mesh;
+
+typedef boost::graph_traits<Surface_mesh>::vertex_descriptor vertex_descriptor;
+typedef Surface_mesh::Property_map<vertex_descriptor,double> Vertex_distance_map;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+template <typename Mode>
+void test(Surface_mesh& sm)
+{
+  typedef CGAL::Heat_method_3::Surface_mesh_geodesic_distances_3<Surface_mesh, Mode> Heat_method;
+
+  // single sources, pairs of sources, and an empty source set
+  std::vector<std::vector<vertex_descriptor> > source_sets;
+  std::vector<vertex_descriptor> landmarks;
+  for(vertex_descriptor vd : vertices(sm))
+    if(vd.idx() % 50 == 0)
+      landmarks.push_back(vd);
+  for(std::size_t i=0; i<landmarks.size(); ++i)
+  {
+    source_sets.push_back(std::vector<vertex_descriptor>(1, landmarks[i]));
+    if(i % 4 == 1)
+      source_sets.push_back({landmarks[i-1], landmarks[i]});
+  }
+  source_sets.push_back(std::vector<vertex_descriptor>());
+
+  std::vector<Vertex_distance_map> seq_maps, par_maps, ref_maps;
+  for(std::size_t i=0; i<source_sets.size(); ++i)
+  {
+    seq_maps.push_back(sm.add_property_map<vertex_descriptor, double>("v:seq_distance_" + std::to_string(i), 0).first);
+    par_maps.push_back(sm.add_property_map<vertex_descriptor, double>("v:par_distance_" + std::to_string(i), 0).first);
+    ref_maps.push_back(sm.add_property_map<vertex_descriptor, double>("v:ref_distance_" + std::to_string(i), 0).first);
+  }
+
+  Heat_method hm(sm);
+  hm.add_source(landmarks.back());
+  hm.estimate_geodesic_distances(source_sets, seq_maps);
+  hm.template estimate_geodesic_distances<Concurrency_tag>(source_sets, par_maps);
+
+  // the source set of hm is not modified
+  assert(hm.sources().size() == 1);
+
+  // the batched distances are the ones of the distances computed one source set at a time
+  for(std::size_t i=0; i<source_sets.size(); ++i)
+  {
+    hm.clear_sources();
+    hm.add_sources(source_sets[i]);
+    hm.estimate_geodesic_distances(ref_maps[i]);
+    for(vertex_descriptor vd : vertices(sm))
+    {
+      assert(get(seq_maps[i], vd) == get(ref_maps[i], vd));
+      assert(get(par_maps[i], vd) == get(ref_maps[i], vd));
+    }
+    for(vertex_descriptor vd : source_sets[i])
+      assert(get(par_maps[i], vd) == 0.);
+  }
+  std::cout << "  " << source_sets.size() << " source sets" << std::endl;
+
+  for(std::size_t i=0; i<source_sets.size(); ++i)
+  {
+    sm.remove_property_map(seq_maps[i]);
+    sm.remove_property_map(par_maps[i]);
+    sm.remove_property_map(ref_maps[i]);
+  }
+}
+
+void test(Surface_mesh& sm)
+{
+  std::cout << "== direct" << std::endl;
+  test<CGAL::Heat_method_3::Direct>(sm);
+  std::cout << "== intrinsic Delaunay" << std::endl;
+  test<CGAL::Heat_method_3::Intrinsic_Delaunay>(sm);
+}
+
+int main(int argc, char* argv[])
+{
+  Surface_mesh sm;
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/larger_sphere.off");
+  std::ifstream in(filename);
+  in >> sm;
+  assert(! is_empty(sm));
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // solve with several threads, whatever the number of cores
+  tbb::global_control c(tbb::global_control::max_allowed_parallelism, 4);
+  tbb::task_arena arena(4);
+  arena.execute([&]{ test(sm); });
+#else
+  test(sm);
+#endif
+
+  std::cout << "Done" << std::endl;
+  return 0;
+}
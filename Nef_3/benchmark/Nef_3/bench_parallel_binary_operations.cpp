@@ -0,0 +1,103 @@
+// Compares the sequential and the parallel binary operations of Nef_polyhedron_3,
+// both in running time and in result.
+//
+// Usage: bench_parallel_binary_operations [mesh_1 mesh_2 [x y z]]
+// where the second mesh is translated by (x, y, z) before the operations.
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Nef_polyhedron_3.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Polygon_mesh_processing/transform.h>
+#include <CGAL/Aff_transformation_3.h>
+#include <CGAL/boost/graph/IO/polygon_mesh_io.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/tags.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
+typedef Kernel::Vector_3                                  Vector_3;
+typedef CGAL::Surface_mesh<Kernel::Point_3>               Mesh;
+typedef CGAL::Nef_polyhedron_3<Kernel>                    Nef_polyhedron;
+
+enum Operation { JOIN, INTERSECTION, DIFFERENCE, SYMMETRIC_DIFFERENCE };
+
+template <typename ConcurrencyTag>
+Nef_polyhedron run(const Nef_polyhedron& N0, const Nef_polyhedron& N1, Operation op)
+{
+  switch(op)
+  {
+    case JOIN: return N0.join<ConcurrencyTag>(N1);
+    case INTERSECTION: return N0.intersection<ConcurrencyTag>(N1);
+    case DIFFERENCE: return N0.difference<ConcurrencyTag>(N1);
+    default: return N0.symmetric_difference<ConcurrencyTag>(N1);
+  }
+}
+
+bool bench(const Nef_polyhedron& N0, const Nef_polyhedron& N1,
+           Operation op, const std::string& name)
+{
+  CGAL::Real_timer timer;
+
+  timer.start();
+  Nef_polyhedron seq_N = run<CGAL::Sequential_tag>(N0, N1, op);
+  timer.stop();
+  const double seq_time = timer.time();
+
+  timer.reset();
+  timer.start();
+  Nef_polyhedron N = run<CGAL::Parallel_tag>(N0, N1, op);
+  timer.stop();
+  const double par_time = timer.time();
+
+  const bool same = (N.number_of_vertices() == seq_N.number_of_vertices() &&
+                     N.number_of_halfedges() == seq_N.number_of_halfedges() &&
+                     N.number_of_facets() == seq_N.number_of_facets() &&
+                     N.number_of_volumes() == seq_N.number_of_volumes() &&
+                     N == seq_N);
+
+  std::cout << name << ": " << N.number_of_vertices() << " vertices" << std::endl;
+  std::cout << "  sequential: " << seq_time << " s" << std::endl;
+  std::cout << "  parallel:   " << par_time << " s (x" << seq_time / par_time << ")" << std::endl;
+  std::cout << "  " << (same ? "same result" : "DIFFERENT RESULTS") << std::endl;
+
+  return same;
+}
+
+Nef_polyhedron read_nef(const std::string& filename, const Vector_3& translation)
+{
+  Mesh mesh;
+  if(!CGAL::IO::read_polygon_mesh(filename, mesh) || !CGAL::is_closed(mesh))
+  {
+    std::cerr << "Error: cannot read a closed mesh from " << filename << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  CGAL::Polygon_mesh_processing::transform(Kernel::Aff_transformation_3(CGAL::Translation(), translation), mesh);
+  return Nef_polyhedron(mesh);
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename_0 = (argc > 2) ? argv[1] : CGAL::data_file_path("meshes/sphere.off");
+  const std::string filename_1 = (argc > 2) ? argv[2] : CGAL::data_file_path("meshes/sphere.off");
+  const Vector_3 translation = (argc > 5) ? Vector_3(std::atof(argv[3]), std::atof(argv[4]), std::atof(argv[5]))
+                                          : Vector_3(0.31, 0.27, 0.23);
+
+  CGAL::Real_timer timer;
+  timer.start();
+  Nef_polyhedron N0 = read_nef(filename_0, Vector_3(0, 0, 0));
+  Nef_polyhedron N1 = read_nef(filename_1, translation);
+  timer.stop();
+
+  std::cout << "Operands: " << N0.number_of_vertices() << " and "
+            << N1.number_of_vertices() << " vertices (built in " << timer.time() << " s)" << std::endl;
+
+  bool same = bench(N0, N1, JOIN, "join");
+  same = bench(N0, N1, INTERSECTION, "intersection") && same;
+  same = bench(N0, N1, DIFFERENCE, "difference") && same;
+  same = bench(N0, N1, SYMMETRIC_DIFFERENCE, "symmetric difference") && same;
+
+  return same ? EXIT_SUCCESS : EXIT_FAILURE;
+}
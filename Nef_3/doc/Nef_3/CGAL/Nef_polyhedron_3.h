@@ -1431,26 +1431,34 @@ public:
 /// @}
 
 /// \name Binary Set Operations
+/// The binary set operations are templated by a concurrency tag, which is `CGAL::Sequential_tag` by default.
+/// With `CGAL::Parallel_tag`, the point locations, the intersection tests, and the overlays
+/// of the local views of the two polyhedra are computed in parallel. This requires \ref thirdpartyTBB,
+/// and the result is the same as with the sequential version.
 /// @{
 
 /*!
   return the intersection of `N` and N1.
 */
+  template <typename ConcurrencyTag = CGAL::Sequential_tag>
   Nef_polyhedron_3<Traits> intersection(const Nef_polyhedron_3<Traits>& N1) const;
 
 /*!
   return the union of `N` and N1. (Note that ''union'' is a C++ keyword and cannot be used for this operation.)
 */
+  template <typename ConcurrencyTag = CGAL::Sequential_tag>
   Nef_polyhedron_3<Traits> join(const Nef_polyhedron_3<Traits>& N1) const;
 
 /*!
   return the difference between `N` and N1.
 */
+  template <typename ConcurrencyTag = CGAL::Sequential_tag>
   Nef_polyhedron_3<Traits> difference(const Nef_polyhedron_3<Traits>& N1) const;
 
 /*!
   return the symmetric difference of `N` and N1.
 */
+  template <typename ConcurrencyTag = CGAL::Sequential_tag>
   Nef_polyhedron_3<Traits> symmetric_difference(const Nef_polyhedron_3<Traits>& N1) const;
 
 /*!
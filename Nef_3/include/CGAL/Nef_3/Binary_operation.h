@@ -33,6 +33,16 @@
 #include <CGAL/Nef_3/binop_intersection_tests.h>
 #include <CGAL/Nef_3/ID_support_handler.h>
 //#include <CGAL/Nef_3/Edge_edge_overlay.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <mutex>
+#endif
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
 
 #undef CGAL_NEF_DEBUG
 #define CGAL_NEF_DEBUG 19
@@ -68,8 +78,13 @@ int number_of_intersections;
 int number_of_intersection_candidates;
 #endif
 
-template <typename Map>
+template <typename Map, typename ConcurrencyTag = Sequential_tag>
 class Binary_operation : public CGAL::SNC_decorator<Map> {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
  public:
   typedef Map SNC_structure;
   typedef typename SNC_structure::Items                Items;
@@ -236,6 +251,252 @@ class Binary_operation : public CGAL::SNC_decorator<Map> {
     Association& A;
   };
 
+#ifdef CGAL_LINKED_WITH_TBB
+ private:
+  // Serializes the accesses to the association, which is shared by the
+  // overlays computed concurrently. As the classes of two indices may be
+  // merged by another overlay between a call to `get_hash()` and a call
+  // to `set_hash()`, the latter merges the current classes of its arguments.
+  template <typename Association>
+  class Shared_association {
+    Association& A;
+    std::mutex mutex;
+
+  public:
+    Shared_association(Association& Ain) : A(Ain) {}
+
+    int get_hash(int i) {
+      std::lock_guard<std::mutex> lock(mutex);
+      return A.get_hash(i);
+    }
+
+    void set_hash(int i, int parent) {
+      std::lock_guard<std::mutex> lock(mutex);
+      int root_i = A.get_hash(i);
+      int root_parent = A.get_hash(parent);
+      if(root_parent < root_i)
+        A.set_hash(i, root_parent);
+      else if(root_i < root_parent)
+        A.set_hash(parent, root_i);
+    }
+
+    template <typename... Args>
+    void hash_facet_pair(const Args&... args) {
+      std::lock_guard<std::mutex> lock(mutex);
+      A.hash_facet_pair(args...);
+    }
+
+    template <typename... Args>
+    void handle_support(const Args&... args) {
+      std::lock_guard<std::mutex> lock(mutex);
+      A.handle_support(args...);
+    }
+  };
+
+  typedef typename SNC_const_decorator::Decorator_traits   Const_decorator_traits;
+  typedef typename Const_decorator_traits::Halfedge_handle  Const_halfedge_handle;
+  typedef typename Const_decorator_traits::Halffacet_handle Const_halffacet_handle;
+
+  // a local view to create in the result: either on a vertex of one
+  // operand located in the other operand, or on an intersection point
+  // between an edge of one operand and an edge or a facet of the other.
+  struct Overlay_job {
+    enum Type { VERTEX_0, VERTEX_1, EDGE_EDGE, EDGE_FACET };
+
+    Type type;
+    Vertex_const_handle v;
+    Object_handle o;
+    Const_halfedge_handle e0, e1;
+    Const_halffacet_handle f;
+    Point_3 p;
+    bool inverse_order;
+  };
+
+  // replaces the intersection call back when the intersection tests are
+  // run ahead of the overlays
+  class Intersection_recorder {
+    std::vector<Overlay_job>& jobs;
+    bool inverse_order;
+
+  public:
+    Intersection_recorder(std::vector<Overlay_job>& jobs_in, bool invert_order)
+      : jobs(jobs_in), inverse_order(invert_order) {}
+
+    void operator()(Const_halfedge_handle e0, Const_halfedge_handle e1, const Point_3& ip) {
+      Overlay_job job;
+      job.type = Overlay_job::EDGE_EDGE;
+      job.e0 = e0;
+      job.e1 = e1;
+      job.p = ip;
+      job.inverse_order = inverse_order;
+      jobs.push_back(job);
+    }
+
+    void operator()(Const_halfedge_handle e0, Const_halffacet_handle f, const Point_3& ip) {
+      Overlay_job job;
+      job.type = Overlay_job::EDGE_FACET;
+      job.e0 = e0;
+      job.f = f;
+      job.p = ip;
+      job.inverse_order = inverse_order;
+      jobs.push_back(job);
+    }
+  };
+
+  // same as the bodies of the vertex loops of the sequential operator()
+  template <typename Selection, typename Association>
+  void local_view_on_vertex(Vertex_const_handle v0, const Object_handle& o,
+                            bool first, const Selection& BOP, Association& A) {
+    Point_3 p(v0->point());
+    Vertex_handle v;
+    Halfedge_handle e;
+    Halffacet_handle f;
+    Volume_handle c;
+
+    Vertex_handle v1;
+    if( CGAL::assign( v, o)) {
+      CGAL_assertion( first);
+      binop_local_views( v0, v, BOP, *this->sncp(), A);
+      return;
+    }
+    else if( CGAL::assign( e, o))
+      v1 = create_local_view_on( p, e);
+    else if( CGAL::assign( f, o))
+      v1 = create_local_view_on( p, f);
+    else if( CGAL::assign( c, o)) {
+      if( first ? BOP( true, c->mark()) == BOP( false, c->mark())
+                : BOP( c->mark(), true) == BOP( c->mark(), false))
+        return;
+      SNC_constructor C(*this->sncp());
+      Vertex_handle vc = C.clone_SM(v0);
+      SM_decorator SM(&*vc);
+      if( first)
+        SM.change_marks(BOP, c->mark());
+      else
+        SM.change_marks(c->mark(), BOP);
+      SM_overlayer O(&*vc);
+      O.simplify(A);
+      return;
+    }
+    else CGAL_error_msg( "wrong handle");
+
+    if( first)
+      binop_local_views( v0, v1, BOP, *this->sncp(), A);
+    else
+      binop_local_views( v1, v0, BOP, *this->sncp(), A);
+    this->sncp()->delete_vertex(v1);
+  }
+
+  template <typename Selection, typename Association>
+  void run_overlay_job(const Overlay_job& job,
+                       const SNC_structure& snc1, const SNC_structure& snc2,
+                       const Selection& BOP, Association& A) {
+    Intersection_call_back<SNC_const_decorator, Selection, Association> call_back
+      ( snc1, snc2, BOP, *this->sncp(), job.inverse_order, A);
+    switch(job.type) {
+    case Overlay_job::VERTEX_0:
+      local_view_on_vertex( job.v, job.o, true, BOP, A);
+      break;
+    case Overlay_job::VERTEX_1:
+      local_view_on_vertex( job.v, job.o, false, BOP, A);
+      break;
+    case Overlay_job::EDGE_EDGE:
+      call_back( job.e0, job.e1, job.p);
+      break;
+    case Overlay_job::EDGE_FACET:
+      call_back( job.e0, job.f, job.p);
+      break;
+    }
+  }
+
+  template <typename Selection, typename Association>
+  void parallel_local_views( const SNC_structure& snc1,
+                             const SNC_point_locator* pl1,
+                             const SNC_structure& snc2,
+                             const SNC_point_locator* pl2,
+                             const Selection& BOP,
+                             Association& A)
+  {
+    std::vector<Overlay_job> jobs;
+    jobs.reserve(snc1.number_of_vertices() + snc2.number_of_vertices());
+
+    std::vector<Vertex_const_handle> vertices;
+    std::vector<Object_handle> locations;
+    Vertex_const_iterator vi;
+
+    // the point locations only read the operands
+    CGAL_NEF_TRACEN("=> locating the vertices of snc1 in snc2 (parallel)");
+    CGAL_forall_vertices( vi, snc1)
+      vertices.push_back(vi);
+    locations.resize(vertices.size());
+    tbb::parallel_for(std::size_t(0), vertices.size(), [&](std::size_t i) {
+      locations[i] = pl2->locate(vertices[i]->point());
+    });
+
+    Unique_hash_map<Vertex_const_handle, bool> ignore(false, snc2.number_of_vertices());
+    for(std::size_t i=0; i<vertices.size(); ++i) {
+      Vertex_handle v;
+      if( CGAL::assign( v, locations[i]))
+        ignore[v] = true;
+      jobs.push_back(Overlay_job{Overlay_job::VERTEX_0, vertices[i], locations[i],
+                                 Const_halfedge_handle(), Const_halfedge_handle(),
+                                 Const_halffacet_handle(), Point_3(), false});
+    }
+
+    CGAL_NEF_TRACEN("=> locating the vertices of snc2 in snc1 (parallel)");
+    vertices.clear();
+    CGAL_forall_vertices( vi, snc2)
+      if(!ignore[vi])
+        vertices.push_back(vi);
+    locations.assign(vertices.size(), Object_handle());
+    tbb::parallel_for(std::size_t(0), vertices.size(), [&](std::size_t i) {
+      locations[i] = pl1->locate(vertices[i]->point());
+    });
+
+    for(std::size_t i=0; i<vertices.size(); ++i) {
+      CGAL_assertion_code(Vertex_handle v);
+      CGAL_assertion( !CGAL::assign( v, locations[i]));
+      jobs.push_back(Overlay_job{Overlay_job::VERTEX_1, vertices[i], locations[i],
+                                 Const_halfedge_handle(), Const_halfedge_handle(),
+                                 Const_halffacet_handle(), Point_3(), false});
+    }
+
+    CGAL_NEF_TRACEN("=> intersection tests (parallel)");
+    Intersection_recorder recorder0(jobs, false);
+    Intersection_recorder recorder1(jobs, true);
+    binop_intersection_test_segment_tree<SNC_const_decorator, Parallel_tag> binop_box_intersection;
+    binop_box_intersection(recorder0, recorder1, snc1, snc2);
+
+    // The overlays allocate their sphere maps in the structure they write to,
+    // so consecutive jobs are grouped in chunks, and each chunk is overlaid in
+    // its own structure. The chunks are then cloned into the result in order,
+    // such that the vertices of the result are created in the same order as
+    // with the sequential operation.
+    CGAL_NEF_TRACEN("=> " << jobs.size() << " overlays (parallel)");
+    const std::size_t chunk_size = 16;
+    const std::size_t number_of_chunks = (jobs.size() + chunk_size - 1) / chunk_size;
+    std::vector<SNC_structure> chunks(number_of_chunks);
+    Shared_association<Association> shared_A(A);
+
+    tbb::parallel_for(std::size_t(0), number_of_chunks, [&](std::size_t c) {
+      Binary_operation D(chunks[c]);
+      const std::size_t end = (std::min)(jobs.size(), (c+1) * chunk_size);
+      for(std::size_t i=c*chunk_size; i<end; ++i)
+        D.run_overlay_job(jobs[i], snc1, snc2, BOP, shared_A);
+    });
+
+    SNC_constructor C(*this->sncp());
+    for(SNC_structure& chunk : chunks) {
+      Vertex_iterator v;
+      CGAL_forall_vertices( v, chunk)
+        C.clone_SM(v);
+      chunk.clear();
+    }
+  }
+
+ public:
+#endif // CGAL_LINKED_WITH_TBB
+
   template <typename Selection>
     void operator()( SNC_point_locator* pl0,
                      const SNC_structure& snc1,
@@ -306,6 +567,15 @@ class Binary_operation : public CGAL::SNC_decorator<Map> {
     CGAL_forall_shalfloops(sli, snc2)
       A.initialize_hash(sli);
 
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      parallel_local_views(snc1, pl1, snc2, pl2, BOP, A);
+      SNC_external_structure es(*this->sncp(), pl0);
+      es.build_after_binary_operation(A);
+      return;
+    }
+#endif
+
     CGAL_forall_vertices( v0, snc1) {
       CGAL_assertion(!ignore[v0]);
       Point_3 p0(v0->point());
@@ -18,12 +18,29 @@
 #include <CGAL/Nef_3/Nef_box.h>
 #include <CGAL/Nef_3/Infimaximal_box.h>
 #include <CGAL/Nef_3/SNC_const_decorator.h>
+#include <CGAL/box_intersection_d.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/concurrent_vector.h>
+#include <tbb/parallel_sort.h>
+#endif
+
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace CGAL {
 
-template<class SNC_decorator>
+// With `Parallel_tag`, the candidate pairs are tested in parallel, but the
+// callbacks are still called sequentially, once all the tests are done.
+template<class SNC_decorator, class ConcurrencyTag = Sequential_tag>
 struct binop_intersection_test_segment_tree {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
   typedef typename SNC_decorator::SNC_structure          SNC_structure;
   typedef typename CGAL::SNC_intersection<SNC_structure> SNC_intersection;
 
@@ -126,6 +143,13 @@ struct binop_intersection_test_segment_tree {
     CGAL_forall_facets( f0, snc0) f0boxes.push_back( Nef_box( f0 ) );
     CGAL_forall_facets( f1, snc1) f1boxes.push_back( Nef_box( f1 ) );
 
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      parallel_tests(cb0, cb1, e0boxes, e1boxes, f0boxes, f1boxes);
+      return;
+    }
+#endif
+
     CGAL_NEF_TRACEN("start edge0 edge1");
     Bop_edge0_edge1_callback<Callback> callback_edge0_edge1( cb0 );
     box_intersection_d( e0boxes.begin(), e0boxes.end(),
@@ -144,6 +168,101 @@ struct binop_intersection_test_segment_tree {
                         f0boxes.begin(), f0boxes.end(),
                         callback_edge1_face0);
   }
+
+#ifdef CGAL_LINKED_WITH_TBB
+ private:
+  template<class Handle>
+  struct Intersection {
+    Halfedge_iterator e;
+    Handle h;
+    Point_3 ip;
+    std::size_t id0, id1;
+  };
+
+  // stores the intersections found concurrently by the `Bop_*_callback` functors,
+  // together with the ids of the two boxes
+  template<class Handle>
+  struct Intersection_recorder {
+    tbb::concurrent_vector<Intersection<Handle> >& out;
+    std::size_t id0, id1;
+
+    Intersection_recorder(tbb::concurrent_vector<Intersection<Handle> >& out,
+                          std::size_t id0, std::size_t id1)
+    : out(out), id0(id0), id1(id1)
+    {}
+
+    void operator()(Halfedge_iterator e, Handle h, const Point_3& ip) {
+      out.push_back(Intersection<Handle>{e, h, ip, id0, id1});
+    }
+  };
+
+  template<template<class> class Bop_callback, class Handle>
+  struct Recording_callback {
+    tbb::concurrent_vector<Intersection<Handle> >& out;
+
+    Recording_callback(tbb::concurrent_vector<Intersection<Handle> >& out)
+    : out(out)
+    {}
+
+    void operator()( Nef_box& box0, Nef_box& box1 ) {
+      Intersection_recorder<Handle> recorder(out, box0.id(), box1.id());
+      Bop_callback<Intersection_recorder<Handle> > callback(recorder);
+      callback(box0, box1);
+    }
+  };
+
+  // the order in which the boxes are reported depends on the scheduling,
+  // so the intersections are sorted before calling back to keep the
+  // construction of the result deterministic. The ids of the boxes, which are
+  // numbered in the order of the halfedges and halffacets, break the ties
+  // between intersections at the same point
+  template<class Handle, class Callback>
+  static void report(tbb::concurrent_vector<Intersection<Handle> >& intersections,
+                     Callback& cb)
+  {
+    std::vector<Intersection<Handle> > sorted(intersections.begin(), intersections.end());
+    tbb::parallel_sort(sorted.begin(), sorted.end(),
+                       [](const Intersection<Handle>& i, const Intersection<Handle>& j) {
+                         CGAL::Comparison_result c = CGAL::compare_xyz(i.ip, j.ip);
+                         if(c != CGAL::EQUAL)
+                           return c == CGAL::SMALLER;
+                         return std::make_pair(i.id0, i.id1) < std::make_pair(j.id0, j.id1);
+                       });
+    for(Intersection<Handle>& i : sorted)
+      cb(i.e, i.h, i.ip);
+  }
+
+  template<class Callback>
+  void parallel_tests(Callback& cb0,
+                      Callback& cb1,
+                      std::vector<Nef_box>& e0boxes,
+                      std::vector<Nef_box>& e1boxes,
+                      std::vector<Nef_box>& f0boxes,
+                      std::vector<Nef_box>& f1boxes)
+  {
+    tbb::concurrent_vector<Intersection<Halfedge_iterator> > edge0_edge1;
+    tbb::concurrent_vector<Intersection<Halffacet_iterator> > edge0_face1, edge1_face0;
+
+    CGAL_NEF_TRACEN("start edge0 edge1 (parallel)");
+    box_intersection_d<Parallel_tag>( e0boxes.begin(), e0boxes.end(),
+                                      e1boxes.begin(), e1boxes.end(),
+                                      Recording_callback<Bop_edge0_edge1_callback, Halfedge_iterator>( edge0_edge1 ));
+
+    CGAL_NEF_TRACEN("start edge0 face1 (parallel)");
+    box_intersection_d<Parallel_tag>( e0boxes.begin(), e0boxes.end(),
+                                      f1boxes.begin(), f1boxes.end(),
+                                      Recording_callback<Bop_edge0_face1_callback, Halffacet_iterator>( edge0_face1 ));
+
+    CGAL_NEF_TRACEN("start edge1 face0 (parallel)");
+    box_intersection_d<Parallel_tag>( e1boxes.begin(), e1boxes.end(),
+                                      f0boxes.begin(), f0boxes.end(),
+                                      Recording_callback<Bop_edge1_face0_callback, Halffacet_iterator>( edge1_face0 ));
+
+    report(edge0_edge1, cb0);
+    report(edge0_face1, cb0);
+    report(edge1_face0, cb1);
+  }
+#endif // CGAL_LINKED_WITH_TBB
 };
 
 } //namespace CGAL
@@ -52,6 +52,7 @@
 #include <CGAL/boost/graph/graph_traits_Polyhedron_3.h>
 #include <CGAL/Nef_3/SNC_point_locator.h>
 #include <CGAL/assertions.h>
+#include <CGAL/tags.h>
 
 #include <CGAL/Constrained_triangulation_2.h>
 #include <CGAL/Triangulation_data_structure_2.h>
@@ -1399,6 +1400,7 @@ protected:
     return res;
   }
 
+  template <typename ConcurrencyTag = Sequential_tag>
   Nef_polyhedron_3<Kernel,Items, Mark>
   intersection(const Nef_polyhedron_3<Kernel,Items, Mark>& N1) const
     /*{\Mop returns |\Mvar| $\cap$ |N1|. }*/ {
@@ -1409,7 +1411,7 @@ protected:
     if (N1.is_space()) return *this;
     AND _and;
     Nef_polyhedron_3<Kernel,Items, Mark> res(Private_tag{});
-    Binary_operation bo( res.snc());
+    CGAL::Binary_operation<SNC_structure, ConcurrencyTag> bo(res.snc());
     bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _and);
     return res;
   }
@@ -1425,6 +1427,7 @@ protected:
     return res;
   }
 
+  template <typename ConcurrencyTag = Sequential_tag>
   Nef_polyhedron_3<Kernel,Items, Mark>
   join(const Nef_polyhedron_3<Kernel,Items, Mark>& N1) const
   /*{\Mop returns |\Mvar| $\cup$ |N1|. }*/ {
@@ -1436,11 +1439,12 @@ protected:
     OR _or;
     //CGAL::binop_intersection_tests_allpairs<SNC_decorator, OR> tests_impl;
     Nef_polyhedron_3<Kernel,Items, Mark> res(Private_tag{});
-    Binary_operation bo(res.snc());
+    CGAL::Binary_operation<SNC_structure, ConcurrencyTag> bo(res.snc());
     bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _or);
     return res;
   }
 
+  template <typename ConcurrencyTag = Sequential_tag>
   Nef_polyhedron_3<Kernel,Items, Mark>
   difference(const Nef_polyhedron_3<Kernel,Items, Mark>& N1) const
   /*{\Mop returns |\Mvar| $-$ |N1|. }*/ {
@@ -1452,11 +1456,12 @@ protected:
     DIFF _diff;
     //CGAL::binop_intersection_tests_allpairs<SNC_decorator, DIFF> tests_impl;
     Nef_polyhedron_3<Kernel,Items, Mark> res(Private_tag{});
-    Binary_operation bo(res.snc());
+    CGAL::Binary_operation<SNC_structure, ConcurrencyTag> bo(res.snc());
     bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _diff);
     return res;
   }
 
+  template <typename ConcurrencyTag = Sequential_tag>
   Nef_polyhedron_3<Kernel,Items, Mark>
   symmetric_difference(const Nef_polyhedron_3<Kernel,Items, Mark>& N1) const
   /*{\Mop returns the symmectric difference |\Mvar - T| $\cup$
@@ -1469,7 +1474,7 @@ protected:
     XOR _xor;
     //CGAL::binop_intersection_tests_allpairs<SNC_decorator, XOR> tests_impl;
     Nef_polyhedron_3<Kernel,Items, Mark> res(Private_tag{});
-    Binary_operation bo(res.snc());
+    CGAL::Binary_operation<SNC_structure, ConcurrencyTag> bo(res.snc());
     bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _xor);
     return res;
   }
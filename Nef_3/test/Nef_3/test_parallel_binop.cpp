@@ -0,0 +1,101 @@
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Nef_polyhedron_3.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Polygon_mesh_processing/transform.h>
+#include <CGAL/Aff_transformation_3.h>
+#include <CGAL/boost/graph/IO/polygon_mesh_io.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+#endif
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
+typedef Kernel::Vector_3                                  Vector_3;
+typedef CGAL::Surface_mesh<Kernel::Point_3>               Mesh;
+typedef CGAL::Nef_polyhedron_3<Kernel>                    Nef_polyhedron;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+Nef_polyhedron read_nef(const std::string& filename, const Vector_3& translation)
+{
+  Mesh mesh;
+  if(!CGAL::IO::read_polygon_mesh(filename, mesh))
+  {
+    std::cerr << "Error: cannot read " << filename << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  CGAL::Polygon_mesh_processing::transform(Kernel::Aff_transformation_3(CGAL::Translation(), translation), mesh);
+  return Nef_polyhedron(mesh);
+}
+
+void check_same(Nef_polyhedron N, const Nef_polyhedron& seq_N)
+{
+  std::cout << N.number_of_vertices() << " vertices, "
+            << N.number_of_facets() << " facets, "
+            << N.number_of_volumes() << " volumes ("
+            << seq_N.number_of_vertices() << ", "
+            << seq_N.number_of_facets() << ", "
+            << seq_N.number_of_volumes() << " sequentially)" << std::endl;
+
+  assert(N.number_of_vertices() == seq_N.number_of_vertices());
+  assert(N.number_of_halfedges() == seq_N.number_of_halfedges());
+  assert(N.number_of_facets() == seq_N.number_of_facets());
+  assert(N.number_of_volumes() == seq_N.number_of_volumes());
+  assert(N == seq_N);
+}
+
+void test_binary_operations(const Nef_polyhedron& N0, const Nef_polyhedron& N1)
+{
+  std::cout << "  join" << std::endl;
+  check_same(N0.join<Concurrency_tag>(N1), N0.join(N1));
+  std::cout << "  intersection" << std::endl;
+  check_same(N0.intersection<Concurrency_tag>(N1), N0.intersection(N1));
+  std::cout << "  difference" << std::endl;
+  check_same(N0.difference<Concurrency_tag>(N1), N0.difference(N1));
+  std::cout << "  symmetric difference" << std::endl;
+  check_same(N0.symmetric_difference<Concurrency_tag>(N1), N0.symmetric_difference(N1));
+}
+
+void test()
+{
+  std::cout << "== sphere and cross" << std::endl;
+  Nef_polyhedron sphere = read_nef(CGAL::data_file_path("meshes/sphere.off"), Vector_3(0.1, 0.2, 0.3));
+  Nef_polyhedron cross = read_nef(CGAL::data_file_path("meshes/cross.off"), Vector_3(0, 0, 0));
+  test_binary_operations(sphere, cross);
+
+  // non-manifold operands, made of a solid and of lower-dimensional features
+  std::cout << "== cross with the sphere boundary, and the cross boundary" << std::endl;
+  Nef_polyhedron cross_and_boundary = cross.join(sphere.boundary());
+  test_binary_operations(cross_and_boundary, cross.boundary());
+
+  // disjoint operands, where all the vertices are located in volumes
+  std::cout << "== cross and a distant sphere" << std::endl;
+  Nef_polyhedron far_sphere = read_nef(CGAL::data_file_path("meshes/sphere.off"), Vector_3(100, 0, 0));
+  test_binary_operations(cross, far_sphere);
+}
+
+int main()
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  // run the operations with several threads, whatever the number of cores
+  tbb::global_control c(tbb::global_control::max_allowed_parallelism, 4);
+  tbb::task_arena arena(4);
+  arena.execute([]{ test(); });
+#else
+  test();
+#endif
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
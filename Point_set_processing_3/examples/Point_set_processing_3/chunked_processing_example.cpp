@@ -0,0 +1,87 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Chunked_point_set_processor.h>
+#include <CGAL/compute_average_spacing.h>
+#include <CGAL/jet_estimate_normals.h>
+#include <CGAL/remove_outliers.h>
+#include <CGAL/IO/read_xyz_points.h>
+#include <CGAL/property_map.h>
+
+#include <boost/iterator/function_output_iterator.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <utility>
+
+// types
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point;
+typedef Kernel::Vector_3 Vector;
+typedef std::pair<Point, Vector> Point_with_normal;
+typedef CGAL::First_of_pair_property_map<Point_with_normal> Point_map;
+typedef CGAL::Second_of_pair_property_map<Point_with_normal> Normal_map;
+
+int main(int argc, char*argv[])
+{
+  // The points of the input file must be sorted along the x axis
+  const std::string fname = (argc>1) ? argv[1] : CGAL::data_file_path("points_3/poste_france.xyz");
+  const std::size_t chunk_size = (argc>2) ? std::atoi(argv[2]) : 1000;
+  const double halo = (argc>3) ? std::atof(argv[3]) : 2.;
+  const unsigned int nb_neighbors = 18;
+
+  std::ifstream input(fname);
+  std::ofstream output("out_chunked.xyz");
+  output.precision(17);
+
+  // The processed points are written as soon as their chunk is processed
+  std::size_t nb_output = 0;
+  auto write_point = boost::make_function_output_iterator
+    ([&](const Point_with_normal& pwn)
+     {
+       output << pwn.first << " " << pwn.second << "\n";
+       ++ nb_output;
+     });
+
+  // The average spacing is estimated on each chunk (with its halo)
+  double sum_spacing = 0.;
+  std::size_t nb_chunk_points = 0;
+
+  auto processor = CGAL::make_chunked_point_set_processor<Point_with_normal>
+    ([&](auto& chunk)
+     {
+       const double spacing = CGAL::compute_average_spacing<CGAL::Sequential_tag>
+         (chunk.indices(), nb_neighbors, CGAL::parameters::point_map(chunk.point_map()));
+       sum_spacing += spacing * chunk.number_of_points_in_chunk();
+       nb_chunk_points += chunk.number_of_points_in_chunk();
+
+       // Points farther than 2 * average spacing are considered outliers
+       chunk.remove(CGAL::remove_outliers<CGAL::Sequential_tag>
+                      (chunk.indices(), nb_neighbors,
+                       CGAL::parameters::point_map(chunk.point_map())
+                                        .threshold_percent(100.)
+                                        .threshold_distance(2. * spacing)));
+
+       // Normals are estimated on the remaining points
+       CGAL::jet_estimate_normals<CGAL::Sequential_tag>
+         (chunk.indices(), nb_neighbors,
+          CGAL::parameters::point_map(chunk.point_map())
+                           .normal_map(chunk.property_map(Normal_map())));
+     },
+     write_point, chunk_size, halo, 0,
+     CGAL::parameters::point_map(Point_map()));
+
+  // Only the current chunk and its halo are held in memory while reading
+  if(!CGAL::IO::read_XYZ(input, processor.inserter(),
+                         CGAL::parameters::point_map(Point_map()).normal_map(Normal_map())))
+  {
+    std::cerr << "Error: cannot read file " << fname << std::endl;
+    return EXIT_FAILURE;
+  }
+  processor.finish();
+
+  std::cout << nb_output << " points written out of " << nb_chunk_points
+            << ", average spacing " << sum_spacing / nb_chunk_points << std::endl;
+
+  return EXIT_SUCCESS;
+}
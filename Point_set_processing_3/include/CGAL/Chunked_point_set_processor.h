@@ -0,0 +1,402 @@
+// Copyright (c) 2026 agent.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent
+
+#ifndef CGAL_CHUNKED_POINT_SET_PROCESSOR_H
+#define CGAL_CHUNKED_POINT_SET_PROCESSOR_H
+
+#include <CGAL/license/Point_set_processing_3.h>
+
+#include <CGAL/assertions.h>
+#include <CGAL/property_map.h>
+
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <vector>
+
+namespace CGAL {
+
+/**
+   \ingroup PkgPointSetProcessing3Algorithms
+
+   \brief processes a stream of points chunk by chunk, so that the memory used
+   is bounded by the size of the chunks rather than by the size of the point set.
+
+   The points are inserted one after the other, for example by passing `inserter()`
+   to a reader such as `CGAL::IO::read_PLY()`, `CGAL::IO::read_LAS()` or `CGAL::IO::read_XYZ()`.
+   They must be sorted along one of the coordinate axes (the \f$x\f$ axis by default).
+   A tiled input can be streamed by sorting each tile before inserting it, as long as the
+   tiles themselves come in the order of the axis.
+
+   The points are split into chunks of `chunk_size` consecutive points. As soon as
+   all the points whose distance to a chunk is smaller than `halo` have been inserted,
+   the chunk function is called on the chunk together with these neighboring points.
+   The points of the chunk that the function did not remove are then written to the
+   output iterator, in the order of insertion, and the points that can no longer be
+   neighbors of the next chunks are discarded.
+
+   The chunk function is called with a `Chunk&`. It typically calls functions of this
+   package on the index range `Chunk::indices()`, with the property maps of the chunk:
+   \code
+   [&](auto& chunk)
+   {
+     // functions that remove points return the first index to remove
+     chunk.remove(CGAL::remove_outliers<CGAL::Sequential_tag>
+                    (chunk.indices(), k, CGAL::parameters::point_map(chunk.point_map())
+                                                          .threshold_percent(100.)
+                                                          .threshold_distance(d)));
+     CGAL::jet_estimate_normals<CGAL::Sequential_tag>
+       (chunk.indices(), k, CGAL::parameters::point_map(chunk.point_map())
+                                             .normal_map(chunk.property_map(normal_map)));
+   }
+   \endcode
+   The points of a chunk are copies, so the modifications made by the chunk function to the
+   neighboring points do not change the points that are processed with the next chunks.
+
+   If the result for a point only depends on the points closer than `halo`, for example
+   if `halo` is larger than the `neighbor_radius` or than the distance to the `k`-th nearest
+   neighbor, the output is the same as if the function was called on the whole point set.
+   When the chunk function calls several functions in a row, as above, `halo` should cover the
+   sum of their neighborhood sizes.
+   Functions that depend on global quantities, such as the percentage of outliers of
+   `CGAL::remove_outliers()`, the bandwidth of `CGAL::bilateral_smooth_point_set()` or the
+   average returned by `CGAL::compute_average_spacing()`, compute these quantities per chunk.
+
+   \tparam Value the type of the inserted points
+   \tparam ChunkFunction a functor with an operator `void operator()(Chunk&)`
+   \tparam OutputIterator a model of `OutputIterator` accepting objects of type `Value`
+   \tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
+   \cgalNamedParamsBegin
+     \cgalParamNBegin{point_map}
+       \cgalParamDescription{a property map associating points to the values of type `Value`}
+       \cgalParamType{a model of `LvaluePropertyMap` whose key type is `Value`
+                      and whose value type is `geom_traits::Point_3`}
+       \cgalParamDefault{`CGAL::Identity_property_map<geom_traits::Point_3>`}
+     \cgalParamNEnd
+
+     \cgalParamNBegin{geom_traits}
+       \cgalParamDescription{an instance of a geometric traits class}
+       \cgalParamType{a model of `Kernel`}
+       \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+     \cgalParamNEnd
+   \cgalNamedParamsEnd
+
+   \sa `CGAL::make_chunked_point_set_processor()`
+*/
+template <typename Value,
+          typename ChunkFunction,
+          typename OutputIterator,
+          typename NamedParameters = parameters::Default_named_parameters>
+class Chunked_point_set_processor
+{
+  typedef Point_set_processing_3_np_helper<std::vector<Value>, NamedParameters> NP_helper;
+
+public:
+
+  /// \name Types
+  /// @{
+
+  /// the type of the inserted points
+  typedef Value value_type;
+
+  /// the point map of the inserted points
+  typedef typename NP_helper::Point_map Point_map;
+
+  /// the geometric traits class
+  typedef typename NP_helper::Geom_traits Geom_traits;
+
+  /// the number type
+  typedef typename Geom_traits::FT FT;
+
+  /*!
+    \brief a chunk of points, together with the points closer than the halo.
+
+    The points of the chunk are accessed through a range of indices, which can be
+    passed to the functions of this package along with the property maps of the chunk.
+  */
+  class Chunk
+  {
+  public:
+
+    /// the range of indices of the points
+    typedef std::vector<std::size_t> Index_range;
+
+    /// the property map from indices to values
+    typedef typename Pointer_property_map<Value>::type Value_map;
+
+    /// the property map from indices to the property given by `PropertyMap`
+    template <typename PropertyMap>
+    using Property_map = Compose_property_map<Value_map, PropertyMap>;
+
+    /// the property map from indices to points
+    typedef Property_map<typename Chunked_point_set_processor::Point_map> Point_map;
+
+  private:
+
+    friend class Chunked_point_set_processor;
+
+    std::vector<Value> m_points;
+    Index_range m_indices;
+    std::size_t m_core_begin;
+    std::size_t m_core_end;
+    typename Chunked_point_set_processor::Point_map m_point_map;
+
+    Chunk(typename Chunked_point_set_processor::Point_map point_map)
+      : m_core_begin(0), m_core_end(0), m_point_map(point_map)
+    { }
+
+  public:
+
+    /// returns the indices of the points that were not removed. Initially,
+    /// all the points of the chunk and of its halo are listed, in the order of insertion.
+    Index_range& indices() { return m_indices; }
+
+    /// returns the points of the chunk and of its halo, in the order of insertion.
+    std::vector<Value>& points() { return m_points; }
+
+    /// returns `true` if the point of index `i` belongs to the chunk, and `false` if it belongs to the halo.
+    bool is_in_chunk(std::size_t i) const { return m_core_begin <= i && i < m_core_end; }
+
+    /// returns the number of points of the chunk, halo excluded.
+    std::size_t number_of_points_in_chunk() const { return m_core_end - m_core_begin; }
+
+    /// removes the points whose indices are in `[first, indices().end())`.
+    void remove(typename Index_range::iterator first) { m_indices.erase(first, m_indices.end()); }
+
+    /// returns a property map from indices to points.
+    Point_map point_map() { return property_map(m_point_map); }
+
+    /// returns a property map from indices to the property given by `property_map`,
+    /// for example a normal map of the values of type `Value`.
+    template <typename PropertyMap>
+    Property_map<PropertyMap> property_map(PropertyMap property_map)
+    {
+      return Property_map<PropertyMap>(make_property_map(m_points), property_map);
+    }
+  };
+
+  /*!
+    an output iterator that inserts the values assigned to it in the processor.
+  */
+  class Inserter
+  {
+    Chunked_point_set_processor* m_processor;
+
+  public:
+
+    typedef std::output_iterator_tag iterator_category;
+    typedef Value value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef void pointer;
+    typedef void reference;
+
+    Inserter(Chunked_point_set_processor& processor) : m_processor(&processor) { }
+
+    Inserter& operator=(const Value& value) { m_processor->insert(value); return *this; }
+    Inserter& operator*() { return *this; }
+    Inserter& operator++() { return *this; }
+    Inserter& operator++(int) { return *this; }
+  };
+
+  /// @}
+
+private:
+
+  ChunkFunction m_chunk_function;
+  OutputIterator m_output;
+  std::size_t m_chunk_size;
+  FT m_halo;
+  int m_axis;
+  Point_map m_point_map;
+
+  // the points of the halo of the next chunk, followed by the points not processed yet
+  std::deque<Value> m_buffer;
+  std::size_t m_first_unprocessed;
+
+  Chunk m_chunk;
+  std::vector<bool> m_is_kept;
+
+public:
+
+  /// \name Creation
+  /// @{
+
+  /*!
+    creates a processor calling `chunk_function` on chunks of `chunk_size` points,
+    with their neighbors closer than `halo`, and writing the points of the chunks to `output`.
+
+    \param chunk_function the function called on each chunk
+    \param output the output iterator
+    \param chunk_size the number of points of the chunks
+    \param halo the distance up to which the neighbors of the chunks are given to `chunk_function`
+    \param axis the coordinate axis along which the points are sorted
+    \param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed above
+
+    \pre `chunk_size > 0`
+    \pre `halo >= 0`
+    \pre `axis` is `0`, `1` or `2`
+  */
+  Chunked_point_set_processor(const ChunkFunction& chunk_function,
+                              OutputIterator output,
+                              std::size_t chunk_size,
+                              FT halo,
+                              int axis = 0,
+                              const NamedParameters& np = parameters::default_values())
+    : m_chunk_function(chunk_function)
+    , m_output(output)
+    , m_chunk_size(chunk_size)
+    , m_halo(halo)
+    , m_axis(axis)
+    , m_point_map(NP_helper::get_point_map(np))
+    , m_first_unprocessed(0)
+    , m_chunk(m_point_map)
+  {
+    CGAL_precondition(chunk_size > 0);
+    CGAL_precondition(halo >= FT(0));
+    CGAL_precondition(0 <= axis && axis < 3);
+  }
+
+  /// @}
+
+  /// \name Operations
+  /// @{
+
+  /*!
+    inserts `value`, and processes the chunks whose halos are complete.
+
+    \pre The coordinate of `value` along the axis is not smaller than the one of the previously inserted point.
+  */
+  void insert(const Value& value)
+  {
+    CGAL_precondition(m_buffer.empty() || coordinate(m_buffer.back()) <= coordinate(value));
+    m_buffer.push_back(value);
+
+    // once a point is farther than the halo from the last point of the next chunk,
+    // the points inserted later cannot be in the halo of this chunk either
+    while(m_buffer.size() - m_first_unprocessed > m_chunk_size
+          && coordinate(m_buffer.back()) > coordinate(m_buffer[m_first_unprocessed + m_chunk_size - 1]) + m_halo)
+      process_chunk(m_first_unprocessed + m_chunk_size);
+  }
+
+  /// inserts the values of the range `[first, beyond)`.
+  template <typename InputIterator>
+  void insert(InputIterator first, InputIterator beyond)
+  {
+    for(; first != beyond; ++ first)
+      insert(*first);
+  }
+
+  /// returns an output iterator that inserts the values assigned to it.
+  Inserter inserter() { return Inserter(*this); }
+
+  /*!
+    processes the remaining points, at the end of the stream.
+
+    After this call, the processor is empty and can be used for another stream.
+  */
+  void finish()
+  {
+    while(m_first_unprocessed < m_buffer.size())
+      process_chunk((std::min)(m_first_unprocessed + m_chunk_size, m_buffer.size()));
+
+    m_buffer.clear();
+    m_first_unprocessed = 0;
+  }
+
+  /// @}
+
+  /// \name Access
+  /// @{
+
+  /// returns the number of points currently held by the processor.
+  std::size_t number_of_buffered_points() const { return m_buffer.size(); }
+
+  /// returns the output iterator, past the points written so far.
+  OutputIterator output() const { return m_output; }
+
+  /// @}
+
+private:
+
+  FT coordinate(const Value& value) const
+  {
+    return get(m_point_map, value)[m_axis];
+  }
+
+  // processes the points of indices [m_first_unprocessed, chunk_end) of the buffer
+  void process_chunk(std::size_t chunk_end)
+  {
+    const FT halo_end = coordinate(m_buffer[chunk_end - 1]) + m_halo;
+    std::size_t buffer_end = chunk_end;
+    while(buffer_end < m_buffer.size() && coordinate(m_buffer[buffer_end]) <= halo_end)
+      ++ buffer_end;
+
+    m_chunk.m_points.assign(m_buffer.begin(), m_buffer.begin() + buffer_end);
+    m_chunk.m_indices.resize(buffer_end);
+    for(std::size_t i = 0; i < buffer_end; ++ i)
+      m_chunk.m_indices[i] = i;
+    m_chunk.m_core_begin = m_first_unprocessed;
+    m_chunk.m_core_end = chunk_end;
+
+    m_chunk_function(m_chunk);
+
+    m_is_kept.assign(chunk_end - m_first_unprocessed, false);
+    for(std::size_t i : m_chunk.m_indices)
+      if(m_chunk.is_in_chunk(i))
+        m_is_kept[i - m_first_unprocessed] = true;
+    for(std::size_t i = m_first_unprocessed; i < chunk_end; ++ i)
+      if(m_is_kept[i - m_first_unprocessed])
+        *(m_output ++) = m_chunk.m_points[i];
+
+    // discards the points that are farther than the halo from the next chunk
+    m_first_unprocessed = chunk_end;
+    if(m_first_unprocessed == m_buffer.size())
+      return;
+    const FT halo_begin = coordinate(m_buffer[m_first_unprocessed]) - m_halo;
+    while(coordinate(m_buffer.front()) < halo_begin)
+    {
+      m_buffer.pop_front();
+      -- m_first_unprocessed;
+    }
+  }
+};
+
+/**
+   \ingroup PkgPointSetProcessing3Algorithms
+
+   creates a `CGAL::Chunked_point_set_processor` for values of type `Value`.
+
+   \sa `CGAL::Chunked_point_set_processor`
+*/
+template <typename Value,
+          typename ChunkFunction,
+          typename OutputIterator,
+          typename NamedParameters = parameters::Default_named_parameters>
+Chunked_point_set_processor<Value, ChunkFunction, OutputIterator, NamedParameters>
+make_chunked_point_set_processor(const ChunkFunction& chunk_function,
+                                 OutputIterator output,
+                                 std::size_t chunk_size,
+                                 double halo,
+                                 int axis = 0,
+                                 const NamedParameters& np = parameters::default_values())
+{
+  return Chunked_point_set_processor<Value, ChunkFunction, OutputIterator, NamedParameters>
+    (chunk_function, output, chunk_size, halo, axis, np);
+}
+
+} // namespace CGAL
+
+#endif // CGAL_CHUNKED_POINT_SET_PROCESSOR_H
@@ -20,6 +20,7 @@
 #include <CGAL/Kernel_traits.h>
 #include <CGAL/assertions.h>
 #include <CGAL/Iterator_range.h>
+#include <CGAL/tags.h>
 #include <functional>
 #include <boost/functional/hash.hpp>
 
@@ -27,11 +28,20 @@
 #include <CGAL/boost/graph/named_params_helper.h>
 
 #include <iterator>
-#include <deque>
 #include <algorithm>
+#include <array>
 #include <cmath>
-#include <unordered_set>
+#include <limits>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
 
 namespace CGAL {
 
@@ -50,133 +60,137 @@ inline double round_epsilon(double value, double epsilon)
   return std::floor(value / epsilon);
 }
 
-/// Utility class for grid_simplify_point_set(): Hash_epsilon_points_3
-/// defines a 3D point hash / 2 points are equal iff they belong to
-/// the same cell of a grid of cell size = epsilon.
-template <class Point_3, class PointMap>
-struct Hash_epsilon_points_3
-{
-private:
-
-    double m_epsilon;
-    PointMap point_map;
-    typedef typename boost::property_traits<PointMap>::value_type Point;
-public:
+/// Utility types for grid_simplify_point_set(): a cell of the grid of
+/// cell size = epsilon, given by the rounded coordinates of its points.
+typedef std::array<double, 3> Grid_cell_3;
 
-    Hash_epsilon_points_3 (double epsilon, PointMap p_map)
-        : m_epsilon (epsilon), point_map(p_map)
-    {
-        CGAL_precondition(epsilon > 0);
-    }
-
-  std::size_t operator() (const Point_3& a) const
+struct Hash_grid_cell_3
+{
+  std::size_t operator() (const Grid_cell_3& cell) const
   {
-    const Point& pa = get(point_map,a);
-    std::size_t result = boost::hash_value(round_epsilon(pa.x(), m_epsilon));
-    boost::hash_combine(result, boost::hash_value(round_epsilon(pa.y(), m_epsilon)));
-    boost::hash_combine(result, boost::hash_value(round_epsilon(pa.z(), m_epsilon)));
+    std::size_t result = boost::hash_value(cell[0]);
+    boost::hash_combine(result, boost::hash_value(cell[1]));
+    boost::hash_combine(result, boost::hash_value(cell[2]));
     return result;
   }
-
 };
 
-/// Utility class for grid_simplify_point_set(): Hash_epsilon_points_3
-/// defines a 3D point equality / 2 points are equal iff they belong
-/// to the same cell of a grid of cell size = epsilon.
-template <class Point_3, class PointMap>
-struct Equal_epsilon_points_3
+template <class Point>
+Grid_cell_3 grid_cell_3 (const Point& p, double epsilon)
 {
-private:
-
-    const double m_epsilon;
-    PointMap point_map;
-    typedef typename boost::property_traits<PointMap>::value_type Point;
-public:
-
-    Equal_epsilon_points_3 (const double& epsilon, PointMap p_map)
-        : m_epsilon (epsilon), point_map(p_map)
-    {
-        CGAL_precondition(epsilon > 0);
-    }
-
-    bool operator() (const Point_3& a, const Point_3& b) const
-    {
-      const Point& pa = get(point_map,a);
-      const Point& pb = get(point_map,b);
-
-      double ra = round_epsilon(pa.x(), m_epsilon);
-      double rb = round_epsilon(pb.x(), m_epsilon);
-      if (ra != rb)
-        return false;
-      ra = round_epsilon(pa.y(), m_epsilon);
-      rb = round_epsilon(pb.y(), m_epsilon);
-      if (ra != rb)
-        return false;
-      ra = round_epsilon(pa.z(), m_epsilon);
-      rb = round_epsilon(pb.z(), m_epsilon);
-      return ra == rb;
-    }
-};
-
-template <typename Point_3, typename PointMap, typename UseMap>
-using Epsilon_point_set_3_base
-= typename std::conditional
-  <UseMap::value,
-   std::unordered_map<Point_3, std::size_t,
-                      internal::Hash_epsilon_points_3<Point_3, PointMap>,
-                      internal::Equal_epsilon_points_3<Point_3, PointMap> >,
-   std::unordered_set<Point_3,
-                      internal::Hash_epsilon_points_3<Point_3, PointMap>,
-                      internal::Equal_epsilon_points_3<Point_3, PointMap> > >::type;
-
-/// Utility class for grid_simplify_point_set():
-/// 3D points set which allows at most 1 (or N) point per cell
-/// of a grid of cell size = epsilon.
-///
-/// Warning:
-/// This class is a container sorted wrt points position
-/// => you should not modify directly the order or the position of points.
-
-template <class Point_3, class PointMap, class UseMap>
-class Epsilon_point_set_3 : public internal::Epsilon_point_set_3_base<Point_3, PointMap, UseMap>
+  return {{ round_epsilon(p.x(), epsilon),
+            round_epsilon(p.y(), epsilon),
+            round_epsilon(p.z(), epsilon) }};
+}
 
+/// Utility class for grid_simplify_point_set(): for each occupied
+/// cell, the index of its first point and its number of points.
+struct Grid_cell_points
 {
-private:
+  std::size_t first = (std::numeric_limits<std::size_t>::max)();
+  std::size_t size = 0;
 
-  // superclass
-  using Base = internal::Epsilon_point_set_3_base<Point_3, PointMap, UseMap>;
-
-  unsigned int min_points_per_cell;
-
-public:
-
-  Epsilon_point_set_3 (double epsilon, PointMap point_map, unsigned int min_points_per_cell = 1)
-    : Base(10, internal::Hash_epsilon_points_3<Point_3, PointMap>(epsilon, point_map),
-           internal::Equal_epsilon_points_3<Point_3, PointMap>(epsilon, point_map))
-    , min_points_per_cell (min_points_per_cell)
+  void insert (std::size_t index)
   {
-    CGAL_precondition(epsilon > 0);
+    first = (std::min)(first, index);
+    ++ size;
   }
 
-  bool insert (const Point_3& p)
+  void merge (const Grid_cell_points& other)
   {
-    return insert (p, UseMap());
+    first = (std::min)(first, other.first);
+    size += other.size;
   }
+};
 
-private:
+typedef std::unordered_map<Grid_cell_3, Grid_cell_points, Hash_grid_cell_3> Grid_cell_map_3;
+
+/// Marks the first point (in the order of `points`) of each cell of
+/// the grid containing at least `min_points_per_cell` points.
+template <typename PointRange, typename PointMap>
+void grid_simplify_mark_points (const PointRange& points,
+                                PointMap point_map,
+                                double epsilon,
+                                unsigned int min_points_per_cell,
+                                std::vector<unsigned char>& keep,
+                                const Sequential_tag&)
+{
+  Grid_cell_map_3 cells;
+  std::size_t index = 0;
+  for (const auto& p : points)
+    cells[grid_cell_3(get(point_map, p), epsilon)].insert(index ++);
+
+  for (const auto& c : cells)
+    if (c.second.size >= min_points_per_cell)
+      keep[c.second.first] = 1;
+}
 
-  bool insert (const Point_3& p, const Tag_true&)
-  {
-    auto iter = Base::insert(std::make_pair (p, 0));
-    iter.first->second ++;
-    return iter.first->second == min_points_per_cell;
-  }
+#ifdef CGAL_LINKED_WITH_TBB
+template <typename PointRange, typename PointMap>
+void grid_simplify_mark_points (const PointRange& points,
+                                PointMap point_map,
+                                double epsilon,
+                                unsigned int min_points_per_cell,
+                                std::vector<unsigned char>& keep,
+                                const Parallel_tag&)
+{
+  typedef typename PointRange::const_iterator const_iterator;
 
-  bool insert (const Point_3& p, const Tag_false&)
+  // Access to the points by index, copying the iterators if needed
+  std::vector<const_iterator> iterators;
+  if constexpr (!std::is_convertible<typename std::iterator_traits<const_iterator>::iterator_category,
+                                     std::random_access_iterator_tag>::value)
   {
-    return Base::insert (p).second;
+    iterators.reserve (keep.size());
+    for (const_iterator it = points.begin(); it != points.end(); ++ it)
+      iterators.push_back (it);
   }
-};
+  const auto point = [&](std::size_t i) -> decltype(get(point_map, *(points.begin()))) {
+    if constexpr (std::is_convertible<typename std::iterator_traits<const_iterator>::iterator_category,
+                                      std::random_access_iterator_tag>::value)
+      return get(point_map, *(points.begin() + i));
+    else
+      return get(point_map, *(iterators[i]));
+  };
+
+  // The cells are binned in per-thread maps, split in shards by hash
+  // value so that the shards can then be merged concurrently
+  const std::size_t nb_shards = 64;
+  tbb::enumerable_thread_specific<std::vector<Grid_cell_map_3> > local_cells
+    ([&]() { return std::vector<Grid_cell_map_3>(nb_shards); });
+
+  tbb::parallel_for (tbb::blocked_range<std::size_t>(0, keep.size()),
+                     [&](const tbb::blocked_range<std::size_t>& r)
+                     {
+                       std::vector<Grid_cell_map_3>& shards = local_cells.local();
+                       for (std::size_t i = r.begin(); i != r.end(); ++ i)
+                       {
+                         const Grid_cell_3 cell = grid_cell_3(point(i), epsilon);
+                         shards[Hash_grid_cell_3()(cell) % nb_shards][cell].insert(i);
+                       }
+                     });
+
+  // The first point of a cell is the minimum index over all threads,
+  // whatever the way the range was split
+  tbb::parallel_for (std::size_t(0), nb_shards,
+                     [&](std::size_t s)
+                     {
+                       Grid_cell_map_3 cells;
+                       for (std::vector<Grid_cell_map_3>& shards : local_cells)
+                       {
+                         if (cells.empty())
+                           cells.swap (shards[s]);
+                         else
+                           for (const auto& c : shards[s])
+                             cells[c.first].merge (c.second);
+                       }
+
+                       for (const auto& c : cells)
+                         if (c.second.size >= min_points_per_cell)
+                           keep[c.second.first] = 1;
+                     });
+}
+#endif
 
 } /* namespace internal */
 
@@ -190,12 +204,16 @@ private:
    \ingroup PkgPointSetProcessing3Algorithms
    Merges points which belong to the same cell of a grid of cell size = `epsilon`.
 
+   The point kept in a cell is the first point of the cell in the order of `points`.
    This method modifies the order of input points so as to pack all remaining points first,
-   and returns an iterator over the first point to remove (see erase-remove idiom).
+   in their input order, and returns an iterator over the first point to remove (see erase-remove idiom).
    For this reason it should not be called on sorted containers.
 
    \pre `epsilon > 0`
 
+   \tparam ConcurrencyTag enables sequential versus parallel algorithm. Possible values are `Sequential_tag`,
+                           `Parallel_tag`, and `Parallel_if_available_tag`. The output is the same
+                           with all values.
    \tparam PointRange is a model of `Range`. The value type of
    its iterator is the key type of the named parameter `point_map`.
 
@@ -230,7 +248,9 @@ private:
 
    \return iterator over the first point to remove.
 */
-template <typename PointRange, typename NamedParameters = parameters::Default_named_parameters>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename PointRange,
+          typename NamedParameters = parameters::Default_named_parameters>
 typename PointRange::iterator
 grid_simplify_point_set(
   PointRange& points,
@@ -240,29 +260,36 @@ grid_simplify_point_set(
   using parameters::choose_parameter;
   using parameters::get_parameter;
 
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
   typedef Point_set_processing_3_np_helper<PointRange, NamedParameters> NP_helper;
   typedef typename NP_helper::Point_map PointMap;
   PointMap point_map = NP_helper::get_point_map(points, np);
 
   unsigned int min_points_per_cell = choose_parameter(get_parameter(np, internal_np::min_points_per_cell), 1);
 
-  // actual type of input points
-  typedef typename std::iterator_traits<typename PointRange::iterator>::value_type Enriched_point;
-
   CGAL_precondition(epsilon > 0);
 
-  if (min_points_per_cell == 1)
-  {
-    // Merges points which belong to the same cell of a grid of cell size = epsilon.
-    // Keep 1 point per occupied cell
-    internal::Epsilon_point_set_3<Enriched_point, PointMap, Tag_false> point_set(epsilon, point_map);
-    return std::partition (points.begin(), points.end(), [&](const auto& p) -> bool { return point_set.insert(p); });
-  }
-  // else
-  // Merges points which belong to the same cell of a grid of cell size = epsilon.
   // Keep 1 point per cell occupied by at least `min_points_per_cell` points
-  internal::Epsilon_point_set_3<Enriched_point, PointMap, Tag_true> point_set(epsilon, point_map, min_points_per_cell);
-  return std::partition (points.begin(), points.end(), [&](const auto& p) -> bool { return point_set.insert(p); });
+  std::vector<unsigned char> keep (std::distance (points.begin(), points.end()), 0);
+  internal::grid_simplify_mark_points (std::as_const(points), point_map, epsilon, min_points_per_cell,
+                                       keep, ConcurrencyTag());
+
+  // Pack the points to keep first, in their input order
+  typename PointRange::iterator first_point_to_remove = points.begin();
+  std::size_t index = 0;
+  for (typename PointRange::iterator it = points.begin(); it != points.end(); ++ it, ++ index)
+    if (keep[index])
+    {
+      if (it != first_point_to_remove)
+        std::iter_swap (it, first_point_to_remove);
+      ++ first_point_to_remove;
+    }
+
+  return first_point_to_remove;
 }
 
 } //namespace CGAL
@@ -18,7 +18,8 @@
 #include <CGAL/disable_warnings.h>
 
 #include <cmath>
-#include <stack>
+#include <list>
+#include <type_traits>
 
 #include <CGAL/property_map.h>
 #include <CGAL/basic.h>
@@ -30,11 +31,17 @@
 #include <CGAL/PCA_util.h>
 #include <CGAL/squared_distance_3.h>
 #include <CGAL/Iterator_range.h>
+#include <CGAL/tags.h>
+#include <CGAL/Point_set_processing_3/internal/Callback_wrapper.h>
 #include <functional>
 
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_invoke.h>
+#endif
+
 namespace CGAL {
 
 
@@ -99,8 +106,273 @@ namespace CGAL {
       points_to_remove.splice (points_to_remove.end (), cluster, cluster.begin (), cluster.end ());
     }
 
+    // We define a cluster as a point set + its centroid (useful for
+    // faster computations of centroids - to be implemented)
+    template <typename Input_type, typename Point>
+    using hsps_cluster = std::pair< std::list<Input_type>, Point >;
+
+    // Processes the first cluster of `clusters_stack`: either splits it,
+    // the negative side being pushed at the front of the stack, or
+    // terminates it. Returns the number of points which are done.
+    template < typename DiagonalizeTraits,
+               typename Input_type,
+               typename PointMap,
+               typename K >
+    std::size_t
+    hsps_process_first_cluster (std::list<hsps_cluster<Input_type, typename K::Point_3> >& clusters_stack,
+                                std::list<Input_type>& points_to_keep,
+                                std::list<Input_type>& points_to_remove,
+                                PointMap& point_map,
+                                unsigned int size,
+                                double var_max,
+                                const K&)
+    {
+      typedef typename K::Point_3 Point;
+      typedef typename K::Vector_3 Vector;
+      typedef typename K::FT FT;
+      typedef hsps_cluster<Input_type, Point> cluster;
+      typedef typename std::list<cluster>::iterator cluster_iterator;
+      typedef K Kernel;
+
+      std::size_t nb_done = 0;
+
+      cluster_iterator current_cluster = clusters_stack.begin ();
+
+      // If the cluster only has 1 element, we add it to the list of
+      // output points
+      if (current_cluster->first.size () == 1)
+        {
+          points_to_keep.splice (points_to_keep.end (), current_cluster->first,
+                                 current_cluster->first.begin ());
+          clusters_stack.pop_front ();
+          ++ nb_done;
+          return nb_done;
+        }
+
+      // Compute the covariance matrix of the set
+      std::array<double, 6> covariance = {{ 0., 0., 0., 0., 0., 0. }};
 
+      for (typename std::list<Input_type>::iterator it = current_cluster->first.begin ();
+           it != current_cluster->first.end (); ++ it)
+        {
+          const Point& point = get(point_map, *it);
+          Vector d = point - current_cluster->second;
+          covariance[0] += d.x () * d.x ();
+          covariance[1] += d.x () * d.y ();
+          covariance[2] += d.x () * d.z ();
+          covariance[3] += d.y () * d.y ();
+          covariance[4] += d.y () * d.z ();
+          covariance[5] += d.z () * d.z ();
+        }
 
+      std::array<double, 3> eigenvalues = {{ 0., 0., 0. }};
+      std::array<double, 9> eigenvectors = {{ 0., 0., 0.,
+                                            0., 0., 0.,
+                                            0., 0., 0. }};
+      // Linear algebra = get eigenvalues and eigenvectors for
+      // PCA-like analysis
+      DiagonalizeTraits::diagonalize_selfadjoint_covariance_matrix
+        (covariance, eigenvalues, eigenvectors);
+
+      // Variation of the set defined as lambda_min / (lambda_0 + lambda_1 + lambda_2)
+      double var = eigenvalues[0] / (eigenvalues[0] + eigenvalues[1] + eigenvalues[2]);
+
+      // Split the set if size OR variance of the cluster is too large
+      if (current_cluster->first.size () > size || var > var_max)
+        {
+          clusters_stack.push_front (cluster (std::list<Input_type>(), Point (0., 0., 0.)));
+          cluster_iterator negative_side = clusters_stack.begin ();
+          // positive_side is built directly from current_cluster
+
+          // The plane which splits the point set into 2 point sets:
+          //  * Normal to the eigenvector with highest eigenvalue
+          //  * Passes through the centroid of the set
+          Vector v (FT(eigenvectors.at(6)), FT(eigenvectors.at(7)), FT(eigenvectors.at(8)));
+
+          std::size_t current_cluster_size = 0;
+          typename std::list<Input_type>::iterator it = current_cluster->first.begin ();
+          while (it != current_cluster->first.end ())
+            {
+              typename std::list<Input_type>::iterator current = it ++;
+              const Point& point = get(point_map, *current);
+
+              // Test if point is on negative side of plane and
+              // transfer it to the negative_side cluster if it is
+              if (Vector (current_cluster->second, point) * v < 0)
+                negative_side->first.splice (negative_side->first.end (),
+                                             current_cluster->first, current);
+              ++ current_cluster_size;
+            }
+
+          // If one of the clusters is empty, stop to avoid infinite
+          // loop and keep the non-empty one
+          if (current_cluster->first.empty () || negative_side->first.empty ())
+            {
+              cluster_iterator nonempty = (current_cluster->first.empty ()
+                                           ? negative_side : current_cluster);
+
+              nb_done += nonempty->first.size();
+              // Compute the centroid
+              nonempty->second = internal::hsps_centroid (nonempty->first.begin (),
+                                                          nonempty->first.end (),
+                                                          point_map, Kernel());
+
+              internal::hsc_terminate_cluster (nonempty->first,
+                                               points_to_keep,
+                                               points_to_remove,
+                                               point_map,
+                                               nonempty->second,
+                                               Kernel ());
+
+              clusters_stack.pop_front ();
+              clusters_stack.pop_front ();
+            }
+          else
+            {
+              // Save old centroid for faster computation
+              Point old_centroid = current_cluster->second;
+
+              // Compute the first centroid
+              current_cluster->second = internal::hsps_centroid (current_cluster->first.begin (),
+                                                                 current_cluster->first.end (),
+                                                                 point_map, Kernel());
+
+              // The second centroid can be computed with the first and
+              // the old ones :
+              // centroid_neg = (n_total * old_centroid - n_pos * first_centroid)
+              //                 / n_neg;
+              negative_side->second = Point ((current_cluster_size * old_centroid.x ()
+                                              - current_cluster->first.size () * current_cluster->second.x ())
+                                             / negative_side->first.size (),
+                                             (current_cluster_size * old_centroid.y ()
+                                              - current_cluster->first.size () * current_cluster->second.y ())
+                                             / negative_side->first.size (),
+                                             (current_cluster_size * old_centroid.z ()
+                                              - current_cluster->first.size () * current_cluster->second.z ())
+                                             / negative_side->first.size ());
+            }
+        }
+      // If the size/variance are small enough, add the centroid as
+      // and output point
+      else
+        {
+          nb_done += current_cluster->first.size();
+          internal::hsc_terminate_cluster (current_cluster->first,
+                                           points_to_keep,
+                                           points_to_remove,
+                                           point_map,
+                                           current_cluster->second,
+                                           Kernel ());
+          clusters_stack.pop_front ();
+        }
+
+      return nb_done;
+    }
+
+    // Simplifies the clusters of `clusters_stack` in depth-first order.
+    // `progress` is called with the number of points done after each
+    // step: if it returns `false`, the simplification stops and the
+    // points of the remaining clusters are removed.
+    template < typename DiagonalizeTraits,
+               typename Input_type,
+               typename PointMap,
+               typename K,
+               typename Progress >
+    void
+    hsps_simplify_clusters (std::list<hsps_cluster<Input_type, typename K::Point_3> >& clusters_stack,
+                            std::list<Input_type>& points_to_keep,
+                            std::list<Input_type>& points_to_remove,
+                            PointMap& point_map,
+                            unsigned int size,
+                            double var_max,
+                            const Progress& progress,
+                            const K& k)
+    {
+      while (!(clusters_stack.empty ()))
+        if (!progress (hsps_process_first_cluster<DiagonalizeTraits>
+                       (clusters_stack, points_to_keep, points_to_remove, point_map, size, var_max, k)))
+          break;
+
+      for (hsps_cluster<Input_type, typename K::Point_3>& c : clusters_stack)
+        points_to_remove.splice (points_to_remove.end (), c.first);
+      clusters_stack.clear ();
+    }
+
+#ifdef CGAL_LINKED_WITH_TBB
+    // Simplifies the cluster of `clusters_stack` (a single one): the
+    // two sides of a large cluster are simplified concurrently, and
+    // their points are concatenated in the order of
+    // hsps_simplify_clusters(), so that the output is the same.
+    template < typename DiagonalizeTraits,
+               typename Input_type,
+               typename PointMap,
+               typename K,
+               typename CallbackWrapper >
+    void
+    hsps_simplify_cluster_in_parallel (std::list<hsps_cluster<Input_type, typename K::Point_3> >& clusters_stack,
+                                       std::list<Input_type>& points_to_keep,
+                                       std::list<Input_type>& points_to_remove,
+                                       PointMap& point_map,
+                                       unsigned int size,
+                                       double var_max,
+                                       CallbackWrapper& callback_wrapper,
+                                       std::size_t depth,
+                                       const K& k)
+    {
+      typedef hsps_cluster<Input_type, typename K::Point_3> cluster;
+
+      // Small clusters (and unbalanced splits) are simplified in one task
+      const std::size_t min_parallel_size = 4096;
+      const std::size_t max_parallel_depth = 64;
+
+      if (clusters_stack.front ().first.size () < min_parallel_size || depth == max_parallel_depth)
+      {
+        hsps_simplify_clusters<DiagonalizeTraits>
+          (clusters_stack, points_to_keep, points_to_remove, point_map, size, var_max,
+           [&](std::size_t nb_done) -> bool
+           {
+             callback_wrapper.advancement () += nb_done;
+             return !callback_wrapper.interrupted ();
+           }, k);
+        return;
+      }
+
+      if (callback_wrapper.interrupted ())
+      {
+        points_to_remove.splice (points_to_remove.end (), clusters_stack.front ().first);
+        clusters_stack.clear ();
+        return;
+      }
+
+      callback_wrapper.advancement () += hsps_process_first_cluster<DiagonalizeTraits>
+        (clusters_stack, points_to_keep, points_to_remove, point_map, size, var_max, k);
+      if (clusters_stack.empty ())
+        return;
+
+      std::list<cluster> negative_side;
+      negative_side.splice (negative_side.end (), clusters_stack, clusters_stack.begin ());
+
+      std::list<Input_type> negative_to_keep, negative_to_remove, positive_to_keep, positive_to_remove;
+      tbb::parallel_invoke
+        ([&]()
+         {
+           hsps_simplify_cluster_in_parallel<DiagonalizeTraits>
+             (negative_side, negative_to_keep, negative_to_remove, point_map, size, var_max,
+              callback_wrapper, depth + 1, k);
+         },
+         [&]()
+         {
+           hsps_simplify_cluster_in_parallel<DiagonalizeTraits>
+             (clusters_stack, positive_to_keep, positive_to_remove, point_map, size, var_max,
+              callback_wrapper, depth + 1, k);
+         });
+
+      points_to_keep.splice (points_to_keep.end (), negative_to_keep);
+      points_to_keep.splice (points_to_keep.end (), positive_to_keep);
+      points_to_remove.splice (points_to_remove.end (), negative_to_remove);
+      points_to_remove.splice (points_to_remove.end (), positive_to_remove);
+    }
+#endif
 
   } // namespace internal
   /// \endcond
@@ -119,6 +391,10 @@ namespace CGAL {
      \pre `0 < maximum_variation <= 1/3`
      \pre `size > 0`
 
+     \tparam ConcurrencyTag enables sequential versus parallel algorithm. Possible values are `Sequential_tag`,
+                             `Parallel_tag`, and `Parallel_if_available_tag`. With `Parallel_tag`, the two sides
+                             of large clusters are split concurrently, and the output is the same as with
+                             `Sequential_tag`.
      \tparam PointRange is a model of `Range`. The value type of
      its iterator is the key type of the named parameter `point_map`.
 
@@ -175,7 +451,8 @@ namespace CGAL {
 
      \return iterator over the first point to remove.
   */
-  template <typename PointRange,
+  template <typename ConcurrencyTag = Sequential_tag,
+            typename PointRange,
             typename NamedParameters = parameters::Default_named_parameters>
   typename PointRange::iterator
   hierarchy_simplify_point_set (PointRange& points,
@@ -184,6 +461,11 @@ namespace CGAL {
     using parameters::choose_parameter;
     using parameters::get_parameter;
 
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
     // basic geometric types
     typedef Point_set_processing_3_np_helper<PointRange, NamedParameters> NP_helper;
     typedef typename NP_helper::Point_map PointMap;
@@ -191,8 +473,6 @@ namespace CGAL {
     typedef typename GetDiagonalizeTraits<NamedParameters, double, 3>::type DiagonalizeTraits;
 
     typedef typename Kernel::Point_3 Point;
-    typedef typename Kernel::Vector_3 Vector;
-    typedef typename Kernel::FT FT;
 
     PointMap point_map = NP_helper::get_point_map(points, np);
     unsigned int size = choose_parameter(get_parameter(np, internal_np::size), 10);
@@ -202,12 +482,9 @@ namespace CGAL {
 
     typedef typename std::iterator_traits<typename PointRange::iterator>::value_type Input_type;
 
-    // We define a cluster as a point set + its centroid (useful for
-    // faster computations of centroids - to be implemented)
-    typedef std::pair< std::list<Input_type>, Point > cluster;
+    typedef internal::hsps_cluster<Input_type, Point> cluster;
 
     std::list<cluster> clusters_stack;
-    typedef typename std::list<cluster>::iterator cluster_iterator;
 
     CGAL_precondition (points.begin() != points.end());
     CGAL_precondition (size > 0);
@@ -224,146 +501,34 @@ namespace CGAL {
     std::list<Input_type> points_to_keep;
     std::list<Input_type> points_to_remove;
 
-    std::size_t nb_done = 0;
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      Point_set_processing_3::internal::Callback_wrapper<Parallel_tag>
+        callback_wrapper (callback, points.size());
 
-    while (!(clusters_stack.empty ()))
-      {
-        cluster_iterator current_cluster = clusters_stack.begin ();
-
-        // If the cluster only has 1 element, we add it to the list of
-        // output points
-        if (current_cluster->first.size () == 1)
-          {
-            points_to_keep.splice (points_to_keep.end (), current_cluster->first,
-                                   current_cluster->first.begin ());
-            clusters_stack.pop_front ();
-            ++ nb_done;
-            continue;
-          }
-
-        // Compute the covariance matrix of the set
-        std::array<double, 6> covariance = {{ 0., 0., 0., 0., 0., 0. }};
-
-        for (typename std::list<Input_type>::iterator it = current_cluster->first.begin ();
-             it != current_cluster->first.end (); ++ it)
-          {
-            const Point& point = get(point_map, *it);
-            Vector d = point - current_cluster->second;
-            covariance[0] += d.x () * d.x ();
-            covariance[1] += d.x () * d.y ();
-            covariance[2] += d.x () * d.z ();
-            covariance[3] += d.y () * d.y ();
-            covariance[4] += d.y () * d.z ();
-            covariance[5] += d.z () * d.z ();
-          }
-
-        std::array<double, 3> eigenvalues = {{ 0., 0., 0. }};
-        std::array<double, 9> eigenvectors = {{ 0., 0., 0.,
-                                              0., 0., 0.,
-                                              0., 0., 0. }};
-        // Linear algebra = get eigenvalues and eigenvectors for
-        // PCA-like analysis
-        DiagonalizeTraits::diagonalize_selfadjoint_covariance_matrix
-          (covariance, eigenvalues, eigenvectors);
-
-        // Variation of the set defined as lambda_min / (lambda_0 + lambda_1 + lambda_2)
-        double var = eigenvalues[0] / (eigenvalues[0] + eigenvalues[1] + eigenvalues[2]);
-
-        // Split the set if size OR variance of the cluster is too large
-        if (current_cluster->first.size () > size || var > var_max)
-          {
-            clusters_stack.push_front (cluster (std::list<Input_type>(), Point (0., 0., 0.)));
-            cluster_iterator negative_side = clusters_stack.begin ();
-            // positive_side is built directly from current_cluster
-
-            // The plane which splits the point set into 2 point sets:
-            //  * Normal to the eigenvector with highest eigenvalue
-            //  * Passes through the centroid of the set
-            Vector v (FT(eigenvectors.at(6)), FT(eigenvectors.at(7)), FT(eigenvectors.at(8)));
-
-            std::size_t current_cluster_size = 0;
-            typename std::list<Input_type>::iterator it = current_cluster->first.begin ();
-            while (it != current_cluster->first.end ())
-              {
-                typename std::list<Input_type>::iterator current = it ++;
-                const Point& point = get(point_map, *current);
-
-                // Test if point is on negative side of plane and
-                // transfer it to the negative_side cluster if it is
-                if (Vector (current_cluster->second, point) * v < 0)
-                  negative_side->first.splice (negative_side->first.end (),
-                                               current_cluster->first, current);
-                ++ current_cluster_size;
-              }
-
-            // If one of the clusters is empty, stop to avoid infinite
-            // loop and keep the non-empty one
-            if (current_cluster->first.empty () || negative_side->first.empty ())
-              {
-                cluster_iterator nonempty = (current_cluster->first.empty ()
-                                             ? negative_side : current_cluster);
-
-                nb_done += nonempty->first.size();
-                // Compute the centroid
-                nonempty->second = internal::hsps_centroid (nonempty->first.begin (),
-                                                            nonempty->first.end (),
-                                                            point_map, Kernel());
-
-                internal::hsc_terminate_cluster (nonempty->first,
-                                                 points_to_keep,
-                                                 points_to_remove,
-                                                 point_map,
-                                                 nonempty->second,
-                                                 Kernel ());
-
-                clusters_stack.pop_front ();
-                clusters_stack.pop_front ();
-              }
-            else
-              {
-                // Save old centroid for faster computation
-                Point old_centroid = current_cluster->second;
-
-                // Compute the first centroid
-                current_cluster->second = internal::hsps_centroid (current_cluster->first.begin (),
-                                                                   current_cluster->first.end (),
-                                                                   point_map, Kernel());
-
-                // The second centroid can be computed with the first and
-                // the old ones :
-                // centroid_neg = (n_total * old_centroid - n_pos * first_centroid)
-                //                 / n_neg;
-                negative_side->second = Point ((current_cluster_size * old_centroid.x ()
-                                                - current_cluster->first.size () * current_cluster->second.x ())
-                                               / negative_side->first.size (),
-                                               (current_cluster_size * old_centroid.y ()
-                                                - current_cluster->first.size () * current_cluster->second.y ())
-                                               / negative_side->first.size (),
-                                               (current_cluster_size * old_centroid.z ()
-                                                - current_cluster->first.size () * current_cluster->second.z ())
-                                               / negative_side->first.size ());
-              }
-          }
-        // If the size/variance are small enough, add the centroid as
-        // and output point
-        else
-          {
-            nb_done += current_cluster->first.size();
-            internal::hsc_terminate_cluster (current_cluster->first,
-                                             points_to_keep,
-                                             points_to_remove,
-                                             point_map,
-                                             current_cluster->second,
-                                             Kernel ());
-            clusters_stack.pop_front ();
-          }
-
-        if (callback && !callback (nb_done / double (points.size())))
-          break;
-      }
+      internal::hsps_simplify_cluster_in_parallel<DiagonalizeTraits>
+        (clusters_stack, points_to_keep, points_to_remove, point_map, size, var_max,
+         callback_wrapper, 0, Kernel());
 
-    if (callback)
-      callback (1.);
+      callback_wrapper.join();
+    }
+    else
+#endif
+    {
+      std::size_t nb_done = 0;
+
+      internal::hsps_simplify_clusters<DiagonalizeTraits>
+        (clusters_stack, points_to_keep, points_to_remove, point_map, size, var_max,
+         [&](std::size_t nb) -> bool
+         {
+           nb_done += nb;
+           return !callback || callback (nb_done / double (points.size()));
+         }, Kernel());
+
+      if (callback)
+        callback (1.);
+    }
 
     typename PointRange::iterator first_point_to_remove =
       std::copy (points_to_keep.begin(), points_to_keep.end(), points.begin());
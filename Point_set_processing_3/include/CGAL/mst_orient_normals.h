@@ -22,15 +22,29 @@
 #include <CGAL/Index_property_map.h>
 #include <CGAL/Memory_sizer.h>
 #include <CGAL/assertions.h>
+#include <CGAL/tags.h>
 #include <CGAL/use.h>
 
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 
+#include <algorithm>
+#include <atomic>
 #include <iterator>
+#include <limits>
 #include <list>
 #include <climits>
+#include <cstdint>
 #include <math.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
 
 #if defined(BOOST_MSVC)
 #  pragma warning(push)
@@ -537,6 +551,447 @@ create_mst_graph(
     return mst_graph;
 }
 
+#ifdef CGAL_LINKED_WITH_TBB
+
+/// Helper class: Riemannian graph in compressed sparse row form.
+///
+/// This class is used internally by mst_orient_normals() with `Parallel_tag`
+/// to encode the same relations as Riemannian_graph with less memory:
+/// - vertices are numbered like the input points index, the virtual source vertex is the last one.
+/// - the arcs of vertex `v` are `arcs[offsets[v]]` to `arcs[offsets[v+1]-1]`,
+///   each undirected edge being stored once in each direction.
+///
+/// @tparam Index unsigned integral type able to store the number of vertices.
+template <typename Index>
+struct Csr_riemannian_graph
+{
+  struct Arc
+  {
+    Index target;
+    float weight;
+  };
+
+  std::vector<std::size_t> offsets;
+  std::vector<Arc> arcs;
+
+  std::size_t number_of_vertices() const { return offsets.size() - 1; }
+};
+
+/// Creates the Riemannian graph in parallel: we add the edge (i, j) if either
+/// vertex i is in the k-neighborhood of vertex j, or vertex j is in the
+/// k-neighborhood of vertex i, and the edge (i, source) if point i is constrained.
+///
+/// \pre Normals must be unit vectors.
+/// \pre `k >= 2`
+template <typename Index,
+          typename PointRange,
+          typename PointMap,
+          typename NormalMap,
+          typename IndexMap,
+          typename ConstrainedMap,
+          typename Kernel
+>
+Csr_riemannian_graph<Index>
+create_csr_riemannian_graph(
+    PointRange& points, ///< input points
+    const std::vector<typename PointRange::iterator>& iterators, ///< input points by index
+    PointMap point_map, ///< property map: value_type of ForwardIterator -> Point_3
+    NormalMap normal_map, ///< property map: value_type of ForwardIterator -> Vector_3
+    IndexMap index_map, ///< property map ForwardIterator -> index
+    ConstrainedMap constrained_map, ///< property map ForwardIterator -> bool
+    unsigned int k, ///< number of neighbors
+    typename Kernel::FT neighbor_radius,
+    const Kernel& /*kernel*/) ///< geometric traits.
+{
+    typedef typename PointRange::iterator ForwardIterator;
+    typedef Point_set_processing_3::internal::Neighbor_query<Kernel, PointRange&, PointMap> Neighbor_query;
+    typedef typename Csr_riemannian_graph<Index>::Arc Arc;
+
+    CGAL_precondition(k >= 2);
+
+    const std::size_t num_input_points = iterators.size();
+    const Index source_point_index = Index(num_input_points);
+
+    CGAL_TRACE_STREAM << "  Creates KD-tree\n";
+
+    Neighbor_query neighbor_query (points, point_map);
+
+    CGAL_TRACE_STREAM << "  Creates Riemannian Graph\n";
+
+    // Sorted k-neighborhoods, without the point itself
+    std::vector<Index> neighbors(num_input_points * k);
+    std::vector<unsigned int> nb_neighbors(num_input_points);
+    std::vector<unsigned char> is_constrained(num_input_points);
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, num_input_points),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+        std::vector<ForwardIterator> neighbor_points;
+        for (std::size_t i = r.begin(); i != r.end(); ++i)
+        {
+            neighbor_points.clear();
+            neighbor_query.get_iterators (get(point_map, *iterators[i]), k, neighbor_radius,
+                                          std::back_inserter(neighbor_points));
+
+            Index* row = &neighbors[i * k];
+            unsigned int nb = 0;
+            for (const ForwardIterator& neighbor : neighbor_points)
+            {
+                const std::size_t neighbor_index = get(index_map, neighbor);
+                if (neighbor_index != i && nb < k)
+                    row[nb++] = Index(neighbor_index);
+            }
+            std::sort(row, row + nb);
+            nb_neighbors[i] = nb;
+            is_constrained[i] = get(constrained_map, *iterators[i]);
+        }
+    });
+
+    // The edge (i, j) is stored by i if j is in the k-neighborhood of i,
+    // and by j otherwise.
+    auto is_neighbor = [&](std::size_t i, Index j) -> bool
+    {
+        const Index* row = &neighbors[i * k];
+        return std::binary_search(row, row + nb_neighbors[i], j);
+    };
+
+    // Counts the arcs of each vertex
+    std::vector<std::atomic<std::size_t> > cursors(num_input_points + 1);
+    for (std::atomic<std::size_t>& c : cursors)
+        c = 0;
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, num_input_points),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+        for (std::size_t i = r.begin(); i != r.end(); ++i)
+        {
+            const Index* row = &neighbors[i * k];
+            for (unsigned int n = 0; n < nb_neighbors[i]; ++n)
+            {
+                ++cursors[i];
+                if (!is_neighbor(row[n], Index(i)))
+                    ++cursors[row[n]];
+            }
+            if (is_constrained[i])
+            {
+                ++cursors[i];
+                ++cursors[source_point_index];
+            }
+        }
+    });
+
+    Csr_riemannian_graph<Index> graph;
+    graph.offsets.resize(num_input_points + 2);
+    graph.offsets[0] = 0;
+    for (std::size_t v = 0; v <= num_input_points; ++v)
+    {
+        graph.offsets[v + 1] = graph.offsets[v] + cursors[v];
+        cursors[v] = graph.offsets[v];
+    }
+    graph.arcs.resize(graph.offsets.back());
+
+    //                               ->        ->
+    // Computes edge weight = 1 - | normal1 * normal2 |
+    // where normal1 and normal2 are the normal at the edge extremities.
+    auto add_edge = [&](std::size_t i, std::size_t j, float weight)
+    {
+        graph.arcs[cursors[i]++] = Arc{ Index(j), weight };
+        graph.arcs[cursors[j]++] = Arc{ Index(i), weight };
+    };
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, num_input_points),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+        for (std::size_t i = r.begin(); i != r.end(); ++i)
+        {
+            const Index* row = &neighbors[i * k];
+            for (unsigned int n = 0; n < nb_neighbors[i]; ++n)
+            {
+                const Index j = row[n];
+                if (is_neighbor(j, Index(i)) && j < i) // stored by j
+                    continue;
+
+                double weight = 1.0 - std::abs(get(normal_map, *iterators[i]) * get(normal_map, *iterators[j]));
+                if (weight < 0)
+                    weight = 0; // safety check
+                add_edge(i, j, float(weight));
+            }
+            if (is_constrained[i])
+                add_edge(i, source_point_index, 0.f);
+        }
+    });
+
+    return graph;
+}
+
+/// Computes a minimum spanning forest of the Riemannian graph with the
+/// algorithm of Boruvka: at each round, each component is hooked to
+/// another one through its lightest incident edge, in parallel. Edges
+/// of the same weight are ordered by their extremities, so that the
+/// forest does not depend on the number of threads.
+///
+/// @return the edges of the forest.
+template <typename Index>
+std::vector<std::pair<Index, Index> >
+boruvka_minimum_spanning_forest(const Csr_riemannian_graph<Index>& graph)
+{
+    const std::size_t num_vertices = graph.number_of_vertices();
+    const Index none = (std::numeric_limits<Index>::max)();
+    const std::size_t no_arc = (std::numeric_limits<std::size_t>::max)();
+
+    // Strict total order on the edges, given as (vertex, arc of this vertex)
+    auto lighter = [&](Index u, std::size_t a, Index v, std::size_t b) -> bool
+    {
+        const float wa = graph.arcs[a].weight, wb = graph.arcs[b].weight;
+        if (wa != wb)
+            return wa < wb;
+        const Index ta = graph.arcs[a].target, tb = graph.arcs[b].target;
+        const std::pair<Index, Index> ea((std::min)(u, ta), (std::max)(u, ta));
+        const std::pair<Index, Index> eb((std::min)(v, tb), (std::max)(v, tb));
+        return ea < eb;
+    };
+
+    std::vector<Index> component(num_vertices), parent(num_vertices), next_parent(num_vertices);
+    std::vector<std::size_t> lightest_arc(num_vertices);
+    std::vector<std::atomic<Index> > lightest_vertex(num_vertices);
+    for (std::size_t v = 0; v < num_vertices; ++v)
+        component[v] = Index(v);
+
+    std::vector<std::pair<Index, Index> > forest_edges(num_vertices, std::make_pair(none, none));
+
+    for (;;)
+    {
+        // Lightest edge of each vertex leaving its component
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0, num_vertices),
+                          [&](const tbb::blocked_range<std::size_t>& r)
+        {
+            for (std::size_t v = r.begin(); v != r.end(); ++v)
+            {
+                lightest_vertex[v] = none;
+                std::size_t best = no_arc;
+                for (std::size_t a = graph.offsets[v]; a != graph.offsets[v + 1]; ++a)
+                    if (component[graph.arcs[a].target] != component[v] &&
+                        (best == no_arc || lighter(Index(v), a, Index(v), best)))
+                        best = a;
+                lightest_arc[v] = best;
+            }
+        });
+
+        // Lightest edge of each component
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0, num_vertices),
+                          [&](const tbb::blocked_range<std::size_t>& r)
+        {
+            for (std::size_t v = r.begin(); v != r.end(); ++v)
+            {
+                if (lightest_arc[v] == no_arc)
+                    continue;
+                std::atomic<Index>& best = lightest_vertex[component[v]];
+                Index current = best;
+                while ((current == none || lighter(Index(v), lightest_arc[v], current, lightest_arc[current])) &&
+                       !best.compare_exchange_weak(current, Index(v)))
+                  ;
+            }
+        });
+
+        // Hooks each component to the component at the other end of its
+        // lightest edge. If two components share their lightest edge, the
+        // one with the smallest index stays a root.
+        std::atomic<bool> any_hook(false);
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0, num_vertices),
+                          [&](const tbb::blocked_range<std::size_t>& r)
+        {
+            for (std::size_t c = r.begin(); c != r.end(); ++c)
+            {
+                parent[c] = Index(c);
+                const Index v = lightest_vertex[c];
+                if (component[c] != c || v == none)
+                    continue;
+
+                const Index t = graph.arcs[lightest_arc[v]].target;
+                const Index other = component[t];
+                const Index w = lightest_vertex[other];
+                if (w == t && graph.arcs[lightest_arc[w]].target == v && c < other)
+                    continue;
+
+                parent[c] = other;
+                forest_edges[c] = std::make_pair(v, t);
+                any_hook = true;
+            }
+        });
+        if (!any_hook)
+            break;
+
+        // Pointer jumping to the roots of the hooked components
+        bool changed = true;
+        while (changed)
+        {
+            std::atomic<bool> any_change(false);
+            tbb::parallel_for(tbb::blocked_range<std::size_t>(0, num_vertices),
+                              [&](const tbb::blocked_range<std::size_t>& r)
+            {
+                for (std::size_t c = r.begin(); c != r.end(); ++c)
+                {
+                    next_parent[c] = parent[parent[c]];
+                    if (next_parent[c] != parent[c])
+                        any_change = true;
+                }
+            });
+            parent.swap(next_parent);
+            changed = any_change;
+        }
+
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0, num_vertices),
+                          [&](const tbb::blocked_range<std::size_t>& r)
+        {
+            for (std::size_t v = r.begin(); v != r.end(); ++v)
+                component[v] = parent[component[v]];
+        });
+    }
+
+    forest_edges.erase(std::remove(forest_edges.begin(), forest_edges.end(), std::make_pair(none, none)),
+                       forest_edges.end());
+    return forest_edges;
+}
+
+/// Propagates the normal orientation from the source vertex along the edges
+/// of the minimum spanning forest, one level of the tree at a time, like
+/// Propagate_normal_orientation.
+///
+/// @return for each point, whether its normal is oriented.
+template <typename Index,
+          typename ForwardIterator,
+          typename NormalMap
+>
+std::vector<unsigned char>
+propagate_normal_orientation_in_parallel(
+    const std::vector<std::pair<Index, Index> >& forest_edges, ///< edges of the minimum spanning forest
+    const std::vector<ForwardIterator>& iterators, ///< input points by index
+    NormalMap normal_map, ///< property map: value_type of ForwardIterator -> Vector_3
+    double angle_max = CGAL_PI/2.) ///< max angle to propagate the normal orientation (radians)
+{
+    typedef typename boost::property_traits<NormalMap>::value_type Vector;
+
+    const std::size_t num_vertices = iterators.size() + 1;
+    const Index source_point_index = Index(iterators.size());
+    const Index none = (std::numeric_limits<Index>::max)();
+
+    // Adjacency of the forest
+    std::vector<std::size_t> offsets(num_vertices + 1, 0);
+    for (const std::pair<Index, Index>& e : forest_edges)
+    {
+        ++offsets[e.first + 1];
+        ++offsets[e.second + 1];
+    }
+    for (std::size_t v = 0; v < num_vertices; ++v)
+        offsets[v + 1] += offsets[v];
+    std::vector<Index> adjacent(offsets.back());
+    {
+        std::vector<std::size_t> cursors(offsets.begin(), offsets.end() - 1);
+        for (const std::pair<Index, Index>& e : forest_edges)
+        {
+            adjacent[cursors[e.first]++] = e.second;
+            adjacent[cursors[e.second]++] = e.first;
+        }
+    }
+
+    std::vector<unsigned char> is_oriented(num_vertices, 0);
+    std::vector<Index> parent(num_vertices, none);
+    is_oriented[source_point_index] = 1;
+    const double cos_angle_max = std::cos(angle_max);
+
+    // Breadth-first traversal: a vertex is reached by its parent only
+    std::vector<Index> frontier(1, source_point_index);
+    while (!frontier.empty())
+    {
+        tbb::enumerable_thread_specific<std::vector<Index> > next_frontiers;
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0, frontier.size()),
+                          [&](const tbb::blocked_range<std::size_t>& r)
+        {
+            std::vector<Index>& next_frontier = next_frontiers.local();
+            for (std::size_t f = r.begin(); f != r.end(); ++f)
+            {
+                const Index source_vertex = frontier[f];
+                for (std::size_t a = offsets[source_vertex]; a != offsets[source_vertex + 1]; ++a)
+                {
+                    const Index target_vertex = adjacent[a];
+                    if (target_vertex == parent[source_vertex])
+                        continue;
+                    parent[target_vertex] = source_vertex;
+                    next_frontier.push_back(target_vertex);
+
+                    // special case if vertex is source vertex (and thus has no related point/normal)
+                    if (source_vertex == source_point_index)
+                    {
+                        is_oriented[target_vertex] = 1;
+                        continue;
+                    }
+
+                    //             ->                        ->
+                    // Orients target_normal parallel to source_normal
+                    const Vector source_normal = get(normal_map, *iterators[source_vertex]);
+                    const Vector target_normal = get(normal_map, *iterators[target_vertex]);
+                    double normals_dot = source_normal * target_normal;
+                    if (normals_dot < 0)
+                        put(normal_map, *iterators[target_vertex], -target_normal);
+
+                    // Is orientation robust?
+                    is_oriented[target_vertex]
+                      = is_oriented[source_vertex] &&
+                        (std::abs(normals_dot) >= cos_angle_max); // oriented iff angle <= angle_max
+                }
+            }
+        });
+
+        frontier.clear();
+        for (const std::vector<Index>& next_frontier : next_frontiers)
+            frontier.insert(frontier.end(), next_frontier.begin(), next_frontier.end());
+    }
+
+    is_oriented.pop_back();
+    return is_oriented;
+}
+
+/// Orients the normals with the Riemannian graph in compressed sparse row form,
+/// a parallel minimum spanning forest, and a parallel propagation.
+///
+/// @return for each point, whether its normal is oriented.
+template <typename Index,
+          typename PointRange,
+          typename PointMap,
+          typename NormalMap,
+          typename IndexMap,
+          typename ConstrainedMap,
+          typename Kernel
+>
+std::vector<unsigned char>
+mst_orient_normals_in_parallel(
+    PointRange& points, ///< input points
+    const std::vector<typename PointRange::iterator>& iterators, ///< input points by index
+    PointMap point_map, ///< property map: value_type of ForwardIterator -> Point_3
+    NormalMap normal_map, ///< property map: value_type of ForwardIterator -> Vector_3
+    IndexMap index_map, ///< property map ForwardIterator -> index
+    ConstrainedMap constrained_map, ///< property map ForwardIterator -> bool
+    unsigned int k, ///< number of neighbors
+    typename Kernel::FT neighbor_radius,
+    const Kernel& kernel) ///< geometric traits.
+{
+    std::vector<std::pair<Index, Index> > forest_edges;
+    {
+        const Csr_riemannian_graph<Index> riemannian_graph
+          = create_csr_riemannian_graph<Index>(points, iterators, point_map, normal_map, index_map,
+                                               constrained_map, k, neighbor_radius, kernel);
+
+        std::size_t memory = CGAL::Memory_sizer().virtual_size();
+        CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
+        CGAL_TRACE_STREAM << "  Computes the minimum spanning forest\n";
+
+        forest_edges = boruvka_minimum_spanning_forest(riemannian_graph);
+    }
+
+    CGAL_TRACE_STREAM << "  Propagates the orientation\n";
+    return propagate_normal_orientation_in_parallel(forest_edges, iterators, normal_map);
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+
 } /* namespace internal */
 /// \endcond
 
@@ -559,6 +1014,13 @@ create_mst_graph(
    \pre Normals must be unit vectors
    \pre `k >= 2`
 
+   \tparam ConcurrencyTag enables sequential versus parallel algorithm. Possible values are `Sequential_tag`,
+                           `Parallel_tag`, and `Parallel_if_available_tag`. With `Parallel_tag`, the
+                           Riemannian graph is stored in compressed sparse row form and built in parallel,
+                           the minimum spanning tree is computed with the parallel algorithm of Boruvka,
+                           and the orientation is propagated with a parallel breadth-first traversal.
+                           When several edges have the same weight, the spanning tree may differ from
+                           the sequential one, but it does not depend on the number of threads.
    \tparam PointRange is a model of `Range`. The value type of
    its iterator is the key type of the named parameter `point_map`.
 
@@ -610,7 +1072,8 @@ create_mst_graph(
 
    \return iterator over the first point with an unoriented normal.
 */
-template <typename PointRange,
+template <typename ConcurrencyTag = Sequential_tag,
+          typename PointRange,
           typename NamedParameters = parameters::Default_named_parameters
 >
 typename PointRange::iterator
@@ -623,6 +1086,11 @@ mst_orient_normals(
     using parameters::get_parameter;
     using parameters::is_default_parameter;
 
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
     CGAL_TRACE_STREAM << "Calls mst_orient_normals()\n";
 
     typedef Point_set_processing_3_np_helper<PointRange, NamedParameters> NP_helper;
@@ -671,6 +1139,73 @@ mst_orient_normals(
     // and get() requires a lookup in the map.
     IndexMap index_map(points.begin(), points.end());
 
+    const std::size_t num_input_points = distance(points.begin(), points.end());
+
+    // Copy points with robust normal orientation to oriented_points[], the others to unoriented_points[],
+    // and replaces [points.begin(), points.end()) range by the content of oriented_points[], then unoriented_points[].
+    auto pack_oriented_points = [&](const auto& is_oriented) -> typename PointRange::iterator
+    {
+        std::deque<Enriched_point> oriented_points, unoriented_points;
+        for (typename PointRange::iterator it = points.begin(); it != points.end(); it++)
+        {
+            if (is_oriented(get(index_map,it)))
+              oriented_points.push_back(*it);
+            else
+              unoriented_points.push_back(*it);
+        }
+
+        typename PointRange::iterator first_unoriented_point =
+          std::copy(oriented_points.begin(), oriented_points.end(), points.begin());
+        std::copy(unoriented_points.begin(), unoriented_points.end(), first_unoriented_point);
+
+        // At this stage, we have typically 0 unoriented normals if k is large enough
+        CGAL_TRACE_STREAM << "  => " << unoriented_points.size() << " normals are unoriented\n";
+
+        std::size_t memory = CGAL::Memory_sizer().virtual_size();
+        CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
+        CGAL_TRACE_STREAM << "End of mst_orient_normals()\n";
+
+        return first_unoriented_point;
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      std::vector<typename PointRange::iterator> iterators;
+      iterators.reserve(num_input_points);
+      for (typename PointRange::iterator it = points.begin(); it != points.end(); it++)
+        iterators.push_back(it);
+
+      // Vertex indices are stored on 32 bits when possible
+      auto orient = [&](auto index, const auto& constrained) -> std::vector<unsigned char>
+      {
+        return mst_orient_normals_in_parallel<decltype(index)>(points, iterators,
+                                                               point_map, normal_map, index_map,
+                                                               constrained,
+                                                               k,
+                                                               neighbor_radius,
+                                                               kernel);
+      };
+      auto orient_with_index = [&](const auto& constrained) -> std::vector<unsigned char>
+      {
+        if (num_input_points < (std::numeric_limits<std::uint32_t>::max)())
+          return orient(std::uint32_t(), constrained);
+        return orient(std::size_t(), constrained);
+      };
+
+      std::vector<unsigned char> is_oriented;
+      if (is_default_parameter<NamedParameters, internal_np::point_is_constrained_t>::value)
+        is_oriented = orient_with_index(Default_constrained_map<typename PointRange::iterator>
+                                        (mst_find_source(points.begin(), points.end(),
+                                                         point_map, normal_map,
+                                                         kernel)));
+      else
+        is_oriented = orient_with_index(constrained_map);
+
+      return pack_oriented_points([&](std::size_t i) -> bool { return is_oriented[i]; });
+    }
+#endif
+
     // Iterates over input points and creates Riemannian Graph:
     // - vertices are numbered like the input points index.
     // - vertices are empty.
@@ -707,7 +1242,6 @@ mst_orient_normals(
     CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
     CGAL_TRACE_STREAM << "  Calls boost::breadth_first_search()\n";
 
-    const std::size_t num_input_points = distance(points.begin(), points.end());
     std::size_t source_point_index = num_input_points;
 
     // Traverse the point set along the MST to propagate source_point's orientation
@@ -717,31 +1251,7 @@ mst_orient_normals(
                                 vertex(source_point_index, mst_graph), // source
                                 visitor(boost::make_bfs_visitor(orienter)));
 
-    // Copy points with robust normal orientation to oriented_points[], the others to unoriented_points[].
-    std::deque<Enriched_point> oriented_points, unoriented_points;
-    for (typename PointRange::iterator it = points.begin(); it != points.end(); it++)
-    {
-        std::size_t it_index = get(index_map,it);
-        typename MST_graph::vertex_descriptor v = vertex(it_index, mst_graph);
-        if (mst_graph[v].is_oriented)
-          oriented_points.push_back(*it);
-        else
-          unoriented_points.push_back(*it);
-    }
-
-    // Replaces [points.begin(), points.end()) range by the content of oriented_points[], then unoriented_points[].
-    typename PointRange::iterator first_unoriented_point =
-      std::copy(oriented_points.begin(), oriented_points.end(), points.begin());
-    std::copy(unoriented_points.begin(), unoriented_points.end(), first_unoriented_point);
-
-    // At this stage, we have typically 0 unoriented normals if k is large enough
-    CGAL_TRACE_STREAM << "  => " << unoriented_points.size() << " normals are unoriented\n";
-
-    memory = CGAL::Memory_sizer().virtual_size();
-    CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
-    CGAL_TRACE_STREAM << "End of mst_orient_normals()\n";
-
-    return first_unoriented_point;
+    return pack_oriented_points([&](std::size_t i) -> bool { return mst_graph[vertex(i, mst_graph)].is_oriented; });
 }
 
 } //namespace CGAL
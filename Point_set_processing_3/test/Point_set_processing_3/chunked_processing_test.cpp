@@ -0,0 +1,197 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Chunked_point_set_processor.h>
+#include <CGAL/jet_estimate_normals.h>
+#include <CGAL/remove_outliers.h>
+#include <CGAL/IO/read_ply_points.h>
+#include <CGAL/IO/write_ply_points.h>
+#include <CGAL/property_map.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+// types
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point;
+typedef Kernel::Vector_3 Vector;
+typedef std::pair<Point, Vector> Point_with_normal;
+typedef CGAL::First_of_pair_property_map<Point_with_normal> Point_map;
+typedef CGAL::Second_of_pair_property_map<Point_with_normal> Normal_map;
+
+bool x_less (const Point_with_normal& a, const Point_with_normal& b)
+{
+  return a.first.x() < b.first.x();
+}
+
+// the halo of each chunk contains all the points closer than the halo
+void test_halo (const std::vector<Point>& input, std::size_t chunk_size, double halo)
+{
+  std::size_t nb_chunks = 0, nb_points_in_chunks = 0;
+  std::vector<Point> output;
+  auto processor = CGAL::make_chunked_point_set_processor<Point>
+    ([&](auto& chunk)
+     {
+       ++ nb_chunks;
+       nb_points_in_chunks += chunk.number_of_points_in_chunk();
+       assert (chunk.number_of_points_in_chunk() <= chunk_size);
+
+       std::vector<Point> core, neighborhood;
+       for (std::size_t i : chunk.indices())
+         if (chunk.is_in_chunk(i))
+           core.push_back (get (chunk.point_map(), i));
+       for (const Point& p : input)
+         for (const Point& q : core)
+           if (CGAL::squared_distance (p, q) < halo * halo)
+           {
+             neighborhood.push_back (p);
+             break;
+           }
+       for (const Point& p : neighborhood)
+       {
+         assert (std::find (chunk.points().begin(), chunk.points().end(), p) != chunk.points().end());
+         CGAL_USE (p);
+       }
+
+       // the points are copies, the modifications do not leak into the next chunks
+       for (Point& p : chunk.points())
+         p = p + Vector (0., 0., 1.);
+     },
+     std::back_inserter (output), chunk_size, halo);
+
+  processor.insert (input.begin(), input.end());
+  processor.finish();
+  assert (processor.number_of_buffered_points() == 0);
+  assert (nb_points_in_chunks == input.size());
+  assert (nb_chunks == (input.size() + chunk_size - 1) / chunk_size);
+
+  assert (output.size() == input.size());
+  for (std::size_t i = 0; i < input.size(); ++ i)
+    assert (output[i] == input[i] + Vector (0., 0., 1.));
+
+  std::cout << "  chunks of " << chunk_size << " points, halo " << halo << ": "
+            << nb_chunks << " chunks" << std::endl;
+}
+
+// streaming outlier removal and normal estimation give the same result as in memory
+void test_pipeline (const std::vector<Point_with_normal>& input)
+{
+  const unsigned int k = 12;
+  const double threshold_distance = 0.05;
+  const double halo = 0.1;
+  const std::size_t chunk_size = 1000;
+
+  // in memory
+  std::vector<Point_with_normal> reference = input;
+  std::vector<Point_with_normal>::iterator first_to_remove
+    = CGAL::remove_outliers<CGAL::Sequential_tag> (reference, k,
+                                                   CGAL::parameters::point_map (Point_map()).
+                                                   threshold_percent (100.).
+                                                   threshold_distance (threshold_distance));
+  reference.erase (first_to_remove, reference.end());
+  std::stable_sort (reference.begin(), reference.end(), x_less);
+  CGAL::jet_estimate_normals<CGAL::Sequential_tag> (reference, k,
+                                                    CGAL::parameters::point_map (Point_map()).
+                                                    normal_map (Normal_map()));
+
+  // by chunks
+  std::vector<Point_with_normal> output;
+  std::size_t max_buffered = 0;
+  auto processor = CGAL::make_chunked_point_set_processor<Point_with_normal>
+    ([&](auto& chunk)
+     {
+       chunk.remove (CGAL::remove_outliers<CGAL::Sequential_tag>
+                     (chunk.indices(), k,
+                      CGAL::parameters::point_map (chunk.point_map()).
+                      threshold_percent (100.).
+                      threshold_distance (threshold_distance)));
+       CGAL::jet_estimate_normals<CGAL::Sequential_tag>
+         (chunk.indices(), k,
+          CGAL::parameters::point_map (chunk.point_map()).
+          normal_map (chunk.property_map (Normal_map())));
+     },
+     std::back_inserter (output), chunk_size, halo, 0,
+     CGAL::parameters::point_map (Point_map()));
+
+  for (const Point_with_normal& pwn : input)
+  {
+    processor.insert (pwn);
+    max_buffered = (std::max) (max_buffered, processor.number_of_buffered_points());
+  }
+  processor.finish();
+
+  std::cout << "  " << input.size() - reference.size() << " outliers removed, "
+            << max_buffered << " points buffered at most" << std::endl;
+  assert (reference.size() < input.size());
+  assert (max_buffered < input.size() / 4);
+
+  assert (output.size() == reference.size());
+  for (std::size_t i = 0; i < output.size(); ++ i)
+  {
+    assert (output[i].first == reference[i].first);
+    const Vector& n1 = output[i].second;
+    const Vector& n2 = reference[i].second;
+    assert (std::abs (n1 * n2) > (1. - 1e-6) * std::sqrt (n1.squared_length() * n2.squared_length()));
+    CGAL_USE (n1);
+    CGAL_USE (n2);
+  }
+}
+
+// the points can be streamed from a reader
+void test_ply (const std::vector<Point>& input)
+{
+  std::stringstream stream;
+  stream.precision (17);
+  bool ok = CGAL::IO::write_PLY (stream, input);
+  assert (ok);
+
+  std::vector<Point> output;
+  auto processor = CGAL::make_chunked_point_set_processor<Point>
+    ([&](auto&) { }, std::back_inserter (output), 100, 0.05);
+  ok = CGAL::IO::read_PLY (stream, processor.inserter());
+  assert (ok);
+  processor.finish();
+
+  assert (output.size() == input.size());
+  for (std::size_t i = 0; i < input.size(); ++ i)
+    assert (CGAL::squared_distance (output[i], input[i]) < 1e-20);
+  CGAL_USE (ok);
+}
+
+int main (void)
+{
+  CGAL::Random rnd (0);
+
+  // a wavy surface, with outliers, sorted along x
+  std::vector<Point_with_normal> input;
+  for (std::size_t i = 0; i < 20000; ++ i)
+  {
+    const double x = rnd.get_double (0., 2.), y = rnd.get_double (0., 1.);
+    input.push_back (std::make_pair (Point (x, y, 0.1 * std::sin (5. * x) * std::cos (5. * y)), CGAL::NULL_VECTOR));
+  }
+  for (std::size_t i = 0; i < 200; ++ i)
+    input.push_back (std::make_pair (Point (rnd.get_double (0., 2.), rnd.get_double (0., 1.), rnd.get_double (-0.5, 0.5)),
+                                     CGAL::NULL_VECTOR));
+  std::sort (input.begin(), input.end(), x_less);
+
+  std::vector<Point> points;
+  for (std::size_t i = 0; i < input.size(); i += 10)
+    points.push_back (input[i].first);
+
+  std::cout << "== halo" << std::endl;
+  test_halo (points, 100, 0.05);
+  test_halo (points, 333, 0.2);
+  test_halo (points, 5000, 0.);
+  std::cout << "== pipeline" << std::endl;
+  test_pipeline (input);
+  std::cout << "== PLY" << std::endl;
+  test_ply (points);
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
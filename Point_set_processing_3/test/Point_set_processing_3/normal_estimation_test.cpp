@@ -222,6 +222,7 @@ bool verify_normal_orientation(const PointList& points, // input points + comput
 
 // Hoppe92 normal orientation using a Minimum Spanning Tree.
 // @return true on success.
+template <typename ConcurrencyTag>
 bool run_mst_orient_normals(PointList& points, // input points + input/output normals
                             unsigned int nb_neighbors_mst, // number of neighbors
                             const std::vector<Vector>& original_normals) // may be empty
@@ -230,7 +231,7 @@ bool run_mst_orient_normals(PointList& points, // input points + input/output no
   CGAL::Timer task_timer; task_timer.start();
 
   PointList::iterator unoriented_points_begin =
-    CGAL::mst_orient_normals(points, nb_neighbors_mst,
+    CGAL::mst_orient_normals<ConcurrencyTag>(points, nb_neighbors_mst,
       CGAL::parameters::normal_map(CGAL::make_normal_of_point_with_normal_map(PointList::value_type())));
 
 
@@ -359,8 +360,12 @@ int main(int argc, char * argv[])
     if ( ! success )
       accumulated_fatal_err = EXIT_FAILURE; // set error and continue
 
-    // Orients normals.
-    success = run_mst_orient_normals(points, nb_neighbors_mst, original_normals);
+    // Orients normals, sequentially and in parallel.
+    PointList parallel_points = points;
+    success = run_mst_orient_normals<CGAL::Sequential_tag>(points, nb_neighbors_mst, original_normals);
+    if ( ! success )
+      accumulated_fatal_err = EXIT_FAILURE; // set error and continue
+    success = run_mst_orient_normals<Concurrency_tag>(parallel_points, nb_neighbors_mst, original_normals);
     if ( ! success )
       accumulated_fatal_err = EXIT_FAILURE; // set error and continue
 
@@ -373,8 +378,12 @@ int main(int argc, char * argv[])
     if ( ! success )
       accumulated_fatal_err = EXIT_FAILURE; // set error and continue
 
-    // Orients normals
-    success = run_mst_orient_normals(points, nb_neighbors_mst, original_normals);
+    // Orients normals, sequentially and in parallel.
+    parallel_points = points;
+    success = run_mst_orient_normals<CGAL::Sequential_tag>(points, nb_neighbors_mst, original_normals);
+    if ( ! success )
+      accumulated_fatal_err = EXIT_FAILURE; // set error and continue
+    success = run_mst_orient_normals<Concurrency_tag>(parallel_points, nb_neighbors_mst, original_normals);
     if ( ! success )
       accumulated_fatal_err = EXIT_FAILURE; // set error and continue
 
@@ -0,0 +1,130 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/grid_simplify_point_set.h>
+#include <CGAL/hierarchy_simplify_point_set.h>
+#include <CGAL/Random.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+#endif
+
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <map>
+#include <vector>
+
+// types
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+void test_grid_simplification (const std::vector<Point>& input, double epsilon, unsigned int min_points_per_cell)
+{
+  std::vector<Point> seq_points = input, par_points = input;
+  std::vector<Point>::iterator seq_it
+    = CGAL::grid_simplify_point_set (seq_points, epsilon,
+                                     CGAL::parameters::min_points_per_cell(min_points_per_cell));
+  std::vector<Point>::iterator par_it
+    = CGAL::grid_simplify_point_set<Concurrency_tag> (par_points, epsilon,
+                                                      CGAL::parameters::min_points_per_cell(min_points_per_cell));
+  assert (std::distance (seq_points.begin(), seq_it) == std::distance (par_points.begin(), par_it));
+  assert (seq_points == par_points);
+
+  // the first point of each cell is kept, and the points keep their input order
+  std::map<std::array<double, 3>, std::size_t> cells;
+  std::vector<Point> expected;
+  for (const Point& p : input)
+    ++ cells[CGAL::internal::grid_cell_3 (p, epsilon)];
+  for (const Point& p : input)
+  {
+    std::size_t& nb = cells[CGAL::internal::grid_cell_3 (p, epsilon)];
+    if (nb >= min_points_per_cell)
+      expected.push_back (p);
+    nb = 0;
+  }
+  assert (std::equal (expected.begin(), expected.end(), par_points.begin(), par_it));
+  assert (static_cast<std::size_t>(std::distance (par_points.begin(), par_it)) == expected.size());
+
+  // a range without random access
+  std::list<Point> list_points (input.begin(), input.end());
+  std::list<Point>::iterator list_it
+    = CGAL::grid_simplify_point_set<Concurrency_tag> (list_points, epsilon,
+                                                      CGAL::parameters::min_points_per_cell(min_points_per_cell));
+  assert (std::equal (list_points.begin(), list_it, par_points.begin(), par_it));
+
+  std::cout << "  grid simplification: " << expected.size() << " points kept out of "
+            << input.size() << std::endl;
+}
+
+void test_hierarchy_simplification (const std::vector<Point>& input, unsigned int size, double maximum_variation)
+{
+  std::vector<Point> seq_points = input, par_points = input;
+  std::vector<Point>::iterator seq_it
+    = CGAL::hierarchy_simplify_point_set (seq_points,
+                                          CGAL::parameters::size(size).maximum_variation(maximum_variation));
+
+  bool done = false;
+  std::vector<Point>::iterator par_it
+    = CGAL::hierarchy_simplify_point_set<Concurrency_tag>
+        (par_points, CGAL::parameters::size(size).maximum_variation(maximum_variation).
+                                      callback([&](double advancement) -> bool
+                                               {
+                                                 if (advancement == 1.)
+                                                   done = true;
+                                                 return true;
+                                               }));
+  assert (done);
+  assert (std::distance (seq_points.begin(), seq_it) == std::distance (par_points.begin(), par_it));
+  assert (seq_points == par_points);
+
+  std::cout << "  hierarchy simplification: " << std::distance (par_points.begin(), par_it)
+            << " points kept out of " << input.size() << std::endl;
+}
+
+void test (const std::vector<Point>& input)
+{
+  std::cout << "== grid" << std::endl;
+  test_grid_simplification (input, 0.05, 1);
+  test_grid_simplification (input, 0.02, 3);
+  std::cout << "== hierarchy" << std::endl;
+  test_hierarchy_simplification (input, 10, 1./3.);
+  test_hierarchy_simplification (input, 100, 0.01);
+}
+
+int main (void)
+{
+  CGAL::Random rnd (0);
+
+  // a noisy sphere, a plane, and random points in a cube
+  std::vector<Point> input;
+  for (std::size_t i = 0; i < 40000; ++ i)
+  {
+    const Kernel::Vector_3 v (rnd.get_double(-1., 1.), rnd.get_double(-1., 1.), rnd.get_double(-1., 1.));
+    if (v.squared_length() > 1e-4)
+      input.push_back (CGAL::ORIGIN + (1. + rnd.get_double(-0.01, 0.01)) * v / CGAL::sqrt (v.squared_length()));
+  }
+  for (std::size_t i = 0; i < 20000; ++ i)
+    input.push_back (Point (rnd.get_double(-1., 1.), rnd.get_double(-1., 1.), 0.));
+  for (std::size_t i = 0; i < 20000; ++ i)
+    input.push_back (Point (rnd.get_double(-1., 1.), rnd.get_double(-1., 1.), rnd.get_double(-1., 1.)));
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // simplify with several threads, whatever the number of cores
+  tbb::global_control c (tbb::global_control::max_allowed_parallelism, 4);
+  tbb::task_arena arena (4);
+  arena.execute ([&]{ test (input); });
+#else
+  test (input);
+#endif
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
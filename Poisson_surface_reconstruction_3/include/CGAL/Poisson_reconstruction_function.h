@@ -31,7 +31,10 @@
 
 #include <CGAL/IO/trace.h>
 #include <CGAL/Reconstruction_triangulation_3.h>
+#include <CGAL/Poisson_surface_reconstruction_3/internal/Octree_poisson_function.h>
+#include <CGAL/hilbert_sort.h>
 #include <CGAL/spatial_sort.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
 #ifdef CGAL_EIGEN3_ENABLED
 #include <CGAL/Eigen_solver_traits.h>
 #else
@@ -43,10 +46,19 @@
 #include <CGAL/Robust_weighted_circumcenter_filtered_traits_3.h>
 #include <CGAL/compute_average_spacing.h>
 #include <CGAL/Timer.h>
+#include <CGAL/tags.h>
 
+#include <array>
 #include <memory>
+#include <numeric>
 #include <boost/iterator/indirect_iterator.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
 /*!
   \file Poisson_reconstruction_function.h
 */
@@ -141,7 +153,9 @@ iso-contoured using an adaptive marching cubes.
 
 `Poisson_reconstruction_function` implements a variant of this
 algorithm which solves for a piecewise linear function on a 3D
-Delaunay triangulation instead of an adaptive octree.
+Delaunay triangulation instead of an adaptive octree. Alternatively,
+`compute_implicit_function_on_octree()` solves the screened variant
+of the method \cgalCite{Kazhdan13} on an adaptive octree.
 
 \tparam Gt Geometric traits class.
 
@@ -265,6 +279,30 @@ private:
     void set (Cell_handle ch) { m_cell = ch.operator->(); }
   };
 
+  // The last finite cells found by a thread, the most recent first. The queries of
+  // a thread are usually close to each other (e.g., along the segments or in the
+  // cells of a mesher), so they are often located in one of these cells.
+  struct Recent_cells
+  {
+    static const std::size_t capacity = 4;
+    std::array<Cell*, capacity> cells;
+    std::size_t size;
+
+    Recent_cells() : size(0) { }
+
+    void push(Cell_handle ch)
+    {
+      if(size < capacity)
+        ++size;
+      std::copy_backward(cells.begin(), cells.begin() + size - 1, cells.begin() + size);
+      cells[0] = ch.operator->();
+    }
+  };
+
+#ifdef CGAL_LINKED_WITH_TBB
+  typedef tbb::enumerable_thread_specific<Recent_cells> Thread_recent_cells;
+#endif
+
 // Data members.
 // Warning: the Surface Mesh Generation package makes copies of implicit functions,
 // thus this class must be lightweight and stateless.
@@ -277,9 +315,18 @@ private:
   mutable std::vector<Point> Dual;
   mutable std::vector<Vector> Normal;
 
+  // operator() is pre-computed on the corners of the cells of an adaptive octree
+  // if compute_implicit_function_on_octree() is called.
+  typedef internal::Poisson::Octree_poisson_function<Gt> Octree_function;
+  std::shared_ptr<Octree_function> m_octree_function;
+
   // contouring and meshing
   Point m_sink; // Point with the minimum value of operator()
   mutable Cell_hint m_hint; // last cell found = hint for next search
+#ifdef CGAL_LINKED_WITH_TBB
+  // Per-thread hints for locate, shared by the copies of this function
+  std::shared_ptr<Thread_recent_cells> m_recent_cells;
+#endif
 
   FT average_spacing;
 
@@ -344,6 +391,9 @@ public:
     NormalPMap normal_pmap ///< property map: `value_type of InputIterator` -> `Vector` (the *oriented* normal of an input point).
   )
     : m_tr(new Triangulation), m_bary(new std::vector<Cached_bary_coord>)
+#ifdef CGAL_LINKED_WITH_TBB
+    , m_recent_cells(new Thread_recent_cells)
+#endif
     , average_spacing(CGAL::compute_average_spacing<CGAL::Sequential_tag>
                       (CGAL::make_range(first, beyond), 6,
                        CGAL::parameters::point_map(point_pmap)))
@@ -364,6 +414,9 @@ public:
     NormalPMap normal_pmap, ///< property map: `value_type of InputIterator` -> `Vector` (the *oriented* normal of an input point).
     Visitor visitor)
     : m_tr(new Triangulation), m_bary(new std::vector<Cached_bary_coord>)
+#ifdef CGAL_LINKED_WITH_TBB
+    , m_recent_cells(new Thread_recent_cells)
+#endif
     , average_spacing(CGAL::compute_average_spacing<CGAL::Sequential_tag>(CGAL::make_range(first, beyond), 6,
                                                                           CGAL::parameters::point_map(point_pmap)))
   {
@@ -383,6 +436,9 @@ public:
     >* = 0
   )
     : m_tr(new Triangulation), m_bary(new std::vector<Cached_bary_coord>)
+#ifdef CGAL_LINKED_WITH_TBB
+    , m_recent_cells(new Thread_recent_cells)
+#endif
   , average_spacing(CGAL::compute_average_spacing<CGAL::Sequential_tag>(CGAL::make_range(first, beyond), 6))
   {
     forward_constructor(first, beyond,
@@ -418,6 +474,9 @@ public:
                                  double approximation_ratio = 0,
                                  double average_spacing_ratio = 5)
   {
+    m_octree_function.reset();
+    clear_hints();
+
     CGAL::Timer task_timer; task_timer.start();
     CGAL_TRACE_STREAM << "Delaunay refinement...\n";
 
@@ -574,6 +633,58 @@ public:
       return compute_implicit_function<SparseLinearAlgebraTraits_d,Poisson_visitor>(solver,Poisson_visitor());
   }
 
+  /*!
+    Alternative to `compute_implicit_function()`, which does not use
+    the Delaunay triangulation. It must be called after the insertion
+    of oriented points. It computes operator() as the solution of the
+    screened Poisson equation \cgalCite{Kazhdan13}, which is trilinear
+    in the cells of an adaptive octree refined around the input points,
+    and shifts and orients operator() such that it is 0 at the input
+    points (median value) and negative inside the inferred surface.
+
+    The levels of the octree are solved from the coarsest to the finest
+    one with a conjugate gradient solver, initialized with the solution
+    of the coarser level (cascadic multigrid). The memory and the time
+    grow linearly with the number of cells of the octree, that is, with
+    the area of the inferred surface times `4^max_depth`.
+
+    \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+    Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    With `Parallel_tag`, the linear systems are assembled and solved in parallel.
+
+    \param max_depth depth of the finest cells of the octree, which have a size of
+    about `2^-max_depth` times the size of the bounding box of the input points.
+    It must be at most 20.
+    \param screening_weight weight of the interpolation of the input points,
+    with respect to the fitting of the gradient of operator() to the normals.
+
+    \return `false` if the linear solver fails.
+  */
+  template <class ConcurrencyTag = Sequential_tag>
+  bool compute_implicit_function_on_octree(std::size_t max_depth = 8,
+                                           double screening_weight = 4.)
+  {
+    std::vector<typename Triangulation::Point_with_normal> points;
+    if(! m_tr->points.empty()) // not all points inserted in the triangulation yet
+      points = m_tr->points;
+    else
+      std::copy(m_tr->input_points_begin(), m_tr->input_points_end(), std::back_inserter(points));
+
+    CGAL_TRACE_STREAM << "Solve screened Poisson equation on octree...\n";
+    std::shared_ptr<Octree_function> octree_function(new Octree_function(points));
+    if(! octree_function->template compute<ConcurrencyTag>(max_depth,
+                                                           FT(screening_weight),
+                                                           CGAL::square(average_spacing)))
+    {
+      std::cerr << "Error: cannot solve Poisson equation" << std::endl;
+      return false;
+    }
+
+    m_octree_function = octree_function;
+    m_sink = m_octree_function->sink();
+    return true;
+  }
+
   /// \cond SKIP_IN_MANUAL
 #ifdef CGAL_EIGEN3_ENABLED
   // This variant provides the default sparse linear traits class = Eigen_solver_traits.
@@ -584,11 +695,12 @@ public:
   }
 #endif
 
+  // Not available if the function is computed on an octree.
   boost::tuple<FT, Cell_handle, bool> special_func(const Point& p) const
   {
-    Cell_handle hint = m_hint.get();
-    hint = m_tr->locate(p, hint); // no hint when we use hierarchy
-    m_hint.set(hint);
+    CGAL_precondition(m_octree_function == nullptr);
+
+    Cell_handle hint = locate(p);
 
     if(m_tr->is_infinite(hint)) {
       int i = hint->index(m_tr->infinite_vertex());
@@ -613,9 +725,10 @@ public:
   */
   FT operator()(const Point& p) const
   {
-    Cell_handle hint = m_hint.get();
-    hint = m_tr->locate(p, hint);
-    m_hint.set(hint);
+    if(m_octree_function)
+      return (*m_octree_function)(p);
+
+    Cell_handle hint = locate(p);
 
     if(m_tr->is_infinite(hint)) {
       int i = hint->index(m_tr->infinite_vertex());
@@ -630,6 +743,61 @@ public:
            d * hint->vertex(3)->f();
   }
 
+  /*!
+    evaluates the implicit function at the points of `points`, and puts the values
+    in the same order in `values`. The points are evaluated in the order of a Hilbert
+    curve, so that the consecutive queries are close to each other.
+    The function `compute_implicit_function()` or `compute_implicit_function_on_octree()`
+    must be called before the first call to `evaluate()`.
+
+    `operator()` and `evaluate()` can be called concurrently: each thread keeps its
+    own hints to locate the points.
+
+    \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+    Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    \tparam PointRange is a model of `ConstRange` whose value type is `Point`.
+    \tparam OutputIterator is an output iterator accepting `FT`.
+  */
+  template <class ConcurrencyTag = Sequential_tag, class PointRange, class OutputIterator>
+  OutputIterator evaluate(const PointRange& points, OutputIterator values) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert(!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                  "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+    typedef typename Pointer_property_map<Point>::const_type Point_pmap;
+    typedef Spatial_sort_traits_adapter_3<Geom_traits, Point_pmap> Search_traits;
+
+    const std::vector<Point> queries(points.begin(), points.end());
+    if(queries.empty())
+      return values;
+
+    std::vector<std::size_t> order(queries.size());
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    hilbert_sort<ConcurrencyTag>(order.begin(), order.end(), Search_traits(make_property_map(queries)));
+
+    std::vector<FT> results(queries.size());
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      // consecutive queries in the same thread
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, order.size(), 256),
+                        [&](const tbb::blocked_range<std::size_t>& range)
+      {
+        for(std::size_t i = range.begin(); i != range.end(); ++i)
+          results[order[i]] = (*this)(queries[order[i]]);
+      });
+    }
+    else
+#endif
+    {
+      for(std::size_t i : order)
+        results[i] = (*this)(queries[i]);
+    }
+
+    return std::copy(results.begin(), results.end(), values);
+  }
+
   /// \cond SKIP_IN_MANUAL
   void initialize_cell_indices()
   {
@@ -726,6 +894,44 @@ public:
 // Private methods:
 private:
 
+  /// Locates `p`, trying first the cells recently found by the current thread.
+  Cell_handle locate(const Point& p) const
+  {
+#ifdef CGAL_LINKED_WITH_TBB
+    Recent_cells& recent_cells = m_recent_cells->local();
+    for(std::size_t i = 0; i < recent_cells.size; ++i)
+    {
+      Cell_handle ch = Triangulation_data_structure::Cell_range::s_iterator_to(*recent_cells.cells[i]);
+      FT a, b, c, d;
+      barycentric_coordinates(p, ch, a, b, c, d);
+      if(a >= 0 && b >= 0 && c >= 0 && d >= 0)
+        return ch;
+    }
+
+    Cell_handle hint = (recent_cells.size > 0)
+      ? Triangulation_data_structure::Cell_range::s_iterator_to(*recent_cells.cells[0])
+      : Cell_handle();
+    hint = m_tr->locate(p, hint);
+    if(! m_tr->is_infinite(hint))
+      recent_cells.push(hint);
+    return hint;
+#else
+    Cell_handle hint = m_hint.get();
+    hint = m_tr->locate(p, hint); // no hint when we use hierarchy
+    m_hint.set(hint);
+    return hint;
+#endif
+  }
+
+  /// The cells found before a change of the triangulation are not valid anymore.
+  void clear_hints()
+  {
+    m_hint.set(Cell_handle());
+#ifdef CGAL_LINKED_WITH_TBB
+    m_recent_cells->clear();
+#endif
+  }
+
   /// Delaunay refinement (break bad tetrahedra, where
   /// bad means badly shaped or too big). The normal of
   /// Steiner points is set to zero.
@@ -0,0 +1,691 @@
+// Copyright (c) 2026 agent.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent
+
+#ifndef CGAL_POISSON_SURFACE_RECONSTRUCTION_3_INTERNAL_OCTREE_POISSON_FUNCTION_H
+#define CGAL_POISSON_SURFACE_RECONSTRUCTION_3_INTERNAL_OCTREE_POISSON_FUNCTION_H
+
+#include <CGAL/license/Poisson_surface_reconstruction_3.h>
+
+#include <CGAL/IO/trace.h>
+#include <CGAL/Octree.h>
+#include <CGAL/Timer.h>
+#include <CGAL/assertions.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#endif
+
+namespace CGAL {
+namespace internal {
+namespace Poisson {
+
+/// \cond SKIP_IN_MANUAL
+
+// Screened Poisson implicit function on an adaptive octree.
+//
+// The octree is refined down to `max_depth` in the cells containing input points and their
+// neighbors, which keeps it graded. The function is trilinear in each cell of each level
+// (the nodes of a given depth), with its values stored at the corners of the cells.
+//
+// The levels are solved from the coarsest to the finest one (cascadic multigrid):
+// level d minimizes the screened Poisson energy
+//
+//   integral of |grad(f) - V|^2 + screening_weight / h_d * sum over input points p of w * f(p)^2,
+//
+// where V is the sum of the oriented normals n_p weighted by w (the area of a sample), and h_d the size
+// of the cells of level d. The corners on the boundary of the domain of level d that are inside the bounding
+// cube are set to the function of level d-1 (Dirichlet conditions), which also initializes the conjugate
+// gradient. The boundary of the bounding cube is free (Neumann conditions).
+//
+// A point is evaluated at the level of the leaf containing it, so the function is continuous.
+template <class Gt>
+class Octree_poisson_function
+{
+public:
+  typedef typename Gt::FT FT;
+  typedef typename Gt::Point_3 Point;
+  typedef typename Gt::Vector_3 Vector;
+
+private:
+  typedef std::vector<std::size_t> Point_indices;
+  typedef typename Pointer_property_map<Point>::const_type Point_map;
+  typedef Octree<Gt, Point_indices, Point_map> Tree;
+  typedef typename Tree::Node Node;
+  typedef typename Node::Global_coordinates Coordinates;
+  typedef std::unordered_map<std::uint64_t, std::size_t> Index_map;
+
+  struct Level
+  {
+    FT size;                 // size of the cells
+    std::vector<Node> cells;
+    Index_map cell_indices;
+    Index_map corner_indices;
+    std::vector<FT> values;  // at the corners
+  };
+
+  // Sparse symmetric matrix in compressed rows
+  struct Matrix
+  {
+    std::vector<std::size_t> row_begins;
+    std::vector<std::size_t> columns;
+    std::vector<FT> coefficients;
+  };
+
+  std::vector<Point> m_points;
+  std::vector<Vector> m_normals;
+  Point_indices m_indices;   // the point range of the octree, rearranged by it
+  Tree m_tree;
+  std::vector<Level> m_levels;
+
+public:
+  // Copies the points and normalizes the normals
+  template <class PointWithNormalRange>
+  Octree_poisson_function(const PointWithNormalRange& points_with_normals)
+    : m_points(init_points(points_with_normals))
+    , m_normals(init_normals(points_with_normals))
+    , m_indices(init_indices(m_points.size()))
+    , m_tree(m_indices, make_property_map(std::as_const(m_points)), FT(1.1))
+  {
+    CGAL_precondition(!m_points.empty());
+  }
+
+  // The octree refers to the point range
+  Octree_poisson_function(const Octree_poisson_function&) = delete;
+  Octree_poisson_function& operator=(const Octree_poisson_function&) = delete;
+
+  // Refines the octree, solves the levels, and shifts the function such that
+  // it is 0 at the input points (median), and orients it such that it is negative inside.
+  template <class ConcurrencyTag>
+  bool compute(const std::size_t max_depth,
+               const FT screening_weight,
+               const FT sample_area)
+  {
+    CGAL_precondition(max_depth <= 20); // coordinates of the corners are packed in 64 bits
+
+    CGAL::Timer task_timer; task_timer.start();
+    refine(max_depth);
+    CGAL_TRACE_STREAM << "Creates octree: depth " << m_tree.depth() << ", "
+                      << task_timer.time() << " seconds" << std::endl;
+    task_timer.reset();
+
+    for (std::size_t d = 0; d <= m_tree.depth(); ++d)
+    {
+      if (!solve_level<ConcurrencyTag>(d, screening_weight, sample_area))
+        return false;
+    }
+    CGAL_TRACE_STREAM << "Solve Poisson equation on octree: " << task_timer.time() << " seconds" << std::endl;
+
+    set_contouring_value<ConcurrencyTag>();
+    return true;
+  }
+
+  FT operator()(const Point& p) const
+  {
+    // clamp to the bounding cube
+    const Bbox_3 bbox = m_tree.bbox(m_tree.root());
+    const Point q((std::min)((std::max)(p.x(), FT(bbox.xmin())), FT(bbox.xmax())),
+                  (std::min)((std::max)(p.y(), FT(bbox.ymin())), FT(bbox.ymax())),
+                  (std::min)((std::max)(p.z(), FT(bbox.zmin())), FT(bbox.zmax())));
+
+    const Node leaf = m_tree.locate(q);
+    const Level& level = m_levels[leaf.depth()];
+    const Coordinates c = leaf.global_coordinates();
+    const std::array<FT, 3> u = {{ (q.x() - FT(bbox.xmin())) / level.size - FT(c[0]),
+                                   (q.y() - FT(bbox.ymin())) / level.size - FT(c[1]),
+                                   (q.z() - FT(bbox.zmin())) / level.size - FT(c[2]) }};
+
+    FT value = 0;
+    for (int corner = 0; corner < 8; ++corner)
+    {
+      const std::size_t index = level.corner_indices.find(corner_key(c, corner))->second;
+      value += basis(u, corner) * level.values[index];
+    }
+    return value;
+  }
+
+  // Point with the minimum value of the function among the corners of the cells
+  const Point& sink() const { return m_sink; }
+
+  std::size_t number_of_unknowns() const
+  {
+    std::size_t n = 0;
+    for (const Level& level : m_levels)
+      n += level.values.size();
+    return n;
+  }
+
+private:
+  Point m_sink;
+
+  template <class PointWithNormalRange>
+  static std::vector<Point> init_points(const PointWithNormalRange& points_with_normals)
+  {
+    std::vector<Point> points;
+    for (const auto& pwn : points_with_normals)
+      points.push_back(static_cast<const Point&>(pwn));
+    return points;
+  }
+
+  template <class PointWithNormalRange>
+  static std::vector<Vector> init_normals(const PointWithNormalRange& points_with_normals)
+  {
+    std::vector<Vector> normals;
+    for (const auto& pwn : points_with_normals)
+    {
+      const Vector& n = pwn.normal();
+      const FT sq_norm = n * n;
+      normals.push_back(sq_norm > FT(0) ? n / CGAL::sqrt(sq_norm) : n);
+    }
+    return normals;
+  }
+
+  static Point_indices init_indices(const std::size_t n)
+  {
+    Point_indices indices(n);
+    std::iota(indices.begin(), indices.end(), std::size_t(0));
+    return indices;
+  }
+
+  static std::uint64_t key(const std::int64_t i, const std::int64_t j, const std::int64_t k)
+  {
+    return (std::uint64_t(i) << 42) | (std::uint64_t(j) << 21) | std::uint64_t(k);
+  }
+
+  static std::uint64_t corner_key(const Coordinates& c, const int corner)
+  {
+    return key(c[0] + (corner & 1), c[1] + ((corner >> 1) & 1), c[2] + ((corner >> 2) & 1));
+  }
+
+  // Trilinear basis function of a corner of the unit cube, and its gradient
+  static FT basis(const std::array<FT, 3>& u, const int corner)
+  {
+    FT b = 1;
+    for (int i = 0; i < 3; ++i)
+      b *= ((corner >> i) & 1) ? u[i] : FT(1) - u[i];
+    return b;
+  }
+
+  static std::array<FT, 3> basis_gradient(const std::array<FT, 3>& u, const int corner)
+  {
+    std::array<FT, 3> g;
+    for (int i = 0; i < 3; ++i)
+    {
+      g[i] = ((corner >> i) & 1) ? FT(1) : FT(-1);
+      for (int j = 0; j < 3; ++j)
+        if (j != i)
+          g[i] *= ((corner >> j) & 1) ? u[j] : FT(1) - u[j];
+    }
+    return g;
+  }
+
+  // Stiffness matrix of the trilinear elements of the unit cube
+  static FT unit_stiffness(const int corner_a, const int corner_b)
+  {
+    const int differences = int((corner_a ^ corner_b) & 1) + int(((corner_a ^ corner_b) >> 1) & 1) +
+                            int(((corner_a ^ corner_b) >> 2) & 1);
+    switch (differences)
+    {
+      case 0: return FT(1) / FT(3);
+      case 1: return FT(0);
+      default: return FT(-1) / FT(12);
+    }
+  }
+
+  // Refines the octree in the cells that contain input points or that are adjacent to such cells
+  void refine(const std::size_t max_depth)
+  {
+    const Bbox_3 bbox = m_tree.bbox(m_tree.root());
+    const FT side = FT(bbox.xmax() - bbox.xmin());
+    const std::int64_t resolution = std::int64_t(1) << max_depth;
+
+    // occupied cells of each depth
+    std::vector<std::unordered_set<std::uint64_t> > occupied(max_depth + 1);
+    for (const Point& p : m_points)
+    {
+      std::array<std::int64_t, 3> c = {{ std::int64_t((p.x() - FT(bbox.xmin())) / side * FT(resolution)),
+                                         std::int64_t((p.y() - FT(bbox.ymin())) / side * FT(resolution)),
+                                         std::int64_t((p.z() - FT(bbox.zmin())) / side * FT(resolution)) }};
+      for (int i = 0; i < 3; ++i)
+        c[i] = (std::min)((std::max)(c[i], std::int64_t(0)), resolution - 1);
+      for (std::size_t d = 0; d <= max_depth; ++d)
+        occupied[d].insert(key(c[0] >> (max_depth - d), c[1] >> (max_depth - d), c[2] >> (max_depth - d)));
+    }
+
+    m_tree.refine([&](const Node& node) -> bool
+    {
+      if (node.depth() >= max_depth)
+        return false;
+
+      const std::unordered_set<std::uint64_t>& occupied_cells = occupied[node.depth()];
+      const std::int64_t n = std::int64_t(1) << node.depth();
+      const Coordinates c = node.global_coordinates();
+      for (std::int64_t i = std::int64_t(c[0]) - 1; i <= std::int64_t(c[0]) + 1; ++i)
+        for (std::int64_t j = std::int64_t(c[1]) - 1; j <= std::int64_t(c[1]) + 1; ++j)
+          for (std::int64_t k = std::int64_t(c[2]) - 1; k <= std::int64_t(c[2]) + 1; ++k)
+            if (i >= 0 && j >= 0 && k >= 0 && i < n && j < n && k < n &&
+                occupied_cells.count(key(i, j, k)) != 0)
+              return true;
+      return false;
+    });
+    // Refining the neighbors of the occupied cells keeps the octree graded:
+    // the depths of adjacent leaves differ by at most one.
+
+    m_levels.clear();
+    m_levels.resize(m_tree.depth() + 1);
+    for (std::size_t d = 0; d < m_levels.size(); ++d)
+      m_levels[d].size = side / FT(std::int64_t(1) << d);
+
+    for (Node node : m_tree.traverse(Orthtrees::Preorder_traversal()))
+    {
+      Level& level = m_levels[node.depth()];
+      const Coordinates c = node.global_coordinates();
+      level.cell_indices.emplace(key(c[0], c[1], c[2]), level.cells.size());
+      level.cells.push_back(node);
+    }
+  }
+
+  // Calls `f(i)` for `i` in `[0, n)`
+  template <class ConcurrencyTag, class Function>
+  static void for_each_index(const std::size_t n, const Function& f)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert(!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                  "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n),
+                        [&](const tbb::blocked_range<std::size_t>& range)
+      {
+        for (std::size_t i = range.begin(); i != range.end(); ++i)
+          f(i);
+      });
+      return;
+    }
+#endif
+    for (std::size_t i = 0; i < n; ++i)
+      f(i);
+  }
+
+  // Returns the sum of `f(i)` for `i` in `[0, n)`
+  template <class ConcurrencyTag, class Function>
+  static FT sum(const std::size_t n, const Function& f)
+  {
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      return tbb::parallel_reduce(tbb::blocked_range<std::size_t>(0, n), FT(0),
+                                  [&](const tbb::blocked_range<std::size_t>& range, FT s) -> FT
+                                  {
+                                    for (std::size_t i = range.begin(); i != range.end(); ++i)
+                                      s += f(i);
+                                    return s;
+                                  },
+                                  std::plus<FT>());
+    }
+#endif
+    FT s = 0;
+    for (std::size_t i = 0; i < n; ++i)
+      s += f(i);
+    return s;
+  }
+
+  template <class ConcurrencyTag>
+  bool solve_level(const std::size_t d,
+                   const FT screening_weight,
+                   const FT sample_area)
+  {
+    Level& level = m_levels[d];
+    const std::int64_t n = std::int64_t(1) << d;
+    const FT h = level.size;
+    const FT screening = screening_weight * sample_area / h;
+    const Bbox_3 bbox = m_tree.bbox(m_tree.root());
+
+    // Corners, and an incident cell of each of them
+    std::vector<std::size_t> corner_cells;
+    std::vector<std::array<std::int64_t, 3> > corners;
+    for (std::size_t i = 0; i < level.cells.size(); ++i)
+    {
+      const Coordinates c = level.cells[i].global_coordinates();
+      for (int corner = 0; corner < 8; ++corner)
+      {
+        if (level.corner_indices.emplace(corner_key(c, corner), corners.size()).second)
+        {
+          corners.push_back({{ std::int64_t(c[0]) + (corner & 1),
+                               std::int64_t(c[1]) + ((corner >> 1) & 1),
+                               std::int64_t(c[2]) + ((corner >> 2) & 1) }});
+          corner_cells.push_back(i);
+        }
+      }
+    }
+
+    // A corner is an unknown if all its incident cells inside the bounding cube are in the level
+    const std::size_t no_unknown = std::size_t(-1);
+    std::vector<std::size_t> unknowns(corners.size(), no_unknown);
+    std::vector<std::size_t> unknown_corners;
+    for (std::size_t i = 0; i < corners.size(); ++i)
+    {
+      bool is_free = true;
+      for (int cell = 0; cell < 8 && is_free; ++cell)
+      {
+        const std::int64_t ci = corners[i][0] - 1 + (cell & 1);
+        const std::int64_t cj = corners[i][1] - 1 + ((cell >> 1) & 1);
+        const std::int64_t ck = corners[i][2] - 1 + ((cell >> 2) & 1);
+        if (ci >= 0 && cj >= 0 && ck >= 0 && ci < n && cj < n && ck < n &&
+            level.cell_indices.count(key(ci, cj, ck)) == 0)
+          is_free = false;
+      }
+      if (is_free)
+      {
+        unknowns[i] = unknown_corners.size();
+        unknown_corners.push_back(i);
+      }
+    }
+
+    // Values of the coarser level, which are the boundary conditions and the initial guess
+    level.values.assign(corners.size(), FT(0));
+    if (d > 0)
+    {
+      const Level& coarse = m_levels[d - 1];
+      for_each_index<ConcurrencyTag>(corners.size(), [&](const std::size_t i)
+      {
+        const Coordinates c = level.cells[corner_cells[i]].global_coordinates();
+        const Coordinates parent = {{ c[0] / 2, c[1] / 2, c[2] / 2 }};
+        const std::array<FT, 3> u = {{ FT(corners[i][0] - 2 * std::int64_t(parent[0])) / FT(2),
+                                       FT(corners[i][1] - 2 * std::int64_t(parent[1])) / FT(2),
+                                       FT(corners[i][2] - 2 * std::int64_t(parent[2])) / FT(2) }};
+        FT value = 0;
+        for (int corner = 0; corner < 8; ++corner)
+        {
+          const FT b = basis(u, corner);
+          if (b != FT(0))
+            value += b * coarse.values[coarse.corner_indices.find(corner_key(parent, corner))->second];
+        }
+        level.values[i] = value;
+      });
+    }
+
+    if (!unknown_corners.empty())
+    {
+      // Assembles the rows of the unknowns
+      Matrix A;
+      std::vector<FT> B(unknown_corners.size(), FT(0));
+      A.row_begins.assign(unknown_corners.size() + 1, 0);
+
+      // Coefficients of a row with the 27 corners around the unknown, and its right hand side
+      auto assemble_row = [&](const std::size_t row, std::array<FT, 27>& coefficients, FT& rhs)
+      {
+        const std::array<std::int64_t, 3>& a = corners[unknown_corners[row]];
+        coefficients.fill(FT(0));
+        rhs = FT(0);
+        for (int cell = 0; cell < 8; ++cell)
+        {
+          const std::int64_t ci = a[0] - 1 + (cell & 1);
+          const std::int64_t cj = a[1] - 1 + ((cell >> 1) & 1);
+          const std::int64_t ck = a[2] - 1 + ((cell >> 2) & 1);
+          if (ci < 0 || cj < 0 || ck < 0 || ci >= n || cj >= n || ck >= n)
+            continue;
+
+          const Node& node = level.cells[level.cell_indices.find(key(ci, cj, ck))->second];
+          const int corner_a = (1 - (cell & 1)) | ((1 - ((cell >> 1) & 1)) << 1) | ((1 - ((cell >> 2) & 1)) << 2);
+          for (int corner_b = 0; corner_b < 8; ++corner_b)
+          {
+            const int slot = ((cell & 1) + (corner_b & 1)) +
+                             3 * (((cell >> 1) & 1) + ((corner_b >> 1) & 1)) +
+                             9 * (((cell >> 2) & 1) + ((corner_b >> 2) & 1));
+            coefficients[slot] += h * unit_stiffness(corner_a, corner_b);
+          }
+
+          const Point origin(FT(bbox.xmin()) + FT(ci) * h,
+                             FT(bbox.ymin()) + FT(cj) * h,
+                             FT(bbox.zmin()) + FT(ck) * h);
+          for (std::size_t index : node)
+          {
+            const Point& p = m_points[index];
+            std::array<FT, 3> u = {{ (p.x() - origin.x()) / h, (p.y() - origin.y()) / h, (p.z() - origin.z()) / h }};
+            for (int i = 0; i < 3; ++i)
+              u[i] = (std::min)((std::max)(u[i], FT(0)), FT(1));
+
+            const std::array<FT, 3> g = basis_gradient(u, corner_a);
+            const Vector& normal = m_normals[index];
+            rhs += sample_area * (normal.x() * g[0] + normal.y() * g[1] + normal.z() * g[2]) / h;
+
+            const FT ba = screening * basis(u, corner_a);
+            for (int corner_b = 0; corner_b < 8; ++corner_b)
+            {
+              const int slot = ((cell & 1) + (corner_b & 1)) +
+                               3 * (((cell >> 1) & 1) + ((corner_b >> 1) & 1)) +
+                               9 * (((cell >> 2) & 1) + ((corner_b >> 2) & 1));
+              coefficients[slot] += ba * basis(u, corner_b);
+            }
+          }
+        }
+      };
+
+      auto neighbor = [&](const std::size_t row, const int slot) -> std::size_t
+      {
+        const std::array<std::int64_t, 3>& a = corners[unknown_corners[row]];
+        const std::int64_t i = a[0] - 1 + slot % 3, j = a[1] - 1 + (slot / 3) % 3, k = a[2] - 1 + slot / 9;
+        if (i < 0 || j < 0 || k < 0 || i > n || j > n || k > n)
+          return std::size_t(-1);
+        typename Index_map::const_iterator it = level.corner_indices.find(key(i, j, k));
+        return it == level.corner_indices.end() ? std::size_t(-1) : it->second;
+      };
+
+      for_each_index<ConcurrencyTag>(unknown_corners.size(), [&](const std::size_t row)
+      {
+        std::size_t count = 0;
+        for (int slot = 0; slot < 27; ++slot)
+        {
+          const std::size_t b = neighbor(row, slot);
+          if (b != std::size_t(-1) && unknowns[b] != no_unknown)
+            ++count;
+        }
+        A.row_begins[row + 1] = count;
+      });
+      std::partial_sum(A.row_begins.begin(), A.row_begins.end(), A.row_begins.begin());
+      A.columns.resize(A.row_begins.back());
+      A.coefficients.resize(A.row_begins.back());
+
+      for_each_index<ConcurrencyTag>(unknown_corners.size(), [&](const std::size_t row)
+      {
+        std::array<FT, 27> coefficients;
+        FT rhs;
+        assemble_row(row, coefficients, rhs);
+
+        std::size_t entry = A.row_begins[row];
+        for (int slot = 0; slot < 27; ++slot)
+        {
+          const std::size_t b = neighbor(row, slot);
+          if (b == std::size_t(-1))
+            continue;
+          if (unknowns[b] != no_unknown)
+          {
+            A.columns[entry] = unknowns[b];
+            A.coefficients[entry] = coefficients[slot];
+            ++entry;
+          }
+          else
+          {
+            rhs -= coefficients[slot] * level.values[b]; // boundary condition
+          }
+        }
+        B[row] = rhs;
+      });
+
+      std::vector<FT> X(unknown_corners.size());
+      for (std::size_t row = 0; row < X.size(); ++row)
+        X[row] = level.values[unknown_corners[row]];
+
+      const std::size_t nb_iterations = conjugate_gradient<ConcurrencyTag>(A, B, X);
+      CGAL_TRACE_STREAM << "  Level " << d << ": " << level.cells.size() << " cells, "
+                        << unknown_corners.size() << " unknowns, "
+                        << nb_iterations << " iterations" << std::endl;
+
+      for (std::size_t row = 0; row < X.size(); ++row)
+      {
+        if (!is_valid(X[row]))
+          return false;
+        level.values[unknown_corners[row]] = X[row];
+      }
+    }
+
+    // only the corners are needed for the evaluation
+    Index_map().swap(level.cell_indices);
+    return true;
+  }
+
+  // Solves A*X = B with the Jacobi-preconditioned conjugate gradient, starting from X
+  template <class ConcurrencyTag>
+  static std::size_t conjugate_gradient(const Matrix& A, const std::vector<FT>& B, std::vector<FT>& X)
+  {
+    const std::size_t size = B.size();
+    const FT tolerance = 1e-6;
+    const std::size_t max_iterations = (std::max)(std::size_t(100), std::size_t(std::sqrt(double(size))));
+
+    auto product = [&](const std::vector<FT>& V, std::vector<FT>& AV)
+    {
+      for_each_index<ConcurrencyTag>(size, [&](const std::size_t row)
+      {
+        FT s = 0;
+        for (std::size_t e = A.row_begins[row]; e != A.row_begins[row + 1]; ++e)
+          s += A.coefficients[e] * V[A.columns[e]];
+        AV[row] = s;
+      });
+    };
+
+    std::vector<FT> inverse_diagonal(size, FT(1));
+    for_each_index<ConcurrencyTag>(size, [&](const std::size_t row)
+    {
+      for (std::size_t e = A.row_begins[row]; e != A.row_begins[row + 1]; ++e)
+        if (A.columns[e] == row && A.coefficients[e] > FT(0))
+          inverse_diagonal[row] = FT(1) / A.coefficients[e];
+    });
+
+    std::vector<FT> R(size), Z(size), P(size), AP(size);
+    product(X, AP);
+    for_each_index<ConcurrencyTag>(size, [&](const std::size_t i)
+    {
+      R[i] = B[i] - AP[i];
+      Z[i] = inverse_diagonal[i] * R[i];
+      P[i] = Z[i];
+    });
+
+    const FT sq_norm_B = sum<ConcurrencyTag>(size, [&](const std::size_t i) { return B[i] * B[i]; });
+    const FT sq_threshold = CGAL::square(tolerance) * sq_norm_B;
+    FT rz = sum<ConcurrencyTag>(size, [&](const std::size_t i) { return R[i] * Z[i]; });
+
+    std::size_t iteration = 0;
+    for (; iteration < max_iterations; ++iteration)
+    {
+      const FT sq_norm_R = sum<ConcurrencyTag>(size, [&](const std::size_t i) { return R[i] * R[i]; });
+      if (sq_norm_R <= sq_threshold)
+        break;
+
+      product(P, AP);
+      const FT pap = sum<ConcurrencyTag>(size, [&](const std::size_t i) { return P[i] * AP[i]; });
+      if (pap <= FT(0))
+        break;
+
+      const FT alpha = rz / pap;
+      for_each_index<ConcurrencyTag>(size, [&](const std::size_t i)
+      {
+        X[i] += alpha * P[i];
+        R[i] -= alpha * AP[i];
+        Z[i] = inverse_diagonal[i] * R[i];
+      });
+
+      const FT new_rz = sum<ConcurrencyTag>(size, [&](const std::size_t i) { return R[i] * Z[i]; });
+      const FT beta = new_rz / rz;
+      rz = new_rz;
+      for_each_index<ConcurrencyTag>(size, [&](const std::size_t i) { P[i] = Z[i] + beta * P[i]; });
+    }
+    return iteration;
+  }
+
+  // Shifts the function such that its median value at the input points is 0, orients it such that
+  // it is positive on the boundary of the bounding cube, and updates the sink.
+  template <class ConcurrencyTag>
+  void set_contouring_value()
+  {
+    std::vector<FT> values(m_points.size());
+    for_each_index<ConcurrencyTag>(m_points.size(), [&](const std::size_t i)
+    {
+      values[i] = (*this)(m_points[i]);
+    });
+
+    FT median = 0;
+    if (!values.empty())
+    {
+      std::nth_element(values.begin(), values.begin() + values.size() / 2, values.end());
+      median = values[values.size() / 2];
+    }
+
+    // the corners of the root are outside
+    const Level& root = m_levels.front();
+    std::size_t nb_negative = 0;
+    for (std::size_t i = 0; i < root.values.size(); ++i)
+      if (root.values[i] < median)
+        ++nb_negative;
+    const FT sign = (nb_negative > root.values.size() / 2) ? FT(-1) : FT(1);
+
+    for (Level& level : m_levels)
+      for (FT& value : level.values)
+        value = sign * (value - median);
+
+    // Find the minimum among the corners of the finest level containing them
+    const Bbox_3 bbox = m_tree.bbox(m_tree.root());
+    FT min_value = (std::numeric_limits<FT>::max)();
+    m_sink = Point(bbox.xmin(), bbox.ymin(), bbox.zmin());
+    for (const Level& level : m_levels)
+    {
+      for (const auto& corner : level.corner_indices)
+      {
+        if (level.values[corner.second] >= min_value)
+          continue;
+
+        const Point p(FT(bbox.xmin()) + FT(std::int64_t(corner.first >> 42)) * level.size,
+                      FT(bbox.ymin()) + FT(std::int64_t((corner.first >> 21) & ((1 << 21) - 1))) * level.size,
+                      FT(bbox.zmin()) + FT(std::int64_t(corner.first & ((1 << 21) - 1))) * level.size);
+        const FT value = (*this)(p);
+        if (value < min_value)
+        {
+          min_value = value;
+          m_sink = p;
+        }
+      }
+    }
+  }
+};
+
+/// \endcond
+
+} // namespace Poisson
+} // namespace internal
+} // namespace CGAL
+
+#endif // CGAL_POISSON_SURFACE_RECONSTRUCTION_3_INTERNAL_OCTREE_POISSON_FUNCTION_H
@@ -0,0 +1,149 @@
+// poisson_octree_test.cpp
+
+//----------------------------------------------------------
+// Test the screened Poisson implicit function computed on an octree:
+// - on a sampled sphere, the zero level set is close to the sphere,
+// - on a scan, the function is negative inside and positive outside
+//   the input points, along their normals,
+// - the sequential and parallel functions are the same.
+//----------------------------------------------------------
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Poisson_reconstruction_function.h>
+#include <CGAL/Point_with_normal_3.h>
+#include <CGAL/property_map.h>
+#include <CGAL/IO/read_points.h>
+#include <CGAL/compute_average_spacing.h>
+#include <CGAL/Random.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+#endif
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::FT FT;
+typedef Kernel::Point_3 Point;
+typedef Kernel::Vector_3 Vector;
+typedef CGAL::Point_with_normal_3<Kernel> Point_with_normal;
+typedef std::vector<Point_with_normal> PointList;
+
+typedef CGAL::Poisson_reconstruction_function<Kernel> Poisson_reconstruction_function;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+void test_sphere(CGAL::Random& rnd)
+{
+  PointList points;
+  for(int i = 0; i < 20000; ++i)
+  {
+    const Vector n = Vector(rnd.get_double(-1, 1), rnd.get_double(-1, 1), rnd.get_double(-1, 1));
+    if(n.squared_length() < 1e-4 || n.squared_length() > 1.)
+      continue;
+    const Vector u = n / std::sqrt(n.squared_length());
+    points.push_back(Point_with_normal(CGAL::ORIGIN + u, u));
+  }
+
+  Poisson_reconstruction_function function(points.begin(), points.end(),
+                                           CGAL::make_normal_of_point_with_normal_map(PointList::value_type()));
+  const bool ok = function.compute_implicit_function_on_octree(7);
+  assert(ok);
+  assert(function(CGAL::ORIGIN) < 0);
+  assert(function(function.get_inner_point()) < 0);
+
+  // the zero level set is close to the sphere
+  double max_error = 0;
+  for(int i = 0; i < 100; ++i)
+  {
+    const Vector d = points[rnd.get_int(0, int(points.size()))] - CGAL::ORIGIN;
+    double inside = 0.5, outside = 1.5;
+    assert(function(CGAL::ORIGIN + inside * d) < 0);
+    assert(function(CGAL::ORIGIN + outside * d) > 0);
+    while(outside - inside > 1e-4)
+    {
+      const double mid = 0.5 * (inside + outside);
+      if(function(CGAL::ORIGIN + mid * d) < 0)
+        inside = mid;
+      else
+        outside = mid;
+    }
+    max_error = (std::max)(max_error, std::abs(inside - 1.));
+  }
+  std::cout << "  sphere: max distance of the level set to the sphere " << max_error << std::endl;
+  assert(max_error < 0.02);
+}
+
+void test_scan(const PointList& points)
+{
+  const std::vector<Point> positions(points.begin(), points.end());
+  const FT spacing = CGAL::compute_average_spacing<CGAL::Sequential_tag>(positions, 6);
+
+  Poisson_reconstruction_function seq_function(points.begin(), points.end(),
+                                               CGAL::make_normal_of_point_with_normal_map(PointList::value_type()));
+  Poisson_reconstruction_function par_function(points.begin(), points.end(),
+                                               CGAL::make_normal_of_point_with_normal_map(PointList::value_type()));
+  bool ok = seq_function.compute_implicit_function_on_octree(7);
+  assert(ok);
+  ok = par_function.compute_implicit_function_on_octree<Concurrency_tag>(7);
+  assert(ok);
+
+  // the function is negative behind the input points, and positive in front of them
+  std::size_t nb_consistent = 0;
+  FT max_difference = 0;
+  for(const Point_with_normal& p : points)
+  {
+    const Vector n = p.normal() / std::sqrt(p.normal().squared_length());
+    const FT behind = par_function(p - spacing * n);
+    const FT in_front = par_function(p + spacing * n);
+    if(behind < 0 && in_front > 0)
+      ++nb_consistent;
+
+    max_difference = (std::max)(max_difference, std::abs(behind - seq_function(p - spacing * n)));
+    max_difference = (std::max)(max_difference, std::abs(in_front - seq_function(p + spacing * n)));
+  }
+  std::cout << "  scan: " << nb_consistent << " out of " << points.size()
+            << " points are consistent with their normals" << std::endl;
+  std::cout << "  scan: sequential and parallel values differ by at most " << max_difference << std::endl;
+  assert(nb_consistent > 0.95 * points.size());
+  assert(max_difference < 1e-3);
+}
+
+void test(const PointList& scan)
+{
+  CGAL::Random rnd(0);
+  std::cout << "== sphere" << std::endl;
+  test_sphere(rnd);
+  std::cout << "== scan" << std::endl;
+  test_scan(scan);
+}
+
+int main()
+{
+  PointList scan;
+  const bool ok = CGAL::IO::read_points(CGAL::data_file_path("points_3/oni.pwn"), std::back_inserter(scan),
+                                        CGAL::parameters::normal_map(CGAL::make_normal_of_point_with_normal_map(PointList::value_type())));
+  assert(ok && !scan.empty());
+  CGAL_USE(ok);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // solve with several threads, whatever the number of cores
+  tbb::global_control c(tbb::global_control::max_allowed_parallelism, 4);
+  tbb::task_arena arena(4);
+  arena.execute([&]{ test(scan); });
+#else
+  test(scan);
+#endif
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
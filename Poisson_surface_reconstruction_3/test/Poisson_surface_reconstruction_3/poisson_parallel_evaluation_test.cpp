@@ -0,0 +1,141 @@
+// poisson_parallel_evaluation_test.cpp
+
+//----------------------------------------------------------
+// Test the evaluation of the Poisson implicit function:
+// - the batched evaluation gives the values of operator(), in the input order,
+// - operator() can be called by several threads at the same time,
+//   also on copies of the function.
+//----------------------------------------------------------
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Poisson_reconstruction_function.h>
+#include <CGAL/Point_with_normal_3.h>
+#include <CGAL/property_map.h>
+#include <CGAL/IO/read_points.h>
+#include <CGAL/Random.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::FT FT;
+typedef Kernel::Point_3 Point;
+typedef CGAL::Point_with_normal_3<Kernel> Point_with_normal;
+typedef std::vector<Point_with_normal> PointList;
+
+typedef CGAL::Poisson_reconstruction_function<Kernel> Poisson_reconstruction_function;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+// a point may be located in one of the cells incident to a facet, with
+// slightly different barycentric coordinates
+bool same_value(FT v1, FT v2)
+{
+  return std::abs(v1 - v2) <= 1e-10 * (std::max)(FT(1), std::abs(v1));
+}
+
+void test_evaluation(const Poisson_reconstruction_function& function,
+                     const std::vector<Point>& queries)
+{
+  std::vector<FT> reference;
+  for(const Point& q : queries)
+    reference.push_back(function(q));
+
+  std::vector<FT> seq_values, par_values;
+  function.evaluate(queries, std::back_inserter(seq_values));
+  function.evaluate<Concurrency_tag>(queries, std::back_inserter(par_values));
+  assert(seq_values.size() == queries.size());
+  assert(par_values.size() == queries.size());
+  for(std::size_t i = 0; i < queries.size(); ++i)
+  {
+    assert(same_value(reference[i], seq_values[i]));
+    assert(same_value(reference[i], par_values[i]));
+  }
+
+  std::vector<FT> no_values;
+  function.evaluate<Concurrency_tag>(std::vector<Point>(), std::back_inserter(no_values));
+  assert(no_values.empty());
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // concurrent calls to operator(), on the function and on a copy
+  const Poisson_reconstruction_function copy = function;
+  std::vector<FT> concurrent_values(queries.size());
+  tbb::parallel_for(std::size_t(0), queries.size(), [&](std::size_t i)
+  {
+    concurrent_values[i] = (i % 2 == 0) ? function(queries[i]) : copy(queries[i]);
+  });
+  for(std::size_t i = 0; i < queries.size(); ++i)
+    assert(same_value(reference[i], concurrent_values[i]));
+#endif
+}
+
+void test(const PointList& points)
+{
+  CGAL::Random rnd(0);
+
+  Poisson_reconstruction_function function(points.begin(), points.end(),
+                                           CGAL::make_normal_of_point_with_normal_map(PointList::value_type()));
+  bool ok = function.compute_implicit_function();
+  assert(ok);
+
+  // random points in the bounding box, and points close to the input points
+  const CGAL::Bbox_3 bbox = CGAL::bbox_3(points.begin(), points.end());
+  std::vector<Point> queries;
+  for(int i = 0; i < 20000; ++i)
+    queries.push_back(Point(rnd.get_double(bbox.xmin(), bbox.xmax()),
+                            rnd.get_double(bbox.ymin(), bbox.ymax()),
+                            rnd.get_double(bbox.zmin(), bbox.zmax())));
+  for(const Point_with_normal& p : points)
+    queries.push_back(p + 1e-3 * p.normal());
+
+  std::cout << "== Delaunay refinement" << std::endl;
+  test_evaluation(function, queries);
+
+  ok = function.compute_implicit_function_on_octree(6);
+  assert(ok);
+  std::cout << "== octree" << std::endl;
+  test_evaluation(function, queries);
+
+  // the hints are reset when the triangulation is refined again
+  ok = function.compute_implicit_function();
+  assert(ok);
+  std::cout << "== Delaunay refinement again" << std::endl;
+  test_evaluation(function, queries);
+
+  std::cout << "  " << queries.size() << " queries" << std::endl;
+}
+
+int main()
+{
+  PointList points;
+  const bool ok = CGAL::IO::read_points(CGAL::data_file_path("points_3/oni.pwn"), std::back_inserter(points),
+                                        CGAL::parameters::normal_map(CGAL::make_normal_of_point_with_normal_map(PointList::value_type())));
+  assert(ok && !points.empty());
+  CGAL_USE(ok);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // evaluate with several threads, whatever the number of cores
+  tbb::global_control c(tbb::global_control::max_allowed_parallelism, 4);
+  tbb::task_arena arena(4);
+  arena.execute([&]{ test(points); });
+#else
+  test(points);
+#endif
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -145,6 +145,18 @@ enum Boolean_operation_type {UNION = 0, INTERSECTION=1,
   *     \cgalParamDefault{`false`}
   *     \cgalParamExtra{`np1` only}
   *   \cgalParamNEnd
+  *
+  *   \cgalParamNBegin{concurrency_tag}
+  *     \cgalParamDescription{a tag enabling sequential versus parallel detection of the intersections}
+  *     \cgalParamType{`CGAL::Sequential_tag`, `CGAL::Parallel_if_available_tag`, or `CGAL::Parallel_tag`}
+  *     \cgalParamDefault{`CGAL::Sequential_tag`}
+  *     \cgalParamExtra{`np1` only. With `CGAL::Parallel_tag`, the bounding box filtering, the edge-face
+  *                     intersection tests, the construction of the intersection points, and the triangulation
+  *                     of the intersected faces run in parallel. The intersection points are numbered and the
+  *                     triangulations are imported in the meshes sequentially, so the output is the same as in
+  *                     the sequential version, up to the order of its elements. Points of the vertex point maps
+  *                     must then be safe to read concurrently.}
+  *   \cgalParamNEnd
   * \cgalNamedParamsEnd
   *
   * @param nps_out an optional tuple of sequences of \ref bgl_namedparameters "Named Parameters" each among the ones listed below
@@ -384,8 +396,15 @@ corefine_and_compute_boolean_operations(
                                                   Edge_mark_map_tuple,
                                                   User_visitor> Ob;
 
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    NamedParameters1,
+    Sequential_tag
+  > ::type Concurrency_tag;
+
   typedef Corefinement::Surface_intersection_visitor_for_corefinement<
-            TriangleMesh, VPM1, VPM2, Ob, Ecm_in, User_visitor> Algo_visitor;
+            TriangleMesh, VPM1, VPM2, Ob, Ecm_in, User_visitor,
+            false, false, Concurrency_tag> Algo_visitor;
 
   Ecm_in ecm_in(tm1,tm2,ecm1,ecm2);
   Edge_mark_map_tuple ecms_out(ecm_out_0, ecm_out_1, ecm_out_2, ecm_out_3);
@@ -403,7 +422,7 @@ corefine_and_compute_boolean_operations(
     ob.setup_for_clipping_a_surface(use_compact_clipper);
   }
 
-  Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor >
+  Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor, Concurrency_tag >
     functor(tm1, tm2, vpm1, vpm2, Algo_visitor(uv,ob,ecm_in));
   functor(CGAL::Emptyset_iterator(), throw_on_self_intersection, true);
 
@@ -484,6 +503,18 @@ corefine_and_compute_boolean_operations(
   *     \cgalParamDefault{`false`}
   *     \cgalParamExtra{`np1` only}
   *   \cgalParamNEnd
+  *
+  *   \cgalParamNBegin{concurrency_tag}
+  *     \cgalParamDescription{a tag enabling sequential versus parallel detection of the intersections}
+  *     \cgalParamType{`CGAL::Sequential_tag`, `CGAL::Parallel_if_available_tag`, or `CGAL::Parallel_tag`}
+  *     \cgalParamDefault{`CGAL::Sequential_tag`}
+  *     \cgalParamExtra{`np1` only. With `CGAL::Parallel_tag`, the bounding box filtering, the edge-face
+  *                     intersection tests, the construction of the intersection points, and the triangulation
+  *                     of the intersected faces run in parallel. The intersection points are numbered and the
+  *                     triangulations are imported in the meshes sequentially, so the output is the same as in
+  *                     the sequential version, up to the order of its elements. Points of the vertex point maps
+  *                     must then be safe to read concurrently.}
+  *   \cgalParamNEnd
   * \cgalNamedParamsEnd
   *
   * @param np_out an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
@@ -651,6 +682,17 @@ corefine_and_compute_difference(      TriangleMesh& tm1,
  *     \cgalParamDefault{`false`}
  *     \cgalParamExtra{`np1` only}
  *   \cgalParamNEnd
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag enabling sequential versus parallel detection of the intersections}
+ *     \cgalParamType{`CGAL::Sequential_tag`, `CGAL::Parallel_if_available_tag`, or `CGAL::Parallel_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *     \cgalParamExtra{`np1` only. With `CGAL::Parallel_tag`, the bounding box filtering, the edge-face
+ *                     intersection tests, the construction of the intersection points, and the triangulation
+ *                     of the intersected faces run in parallel. The intersection points are numbered and the
+ *                     triangulations are imported in the meshes sequentially, so the output is the same as in
+ *                     the sequential version, up to the order of its elements. Points of the vertex point maps
+ *                     must then be safe to read concurrently.}
+ *   \cgalParamNEnd
  *   \cgalParamNBegin{do_not_modify}
  *     \cgalParamDescription{if `true`, the corresponding mesh will not be updated.}
  *     \cgalParamType{Boolean}
@@ -742,12 +784,19 @@ corefine(      TriangleMesh& tm1,
 
 // surface intersection algorithm call
   typedef Corefinement::No_extra_output_from_corefinement<TriangleMesh> Ob;
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    NamedParameters1,
+    Sequential_tag
+  > ::type Concurrency_tag;
+
   typedef Corefinement::Surface_intersection_visitor_for_corefinement<
-  TriangleMesh, VPM1, VPM2, Ob, Ecm, User_visitor, false, handle_non_manifold_features> Algo_visitor;
+  TriangleMesh, VPM1, VPM2, Ob, Ecm, User_visitor, false, handle_non_manifold_features,
+  Concurrency_tag> Algo_visitor;
 
   Ob ob;
   Ecm ecm(tm1,tm2,ecm1,ecm2);
-  Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor>
+  Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor, Concurrency_tag>
     functor(tm1, tm2, vpm1, vpm2, Algo_visitor(uv,ob,ecm,const_mesh_ptr), const_mesh_ptr);
 
   // Fill non-manifold feature maps if provided
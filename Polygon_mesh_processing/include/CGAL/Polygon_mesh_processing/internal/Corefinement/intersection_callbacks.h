@@ -420,6 +420,43 @@ public:
   }
 };
 
+// Thread-safe stand-ins for the containers filled by the callbacks above, used when
+// the box intersection is run in parallel: the pairs are only collected, and
+// are inserted in the actual containers once all the boxes have been reported.
+template <class EdgeFacePairs>
+class Concurrent_edge_to_faces {
+  typedef typename EdgeFacePairs::value_type::first_type edge_descriptor;
+  typedef typename EdgeFacePairs::value_type::second_type face_descriptor;
+
+  EdgeFacePairs& pairs;
+
+  struct Face_inserter {
+    EdgeFacePairs& pairs;
+    edge_descriptor ed;
+
+    void insert(face_descriptor fd) { pairs.push_back(std::make_pair(ed, fd)); }
+  };
+
+public:
+  Concurrent_edge_to_faces(EdgeFacePairs& pairs)
+    : pairs(pairs)
+  {}
+
+  Face_inserter operator[](edge_descriptor ed) { return Face_inserter{pairs, ed}; }
+};
+
+template <class FacePairs>
+class Concurrent_face_pair_set {
+  FacePairs& pairs;
+
+public:
+  Concurrent_face_pair_set(FacePairs& pairs)
+    : pairs(pairs)
+  {}
+
+  void insert(const typename FacePairs::value_type& fp) { pairs.push_back(fp); }
+};
+
 } } } // CGAL::Polygon_mesh_processing::Corefinement
 
 #endif // CGAL_POLYGON_MESH_PROCESSING_INTERNAL_COREFINEMENT_INTERSECTION_CALLBACK_H
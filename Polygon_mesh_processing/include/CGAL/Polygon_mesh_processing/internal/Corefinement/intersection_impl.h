@@ -24,15 +24,27 @@
 #include <CGAL/Polygon_mesh_processing/internal/Corefinement/intersection_nodes.h>
 #include <CGAL/Polygon_mesh_processing/internal/Corefinement/intersect_triangle_and_segment_3.h>
 #include <CGAL/Polygon_mesh_processing/Non_manifold_feature_map.h>
+#include <CGAL/tags.h>
+#include <CGAL/use.h>
 #include <CGAL/utility.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/concurrent_vector.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#endif
+
 #include <boost/dynamic_bitset.hpp>
 #include <boost/container/flat_set.hpp>
 #include <boost/functional/hash.hpp>
 
+#include <optional>
 #include <stdexcept>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace CGAL{
 namespace Polygon_mesh_processing {
@@ -193,10 +205,16 @@ struct Node_id_set {
 
 template< class TriangleMesh,
           class VertexPointMap1, class VertexPointMap2,
-          class Node_visitor=Default_surface_intersection_visitor<TriangleMesh>
+          class Node_visitor=Default_surface_intersection_visitor<TriangleMesh>,
+          class ConcurrencyTag=Sequential_tag
          >
 class Intersection_of_triangle_meshes
 {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
   typedef boost::graph_traits<TriangleMesh> graph_traits;
   typedef typename graph_traits::face_descriptor face_descriptor;
   typedef typename graph_traits::edge_descriptor edge_descriptor;
@@ -217,6 +235,8 @@ class Intersection_of_triangle_meshes
 
   typedef std::size_t Node_id;
 
+  typedef std::tuple<Intersection_type, halfedge_descriptor, bool,bool>  Inter_type;
+
   // we use Face_pair_and_int and not Face_pair to handle coplanar case.
   // Indeed the boundary of the intersection of two coplanar triangles
   // may contain several segments.
@@ -225,6 +245,12 @@ class Intersection_of_triangle_meshes
                              VertexPointMap1, VertexPointMap2,
                              Predicates_on_constructions_needed>    Node_vector;
 
+  // intersection types of an edge with the faces it may intersect, in the order of its Face_set,
+  // with the intersection point if the edge crosses the interior of the face
+  typedef std::tuple<face_descriptor, Inter_type,
+                     std::optional<typename Node_vector::Node_point> >    Edge_face_inter_type;
+  typedef std::vector<Edge_face_inter_type>                              Edge_inter_types;
+
 // data members
   Edge_to_faces stm_edge_to_ltm_faces; // map edges from the triangle mesh with the smaller address to faces of the triangle mesh with the larger address
   Edge_to_faces ltm_edge_to_stm_faces; // map edges from the triangle mesh with the larger address to faces of the triangle mesh with the smaller address
@@ -382,13 +408,118 @@ class Intersection_of_triangle_meshes
                                     filtered_callback, cutoff );
         }
         else
+        {
+#ifdef CGAL_LINKED_WITH_TBB
+          if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+          {
+            parallel_filter_intersections(tm_f, tm_e, vpm_f, vpm_e,
+                                          face_boxes_ptr, edge_boxes_ptr,
+                                          edge_to_faces, cutoff);
+            return;
+          }
+#endif
           CGAL::box_intersection_d( face_boxes_ptr.begin(), face_boxes_ptr.end(),
                                     edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
                                     callback, cutoff );
+        }
       }
     }
   }
 
+#ifdef CGAL_LINKED_WITH_TBB
+  // The boxes are intersected in parallel, and the orientation tests of the callback
+  // are run concurrently. Intersecting pairs are then sorted and inserted sequentially.
+  template <class VPMF, class VPME>
+  void parallel_filter_intersections(const TriangleMesh& tm_f,
+                                     const TriangleMesh& tm_e,
+                                     const VPMF& vpm_f,
+                                     const VPME& vpm_e,
+                                     std::vector<Box*>& face_boxes_ptr,
+                                     std::vector<Box*>& edge_boxes_ptr,
+                                     Edge_to_faces& edge_to_faces,
+                                     std::ptrdiff_t cutoff)
+  {
+    typedef tbb::concurrent_vector<std::pair<edge_descriptor, face_descriptor> > Edge_face_pairs;
+    typedef tbb::concurrent_vector<Face_pair>                                    Face_pairs;
+    typedef Concurrent_edge_to_faces<Edge_face_pairs>                            Concurrent_edge_to_faces_map;
+
+    Edge_face_pairs edge_face_pairs;
+    Concurrent_edge_to_faces_map concurrent_edge_to_faces(edge_face_pairs);
+
+    #ifdef DO_NOT_HANDLE_COPLANAR_FACES
+    CGAL_USE(vpm_f); CGAL_USE(vpm_e);
+    typedef Collect_face_bbox_per_edge_bbox<TriangleMesh, Concurrent_edge_to_faces_map>
+      Callback;
+    Callback callback(tm_f, tm_e, concurrent_edge_to_faces);
+    #else
+    typedef Concurrent_face_pair_set<Face_pairs> Concurrent_coplanar_face_set;
+
+    Face_pairs face_pairs;
+    Concurrent_coplanar_face_set concurrent_coplanar_faces(face_pairs);
+
+    typedef Collect_face_bbox_per_edge_bbox_with_coplanar_handling<
+      TriangleMesh, VPMF, VPME, Concurrent_edge_to_faces_map, Concurrent_coplanar_face_set, Node_visitor>
+     Callback;
+    Callback callback(tm_f, tm_e, vpm_f, vpm_e, concurrent_edge_to_faces, concurrent_coplanar_faces, visitor);
+    #endif
+
+    // the lambda does not forward progress() since the visitor is not required to be thread-safe
+    auto parallel_callback = [&callback](const Box* fb, const Box* eb)
+    {
+      callback(fb, eb);
+    };
+    CGAL::box_intersection_d<Parallel_tag>( face_boxes_ptr.begin(), face_boxes_ptr.end(),
+                                            edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
+                                            parallel_callback, cutoff );
+
+    // the pairs are reported in an arbitrary order: they are sorted such that the iteration order
+    // of `edge_to_faces`, and thus the numbering of the nodes, does not depend on the scheduling
+    tbb::parallel_sort(edge_face_pairs.begin(), edge_face_pairs.end());
+    for(const auto& ef : edge_face_pairs)
+      edge_to_faces[ef.first].insert(ef.second);
+    #ifndef DO_NOT_HANDLE_COPLANAR_FACES
+    coplanar_faces.insert(face_pairs.begin(), face_pairs.end());
+    #endif
+  }
+
+  // computes the intersection types of all the candidate edge-face pairs, and the intersection
+  // points of the edges crossing the interior of a face.
+  // `inter_types[i]` corresponds to the i-th entry of `tm1_edge_to_tm2_faces`
+  template <typename VPM1, typename VPM2>
+  void compute_intersection_types(const Edge_to_faces& tm1_edge_to_tm2_faces,
+                                  const TriangleMesh& tm1,
+                                  const TriangleMesh& tm2,
+                                  const VPM1& vpm1,
+                                  const VPM2& vpm2,
+                                  std::vector<Edge_inter_types>& inter_types) const
+  {
+    std::vector<typename Edge_to_faces::const_iterator> entries;
+    entries.reserve(tm1_edge_to_tm2_faces.size());
+    for(typename Edge_to_faces::const_iterator it=tm1_edge_to_tm2_faces.begin();
+                                               it!=tm1_edge_to_tm2_faces.end();++it)
+      entries.push_back(it);
+
+    inter_types.resize(entries.size());
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, entries.size()),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      for(std::size_t i=r.begin(); i!=r.end(); ++i)
+      {
+        halfedge_descriptor h_1=halfedge(entries[i]->first,tm1);
+        inter_types[i].reserve(entries[i]->second.size());
+        for(face_descriptor f_2 : entries[i]->second)
+        {
+          Inter_type res=intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2);
+          std::optional<typename Node_vector::Node_point> node;
+          if(std::get<0>(res)==ON_FACE && !std::get<2>(res) && !std::get<3>(res))
+            node=nodes.construct_node(h_1,f_2,tm1,tm2,vpm1,vpm2);
+          inter_types[i].emplace_back(f_2, res, node);
+        }
+      }
+    });
+  }
+#endif
+
   // for autorefinement
   template <class VPM>
   void filter_intersections(const TriangleMesh& tm,
@@ -931,22 +1062,46 @@ class Intersection_of_triangle_meshes
                                    const Non_manifold_feature_map<TriangleMesh>& nm_features_map_2,
                                    Node_id& current_node)
   {
-    typedef std::tuple<Intersection_type, halfedge_descriptor, bool,bool>  Inter_type;
-
     visitor.start_handling_edge_face_intersections(tm1_edge_to_tm2_faces.size());
 
+    // In parallel mode, the intersection types and the points of the nodes inside faces are all
+    // computed beforehand. Nodes are still numbered sequentially, in the same order as in
+    // sequential mode, since handling a pair may discard pairs of other edges.
+    std::vector<Edge_inter_types> inter_types;
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+      compute_intersection_types(tm1_edge_to_tm2_faces, tm1, tm2, vpm1, vpm2, inter_types);
+#endif
+
+    std::size_t entry_id=0;
     for(typename Edge_to_faces::iterator it=tm1_edge_to_tm2_faces.begin();
-                                         it!=tm1_edge_to_tm2_faces.end();++it)
+                                         it!=tm1_edge_to_tm2_faces.end();++it, ++entry_id)
     {
       visitor.edge_face_intersections_step();
       edge_descriptor e_1=it->first;
 
       halfedge_descriptor h_1=halfedge(e_1,tm1);
       Face_set& fset=it->second;
+      // faces are only erased from `fset`, so the remaining ones keep their relative order
+      std::size_t cached_id=0;
       while (!fset.empty()){
         face_descriptor f_2=*fset.begin();
 
-        Inter_type res=intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2);
+        Inter_type res;
+        const std::optional<typename Node_vector::Node_point>* cached_node=nullptr;
+        if (inter_types.empty())
+          res=intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2);
+        else
+        {
+          const Edge_inter_types& edge_inter_types=inter_types[entry_id];
+          while (std::get<0>(edge_inter_types[cached_id])!=f_2)
+          {
+            ++cached_id;
+            CGAL_assertion(cached_id<edge_inter_types.size());
+          }
+          res=std::get<1>(edge_inter_types[cached_id]);
+          cached_node=&std::get<2>(edge_inter_types[cached_id]);
+        }
         Intersection_type type=std::get<0>(res);
 
     //handle degenerate case: one extremity of edge belong to f_2
@@ -1065,7 +1220,10 @@ class Intersection_of_triangle_meshes
             CGAL_assertion(f_2==face(std::get<1>(res),tm2));
 
             Node_id node_id=++current_node;
-            add_new_node(h_1,f_2,tm1,tm2,vpm1,vpm2,res);
+            if (cached_node!=nullptr && *cached_node)
+              nodes.add_new_node(**cached_node);
+            else
+              add_new_node(h_1,f_2,tm1,tm2,vpm1,vpm2,res);
             visitor.new_node_added(node_id,ON_FACE,h_1,halfedge(f_2,tm2),tm1,tm2,std::get<3>(res),std::get<2>(res));
             for (;it_edge!=all_edges.end();++it_edge){
               add_intersection_point_to_face_and_all_edge_incident_faces(f_2,*it_edge,tm2,tm1,node_id);
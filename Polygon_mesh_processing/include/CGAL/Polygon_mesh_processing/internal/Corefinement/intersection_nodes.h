@@ -101,6 +101,29 @@ public:
     nodes.push_back(  exact_to_double(p) );
   }
 
+  //the type of the nodes given by `construct_node()`
+  typedef Point_3 Node_point;
+
+  //computes the intersection of the triangle with the segment,
+  //without adding it. Can be called concurrently.
+  template <class VPM_A, class VPM_B> // VertexPointMap1 or VertexPointMap2
+  Node_point construct_node(halfedge_descriptor h_a,
+                            face_descriptor f_b,
+                            const TriangleMesh& tm_a,
+                            const TriangleMesh& tm_b,
+                            const VPM_A& vpm_a,
+                            const VPM_B& vpm_b) const
+  {
+    halfedge_descriptor h_b = halfedge(f_b, tm_b);
+    return exact_to_double(
+      typename Exact_kernel::Construct_plane_line_intersection_point_3()(
+        to_exact( get(vpm_b, source(h_b,tm_b)) ),
+        to_exact( get(vpm_b, target(h_b,tm_b)) ),
+        to_exact( get(vpm_b, target(next(h_b,tm_b),tm_b)) ),
+        to_exact( get(vpm_a, source(h_a,tm_a)) ),
+        to_exact( get(vpm_a, target(h_a,tm_a)) ) ) );
+  }
+
   //add a new node in the final graph.
   //it is the intersection of the triangle with the segment
   template <class VPM_A, class VPM_B> // VertexPointMap1 or VertexPointMap2
@@ -111,14 +134,7 @@ public:
                     const VPM_A& vpm_a,
                     const VPM_B& vpm_b)
   {
-    halfedge_descriptor h_b = halfedge(f_b, tm_b);
-    add_new_node(
-      typename Exact_kernel::Construct_plane_line_intersection_point_3()(
-        to_exact( get(vpm_b, source(h_b,tm_b)) ),
-        to_exact( get(vpm_b, target(h_b,tm_b)) ),
-        to_exact( get(vpm_b, target(next(h_b,tm_b),tm_b)) ),
-        to_exact( get(vpm_a, source(h_a,tm_a)) ),
-        to_exact( get(vpm_a, target(h_a,tm_a)) ) ) );
+    add_new_node(construct_node(h_a, f_b, tm_a, tm_b, vpm_a, vpm_b));
   }
 
   template <class VPM> // VertexPointMap1 or VertexPointMap2
@@ -210,7 +226,8 @@ public:
 
   size_t size() const {return enodes.size();}
 
-  void add_new_node(const Exact_kernel::Point_3& p)
+  //the approximation of a node must be precise enough to be rounded
+  static void refine(const Exact_kernel::Point_3& p)
   {
     const Exact_kernel::Approximate_kernel::Point_3& p_approx=p.approx();
     const double precision =
@@ -221,9 +238,39 @@ public:
     {
       p.exact();
     }
+  }
+
+  void add_new_node(const Exact_kernel::Point_3& p)
+  {
+    refine(p);
     enodes.push_back(p);
   }
 
+  //the type of the nodes given by `construct_node()`
+  typedef Exact_kernel::Point_3 Node_point;
+
+  //computes the intersection of the triangle with the segment,
+  //without adding it. Can be called concurrently.
+  template <class VPM_A, class VPM_B> // VertexPointMap1 or VertexPointMap2
+  Node_point construct_node(halfedge_descriptor h_a,
+                            face_descriptor f_b,
+                            const TriangleMesh& tm_a,
+                            const TriangleMesh& tm_b,
+                            const VPM_A& vpm_a,
+                            const VPM_B& vpm_b) const
+  {
+    halfedge_descriptor h_b = halfedge(f_b, tm_b);
+    Node_point p =
+      Exact_kernel::Construct_plane_line_intersection_point_3()(
+        to_exact( get(vpm_b, source(h_b,tm_b)) ),
+        to_exact( get(vpm_b, target(h_b,tm_b)) ),
+        to_exact( get(vpm_b, target(next(h_b,tm_b),tm_b)) ),
+        to_exact( get(vpm_a, source(h_a,tm_a)) ),
+        to_exact( get(vpm_a, target(h_a,tm_a)) ) );
+    refine(p);
+    return p;
+  }
+
   //add a new node in the final graph.
   //it is the intersection of the triangle with the segment
   template <class VPM_A, class VPM_B> // VertexPointMap1 or VertexPointMap2
@@ -234,14 +281,7 @@ public:
                     const VPM_A vpm_a,
                     const VPM_B vpm_b)
   {
-    halfedge_descriptor h_b = halfedge(f_b, tm_b);
-    add_new_node(
-      Exact_kernel::Construct_plane_line_intersection_point_3()(
-        to_exact( get(vpm_b, source(h_b,tm_b)) ),
-        to_exact( get(vpm_b, target(h_b,tm_b)) ),
-        to_exact( get(vpm_b, target(next(h_b,tm_b),tm_b)) ),
-        to_exact( get(vpm_a, source(h_a,tm_a)) ),
-        to_exact( get(vpm_a, target(h_a,tm_a)) ) ) );
+    enodes.push_back(construct_node(h_a, f_b, tm_a, tm_b, vpm_a, vpm_b));
   }
 
   // use to resolve intersection of 3 faces in autorefinement only
@@ -393,6 +433,30 @@ public:
     add_new_node(*pt);
   }
 
+  //the type of the nodes given by `construct_node()`
+  typedef Point_3 Node_point;
+
+  //computes the intersection of the triangle with the segment,
+  //without adding it. Can be called concurrently.
+  template <class VPM_A, class VPM_B> // VertexPointMap1 or VertexPointMap2
+  Node_point construct_node(halfedge_descriptor h_a,
+                            face_descriptor f_b,
+                            const TriangleMesh& tm_a,
+                            const TriangleMesh& tm_b,
+                            const VPM_A& vpm_a,
+                            const VPM_B& vpm_b) const
+  {
+    halfedge_descriptor h_b=halfedge(f_b,tm_b);
+
+    return
+      typename Exact_kernel::Construct_plane_line_intersection_point_3()(
+        get(vpm_b, source(h_b,tm_b)),
+        get(vpm_b, target(h_b,tm_b)),
+        get(vpm_b, target(next(h_b,tm_b),tm_b)),
+        get(vpm_a, source(h_a,tm_a)),
+        get(vpm_a, target(h_a,tm_a)) );
+  }
+
   //add a new node in the final graph.
   //it is the intersection of the triangle with the segment
   template <class VPM_A, class VPM_B> // VertexPointMap1 or VertexPointMap2
@@ -403,15 +467,7 @@ public:
                     const VPM_A& vpm_a,
                     const VPM_B& vpm_b)
   {
-    halfedge_descriptor h_b=halfedge(f_b,tm_b);
-
-    add_new_node(
-      typename Exact_kernel::Construct_plane_line_intersection_point_3()(
-        get(vpm_b, source(h_b,tm_b)),
-        get(vpm_b, target(h_b,tm_b)),
-        get(vpm_b, target(next(h_b,tm_b),tm_b)),
-        get(vpm_a, source(h_a,tm_a)),
-        get(vpm_a, target(h_a,tm_a)) ) );
+    add_new_node(construct_node(h_a, f_b, tm_a, tm_b, vpm_a, vpm_b));
   }
 
   void add_new_node(const Point_3& p)
@@ -30,6 +30,7 @@
 
 #include <CGAL/property_map.h>
 #include <CGAL/Dynamic_property_map.h>
+#include <CGAL/for_each.h>
 #include <CGAL/iterator.h>
 #include <CGAL/boost/graph/Euler_operations.h>
 #include <CGAL/boost/graph/properties.h>
@@ -51,6 +52,7 @@
 #include <vector>
 #include <iterator>
 #include <fstream>
+#include <numeric>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -261,6 +263,7 @@ namespace internal {
          , typename VertexIsConstrainedMap
          , typename FacePatchMap
          , typename FaceIndexMap
+         , typename ConcurrencyTag = Sequential_tag
   >
   class Incremental_remesher
   {
@@ -281,6 +284,7 @@ namespace internal {
                                , VertexIsConstrainedMap
                                , FacePatchMap
                                , FaceIndexMap
+                               , ConcurrencyTag
                                > Self;
 
   private:
@@ -493,14 +497,17 @@ namespace internal {
         { return p1.second > p2.second; }
       );
 
-      for(edge_descriptor e : edges(mesh_))
-      {
-        if (!is_split_allowed(e))
-          continue;
-        double sqlen = sqlength(e);
-        if(sqlen > sq_high)
-          long_edges.emplace(halfedge(e, mesh_), sqlen);
-      }
+      collect_edges([&](const edge_descriptor e, double& sqlen)
+                    {
+                      if (!is_split_allowed(e))
+                        return false;
+                      sqlen = sqlength(e);
+                      return sqlen > sq_high;
+                    },
+                    [&](const halfedge_descriptor h, const double sqlen)
+                    {
+                      long_edges.emplace(h, sqlen);
+                    });
 
       //split long edges
 #ifdef CGAL_PMP_REMESHING_VERBOSE
@@ -641,12 +648,15 @@ namespace internal {
       double sq_high = high*high;
 
       Boost_bimap short_edges;
-      for(edge_descriptor e : edges(mesh_))
-      {
-        double sqlen = sqlength(e);
-        if ((sqlen < sq_low) && is_collapse_allowed(e, collapse_constraints))
-          short_edges.insert(short_edge(halfedge(e, mesh_), sqlen));
-      }
+      collect_edges([&](const edge_descriptor e, double& sqlen)
+                    {
+                      sqlen = sqlength(e);
+                      return (sqlen < sq_low) && is_collapse_allowed(e, collapse_constraints);
+                    },
+                    [&](const halfedge_descriptor h, const double sqlen)
+                    {
+                      short_edges.insert(short_edge(h, sqlen));
+                    });
 #ifdef CGAL_PMP_REMESHING_VERBOSE_PROGRESS
       std::cout << "done." << std::endl;
 #endif
@@ -1047,6 +1057,7 @@ namespace internal {
                          .edge_is_constrained_map(constrained_edges_pmap)
                          .vertex_is_constrained_map(constrained_vertices_pmap)
                          .relax_constraints(relax_constraints)
+                         .concurrency_tag(ConcurrencyTag())
       );
 
       CGAL_assertion(!input_mesh_is_valid_ || is_valid_polygon_mesh(mesh_));
@@ -1072,15 +1083,16 @@ namespace internal {
       std::cout.flush();
 #endif
 
-      for(vertex_descriptor v : vertices(mesh_))
+      for_each_vertex_to_project([&](const vertex_descriptor v)
       {
-        if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
-          continue;
         //note if v is constrained, it has not moved
+        const Patch_id pid = get_patch_id(face(halfedge(v, mesh_), mesh_));
+        typename Patch_id_to_index_map::const_iterator it = patch_id_to_index_map.find(pid);
+        const std::size_t tree_id = (it == patch_id_to_index_map.end()) ? 0 : it->second;
 
-        Point proj = trees[patch_id_to_index_map[get_patch_id(face(halfedge(v, mesh_), mesh_))]]->closest_point(get(vpmap_, v));
+        Point proj = trees[tree_id]->closest_point(get(vpmap_, v));
         put(vpmap_, v, proj);
-      }
+      });
       CGAL_assertion(!input_mesh_is_valid_ || is_valid_polygon_mesh(mesh_));
 #ifdef CGAL_PMP_REMESHING_DEBUG
       debug_self_intersections();
@@ -1102,13 +1114,11 @@ namespace internal {
       std::cout << "Project to surface...";
       std::cout.flush();
 #endif
-      for(vertex_descriptor v : vertices(mesh_))
+      for_each_vertex_to_project([&](const vertex_descriptor v)
       {
-        if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
-          continue;
         //note if v is constrained, it has not moved
         put(vpmap_, v,  proj(v));
-      }
+      });
       CGAL_assertion(is_valid(mesh_));
 #ifdef CGAL_PMP_REMESHING_DEBUG
       debug_self_intersections();
@@ -1123,6 +1133,59 @@ namespace internal {
     }
 
 private:
+  // calls `store(halfedge(e), sqlen)` for the edges `e` such that `is_candidate(e, sqlen)`,
+  // in the order of `edges(mesh_)`. The predicate is evaluated concurrently in parallel mode.
+  template <typename IsCandidate, typename Store>
+  void collect_edges(const IsCandidate& is_candidate, const Store& store) const
+  {
+    if (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      for(edge_descriptor e : edges(mesh_))
+      {
+        double sqlen = 0;
+        if (is_candidate(e, sqlen))
+          store(halfedge(e, mesh_), sqlen);
+      }
+      return;
+    }
+
+    const std::vector<edge_descriptor> es(std::begin(edges(mesh_)), std::end(edges(mesh_)));
+    std::vector<double> sqlens(es.size(), -1.);
+    std::vector<std::size_t> ids(es.size());
+    std::iota(ids.begin(), ids.end(), std::size_t(0));
+    CGAL::for_each<ConcurrencyTag>(ids, [&](const std::size_t i)
+    {
+      double sqlen = 0;
+      if (is_candidate(es[i], sqlen))
+        sqlens[i] = sqlen;
+      return true;
+    });
+
+    for(std::size_t i=0; i<es.size(); ++i)
+      if (sqlens[i] >= 0)
+        store(halfedge(es[i], mesh_), sqlens[i]);
+  }
+
+  // calls `f` on the vertices that have to be projected back to the input surface,
+  // concurrently in parallel mode. `f` must only modify the position of its vertex.
+  template <typename Functor>
+  void for_each_vertex_to_project(const Functor& f) const
+  {
+    std::vector<vertex_descriptor> to_project;
+    for(vertex_descriptor v : vertices(mesh_))
+    {
+      if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
+        continue;
+      to_project.push_back(v);
+    }
+
+    CGAL::for_each<ConcurrencyTag>(to_project, [&](const vertex_descriptor v)
+    {
+      f(v);
+      return true;
+    });
+  }
+
   Patch_id get_patch_id(const face_descriptor& f) const
   {
     if (f == boost::graph_traits<PM>::null_face())
@@ -18,13 +18,20 @@
 
 #include <CGAL/Polygon_mesh_processing/compute_normal.h>
 #include <CGAL/property_map.h>
+#include <CGAL/Dynamic_property_map.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
 
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 
+#include <algorithm>
+#include <numeric>
+#include <optional>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace CGAL {
 namespace Polygon_mesh_processing {
@@ -115,6 +122,18 @@ struct Allow_all_moves{
 *     \cgalParamDefault{If not provided, all moves are allowed.}
 *   \cgalParamNEnd
 *
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag enabling sequential versus parallel relaxation}
+*     \cgalParamType{`CGAL::Sequential_tag`, `CGAL::Parallel_if_available_tag`, or `CGAL::Parallel_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{With `CGAL::Parallel_tag`, the new locations are computed in parallel, and the vertices
+*                     are moved in parallel by groups of non-adjacent vertices (obtained by a greedy coloring
+*                     of the vertices), so the result may slightly differ from the sequential version.
+*                     `allow_move_functor` must then be safe to call concurrently, and the vertex point map
+*                     must support concurrent calls to `get()` and `put()` on distinct vertices.
+*                     The constraint maps are read sequentially before the relaxation.}
+*   \cgalParamNEnd
+*
 * \cgalNamedParamsEnd
 *
 * \todo check if it should really be a triangle mesh or if a polygon mesh is fine
@@ -161,13 +180,16 @@ void tangential_relaxation(const VertexRange& vertices,
   typedef typename GT::Vector_3 Vector_3;
   typedef typename GT::Point_3 Point_3;
 
-  auto check_normals = [&](vertex_descriptor v)
+  // `is_constrained_edge(j, h)` returns whether the edge of `h`, the `j`-th halfedge around `v`, is constrained
+  auto check_normals = [&](vertex_descriptor v, auto&& is_constrained_edge)
   {
     bool first_run = true;
     Vector_3 prev = NULL_VECTOR, first = NULL_VECTOR;
     halfedge_descriptor first_h = boost::graph_traits<TriangleMesh>::null_halfedge();
+    std::size_t first_j = 0, j = 0;
     for (halfedge_descriptor hd : CGAL::halfedges_around_target(v, tm))
     {
+      const std::size_t hj = j++;
       if (is_border(hd, tm)) continue;
 
       Vector_3 n = compute_face_normal(face(hd, tm), tm, np);
@@ -179,10 +201,11 @@ void tangential_relaxation(const VertexRange& vertices,
         first_run = false;
         first = n;
         first_h = hd;
+        first_j = hj;
       }
       else
       {
-        if (!get(ecm, edge(hd, tm)))
+        if (!is_constrained_edge(hj, hd))
           if (to_double(n * prev) <= 0)
             return false;
       }
@@ -192,7 +215,7 @@ void tangential_relaxation(const VertexRange& vertices,
     if (first_run)
       return true; //vertex incident only to degenerate faces
 
-    if (!get(ecm, edge(first_h, tm)))
+    if (!is_constrained_edge(first_j, first_h))
       if (to_double(first * prev) <= 0)
         return false;
 
@@ -207,119 +230,216 @@ void tangential_relaxation(const VertexRange& vertices,
   Shall_move shall_move = choose_parameter(get_parameter(np, internal_np::allow_move_functor),
                                            internal::Allow_all_moves());
 
-  for (unsigned int nit = 0; nit < nb_iterations; ++nit)
-  {
-#ifdef CGAL_PMP_TANGENTIAL_RELAXATION_VERBOSE
-    std::cout << "\r\t(Tangential relaxation iteration " << (nit + 1) << " / ";
-    std::cout << nb_iterations << ") ";
-    std::cout.flush();
+  typedef typename internal_np::Lookup_named_param_def <
+      internal_np::concurrency_tag_t,
+      NamedParameters,
+      Sequential_tag
+    > ::type Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
 #endif
 
-    typedef std::tuple<vertex_descriptor, Vector_3, Point_3> VNP;
-    std::vector< VNP > barycenters;
-    auto gt_barycenter = gt.construct_barycenter_3_object();
-    auto gt_project = gt.construct_projected_point_3_object();
+  const bool parallel = std::is_convertible<Concurrency_tag, Parallel_tag>::value;
+
+  auto gt_barycenter = gt.construct_barycenter_3_object();
+  auto gt_project = gt.construct_projected_point_3_object();
 
-    // at each vertex, compute vertex normal
-    std::unordered_map<vertex_descriptor, Vector_3> vnormals;
-    compute_vertex_normals(tm, boost::make_assoc_property_map(vnormals), np);
+  // computes the barycenter of the neighbors of `v`, projected onto the tangent plane at `v`
+  auto new_location = [&](vertex_descriptor v, bool is_constrained_vertex,
+                          auto&& is_constrained_edge, auto&& vertex_normal) -> std::optional<Point_3>
+  {
+    if (is_constrained_vertex || CGAL::internal::is_isolated(v, tm))
+      return std::nullopt;
 
-    // at each vertex, compute barycenter of neighbors
-    for(vertex_descriptor v : vertices)
+    // collect hedges to detect if we have to handle boundary cases
+    std::vector<halfedge_descriptor> interior_hedges, border_halfedges;
+    std::size_t j = 0;
+    for(halfedge_descriptor h : halfedges_around_target(v, tm))
     {
-      if (get(vcm, v) || CGAL::internal::is_isolated(v, tm))
-        continue;
+      const std::size_t hj = j++;
+      if (is_border_edge(h, tm) || is_constrained_edge(hj, h))
+        border_halfedges.push_back(h);
+      else
+        interior_hedges.push_back(h);
+    }
 
-      // collect hedges to detect if we have to handle boundary cases
-      std::vector<halfedge_descriptor> interior_hedges, border_halfedges;
-      for(halfedge_descriptor h : halfedges_around_target(v, tm))
+    if (border_halfedges.empty())
+    {
+      const Vector_3 vn = vertex_normal(v);
+      Vector_3 move = CGAL::NULL_VECTOR;
+      unsigned int star_size = 0;
+      for(halfedge_descriptor h :interior_hedges)
       {
-        if (is_border_edge(h, tm) || get(ecm, edge(h, tm)))
-          border_halfedges.push_back(h);
-        else
-          interior_hedges.push_back(h);
+        move = move + Vector_3(get(vpm, v), get(vpm, source(h, tm)));
+        ++star_size;
       }
+      CGAL_assertion(star_size > 0); //isolated vertices have already been discarded
+      move = (1. / static_cast<double>(star_size)) * move;
+
+      const Point_3 qv = get(vpm, v) + move; //barycenter at v
+      return qv + (vn * Vector_3(qv, get(vpm, v))) * vn;
+    }
 
-      if (border_halfedges.empty())
+    if (!relax_constraints) return std::nullopt;
+
+    if (border_halfedges.size() == 2)// corners are constrained
+    {
+      vertex_descriptor ph0 = source(border_halfedges[0], tm);
+      vertex_descriptor ph1 = source(border_halfedges[1], tm);
+      double dot = to_double(Vector_3(get(vpm, v), get(vpm, ph0))
+                             * Vector_3(get(vpm, v), get(vpm, ph1)));
+      // \todo shouldn't it be an input parameter?
+      //check squared cosine is < 0.25 (~120 degrees)
+      if (0.25 < dot*dot / ( squared_distance(get(vpm,ph0), get(vpm, v)) *
+                             squared_distance(get(vpm,ph1), get(vpm, v))) )
       {
-        const Vector_3& vn = vnormals.at(v);
-        Vector_3 move = CGAL::NULL_VECTOR;
-        unsigned int star_size = 0;
-        for(halfedge_descriptor h :interior_hedges)
-        {
-          move = move + Vector_3(get(vpm, v), get(vpm, source(h, tm)));
-          ++star_size;
-        }
-        CGAL_assertion(star_size > 0); //isolated vertices have already been discarded
-        move = (1. / static_cast<double>(star_size)) * move;
+        typename GT::Point_3 bary = gt_barycenter(get(vpm, ph0), 0.25, get(vpm, ph1), 0.25, get(vpm, v), 0.5);
+        // to avoid shrinking of borders, we project back onto the incident segments
+        typename GT::Segment_3 s1(get(vpm, ph0), get(vpm,v)),
+                               s2(get(vpm, ph1), get(vpm,v));
+
+        typename GT::Point_3 p1 = gt_project(s1, bary), p2 = gt_project(s2, bary);
 
-        barycenters.emplace_back(v, vn, get(vpm, v) + move);
+        return squared_distance(p1, bary)<squared_distance(p2,bary)? p1:p2;
       }
-      else
-      {
-        if (!relax_constraints) continue;
-        Vector_3 vn(NULL_VECTOR);
+    }
+    return std::nullopt;
+  };
 
-        if (border_halfedges.size() == 2)// corners are constrained
-        {
-          vertex_descriptor ph0 = source(border_halfedges[0], tm);
-          vertex_descriptor ph1 = source(border_halfedges[1], tm);
-          double dot = to_double(Vector_3(get(vpm, v), get(vpm, ph0))
-                                 * Vector_3(get(vpm, v), get(vpm, ph1)));
-          // \todo shouldn't it be an input parameter?
-          //check squared cosine is < 0.25 (~120 degrees)
-          if (0.25 < dot*dot / ( squared_distance(get(vpm,ph0), get(vpm, v)) *
-                                 squared_distance(get(vpm,ph1), get(vpm, v))) )
-          {
-            typename GT::Point_3 bary = gt_barycenter(get(vpm, ph0), 0.25, get(vpm, ph1), 0.25, get(vpm, v), 0.5);
-            // to avoid shrinking of borders, we project back onto the incident segments
-            typename GT::Segment_3 s1(get(vpm, ph0), get(vpm,v)),
-                                   s2(get(vpm, ph1), get(vpm,v));
-
-            typename GT::Point_3 p1 = gt_project(s1, bary), p2 = gt_project(s2, bary);
-
-            bary = squared_distance(p1, bary)<squared_distance(p2,bary)? p1:p2;
-            barycenters.emplace_back(v, vn, bary);
-          }
-
-
-        }
+  // moves `v` to `p`, shortening the move if a face gets inverted
+  auto perform_move = [&](vertex_descriptor v, const Point_3& p, auto&& is_constrained_edge)
+  {
+    const Point_3 initial_pos = get(vpm, v); // make a copy on purpose
+    const Vector_3 move(initial_pos, p);
+
+    put(vpm, v, p);
+
+    //check that no inversion happened
+    double frac = 1.;
+    while (frac > 0.03 //5 attempts maximum
+        && (   !check_normals(v, is_constrained_edge)
+            || !shall_move(v, initial_pos, get(vpm, v)))) //if a face has been inverted
+    {
+      frac = 0.5 * frac;
+      put(vpm, v, initial_pos + frac * move);//shorten the move by 2
+    }
+    if (frac <= 0.02)
+      put(vpm, v, initial_pos);//cancel move
+  };
+
+  auto get_edge_constraint = [&](std::size_t, halfedge_descriptor h) -> bool { return get(ecm, edge(h, tm)); };
+
+  // In parallel, the vertices are moved by groups of independent vertices:
+  // two vertices of the same color are not adjacent, so the normal checks
+  // of a vertex only involve vertices that do not move at the same time.
+  // The constraints are copied beforehand, since reading a property map
+  // (e.g. a dynamic one) is not necessarily safe to do concurrently: the flag of the
+  // `j`-th halfedge around `vrange[i]` is `edge_constrained[edge_constrained_begin[i] + j]`.
+  std::vector<vertex_descriptor> vrange;
+  std::vector<char> vertex_constrained, edge_constrained;
+  std::vector<std::size_t> edge_constrained_begin;
+  typedef CGAL::dynamic_vertex_property_t<int> Vertex_color_tag;
+  typedef typename boost::property_map<TriangleMesh, Vertex_color_tag>::type Vertex_color_map;
+  Vertex_color_map vcolor;
+  int nb_colors = 0;
+  if (parallel)
+  {
+    vrange.assign(std::begin(vertices), std::end(vertices));
+
+    vertex_constrained.reserve(vrange.size());
+    edge_constrained_begin.reserve(vrange.size() + 1);
+    for(vertex_descriptor v : vrange)
+    {
+      vertex_constrained.push_back(get(vcm, v));
+      edge_constrained_begin.push_back(edge_constrained.size());
+      for(halfedge_descriptor h : halfedges_around_target(v, tm))
+        edge_constrained.push_back(get(ecm, edge(h, tm)));
+    }
+    edge_constrained_begin.push_back(edge_constrained.size());
+
+    vcolor = get(Vertex_color_tag(), tm);
+    for(vertex_descriptor v : vrange)
+      put(vcolor, v, -1);
+
+    std::vector<bool> used;
+    for(vertex_descriptor v : vrange)
+    {
+      used.assign(nb_colors, false);
+      for(halfedge_descriptor h : halfedges_around_target(v, tm))
+      {
+        const int c = get(vcolor, source(h, tm));
+        if (c >= 0)
+          used[c] = true;
       }
+      const int c = int(std::find(used.begin(), used.end(), false) - used.begin());
+      put(vcolor, v, c);
+      nb_colors = (std::max)(nb_colors, c + 1);
     }
+  }
+
+  for (unsigned int nit = 0; nit < nb_iterations; ++nit)
+  {
+#ifdef CGAL_PMP_TANGENTIAL_RELAXATION_VERBOSE
+    std::cout << "\r\t(Tangential relaxation iteration " << (nit + 1) << " / ";
+    std::cout << nb_iterations << ") ";
+    std::cout.flush();
+#endif
 
-    // compute moves
     typedef std::pair<vertex_descriptor, Point_3> VP_pair;
     std::vector< std::pair<vertex_descriptor, Point_3> > new_locations;
-    new_locations.reserve(barycenters.size());
-    for(const VNP& vnp : barycenters)
+
+    if (!parallel)
     {
-      vertex_descriptor v = std::get<0>(vnp);
-      const Point_3& pv = get(vpm, v);
-      const Vector_3& nv = std::get<1>(vnp);
-      const Point_3& qv = std::get<2>(vnp); //barycenter at v
+      // at each vertex, compute vertex normal
+      std::unordered_map<vertex_descriptor, Vector_3> vnormals;
+      compute_vertex_normals(tm, boost::make_assoc_property_map(vnormals), np);
 
-      new_locations.emplace_back(v, qv + (nv * Vector_3(qv, pv)) * nv);
-    }
+      // at each vertex, compute barycenter of neighbors, and the new location
+      for(vertex_descriptor v : vertices)
+      {
+        std::optional<Point_3> p = new_location(v, get(vcm, v), get_edge_constraint,
+                                                [&](vertex_descriptor w) { return vnormals.at(w); });
+        if (p)
+          new_locations.emplace_back(v, *p);
+      }
 
-    // perform moves
-    for(const VP_pair& vp : new_locations)
+      // perform moves
+      for(const VP_pair& vp : new_locations)
+        perform_move(vp.first, vp.second, get_edge_constraint);
+    }
+    else
     {
-      const Point_3 initial_pos = get(vpm, vp.first); // make a copy on purpose
-      const Vector_3 move(initial_pos, vp.second);
+      std::vector<std::optional<Point_3> > locations(vrange.size());
+      std::vector<std::size_t> ids(vrange.size());
+      std::iota(ids.begin(), ids.end(), std::size_t(0));
+      auto copied_edge_constraint = [&](std::size_t i)
+      {
+        return [&, i](std::size_t j, halfedge_descriptor) -> bool
+               { return edge_constrained[edge_constrained_begin[i] + j] != 0; };
+      };
+
+      CGAL::for_each<Concurrency_tag>(ids, [&](const std::size_t i)
+      {
+        locations[i] = new_location(vrange[i], vertex_constrained[i] != 0, copied_edge_constraint(i),
+                                    [&](vertex_descriptor w) { return compute_vertex_normal(w, tm, np); });
+        return true;
+      });
 
-      put(vpm, vp.first, vp.second);
+      std::vector<std::vector<std::size_t> > moves_per_color(nb_colors);
+      for(std::size_t i=0; i<vrange.size(); ++i)
+        if (locations[i])
+          moves_per_color[get(vcolor, vrange[i])].push_back(i);
 
-      //check that no inversion happened
-      double frac = 1.;
-      while (frac > 0.03 //5 attempts maximum
-          && (   !check_normals(vp.first)
-              || !shall_move(vp.first, initial_pos, get(vpm, vp.first)))) //if a face has been inverted
+      for(const std::vector<std::size_t>& moves : moves_per_color)
       {
-        frac = 0.5 * frac;
-        put(vpm, vp.first, initial_pos + frac * move);//shorten the move by 2
+        CGAL::for_each<Concurrency_tag>(moves, [&](const std::size_t i)
+        {
+          perform_move(vrange[i], *locations[i], copied_edge_constraint(i));
+          return true;
+        });
       }
-      if (frac <= 0.02)
-        put(vpm, vp.first, initial_pos);//cancel move
     }
   }//end for loop (nit == nb_iterations)
 
@@ -0,0 +1,190 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/measure.h>
+#include <CGAL/Polygon_mesh_processing/transform.h>
+#include <CGAL/Aff_transformation_3.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/boost/graph/IO/polygon_mesh_io.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+template <typename Mesh>
+void read_mesh(const std::string& filename, Mesh& mesh)
+{
+  if(!CGAL::IO::read_polygon_mesh(filename, mesh) || !CGAL::is_triangle_mesh(mesh))
+  {
+    std::cerr << "Error: cannot read " << filename << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+}
+
+// returns the points of the faces of `mesh`, each face starting at its smallest point
+template <typename Mesh>
+std::vector<std::array<typename Mesh::Point, 3> > sorted_faces(const Mesh& mesh)
+{
+  std::vector<std::array<typename Mesh::Point, 3> > faces;
+  for(auto f : CGAL::faces(mesh))
+  {
+    std::array<typename Mesh::Point, 3> face;
+    std::size_t i = 0;
+    for(auto v : vertices_around_face(halfedge(f, mesh), mesh))
+      face[i++] = mesh.point(v);
+    std::rotate(face.begin(), std::min_element(face.begin(), face.end()), face.end());
+    faces.push_back(face);
+  }
+  std::sort(faces.begin(), faces.end());
+  return faces;
+}
+
+template <typename Mesh>
+void check_same(const Mesh& mesh, const Mesh& seq_mesh)
+{
+  std::cout << num_vertices(mesh) << " vertices, " << num_faces(mesh) << " faces ("
+            << num_vertices(seq_mesh) << ", " << num_faces(seq_mesh) << " sequentially)" << std::endl;
+
+  assert(CGAL::is_valid_polygon_mesh(mesh));
+  // the parallel version only differs in the order of the vertices and of the faces
+  assert(num_vertices(mesh) == num_vertices(seq_mesh));
+  assert(num_faces(mesh) == num_faces(seq_mesh));
+
+  std::vector<typename Mesh::Point> points(mesh.points().begin(), mesh.points().end());
+  std::vector<typename Mesh::Point> seq_points(seq_mesh.points().begin(), seq_mesh.points().end());
+  std::sort(points.begin(), points.end());
+  std::sort(seq_points.begin(), seq_points.end());
+  assert(points == seq_points);
+
+  assert(sorted_faces(mesh) == sorted_faces(seq_mesh));
+}
+
+// the intersection points are numbered and the faces are retriangulated in a deterministic order
+template <typename Mesh>
+void check_identical(const Mesh& mesh, const Mesh& other_mesh)
+{
+  assert(num_vertices(mesh) == num_vertices(other_mesh));
+  assert(num_faces(mesh) == num_faces(other_mesh));
+
+  auto v = vertices(mesh).begin();
+  for(auto other_v : vertices(other_mesh))
+  {
+    assert(mesh.point(*v) == other_mesh.point(other_v));
+    ++v;
+  }
+}
+
+template <typename K>
+void test_boolean_operations(const std::string& fname1, const std::string& fname2)
+{
+  typedef CGAL::Surface_mesh<typename K::Point_3> Mesh;
+
+  std::cout << "== boolean operations " << fname1 << " " << fname2 << std::endl;
+
+  Mesh tm1, tm2;
+  read_mesh(fname1, tm1);
+  read_mesh(fname2, tm2);
+
+  Mesh seq_tm1 = tm1, seq_tm2 = tm2;
+  Mesh out_union, out_inter, seq_out_union, seq_out_inter;
+
+  std::array<std::optional<Mesh*>, 4> output;
+  output[PMP::Corefinement::UNION] = &out_union;
+  output[PMP::Corefinement::INTERSECTION] = &out_inter;
+  std::array<bool, 4> res =
+    PMP::corefine_and_compute_boolean_operations(tm1, tm2, output,
+                                                 CGAL::parameters::concurrency_tag(Concurrency_tag()));
+
+  std::array<std::optional<Mesh*>, 4> seq_output;
+  seq_output[PMP::Corefinement::UNION] = &seq_out_union;
+  seq_output[PMP::Corefinement::INTERSECTION] = &seq_out_inter;
+  std::array<bool, 4> seq_res =
+    PMP::corefine_and_compute_boolean_operations(seq_tm1, seq_tm2, seq_output);
+
+  assert(res[PMP::Corefinement::UNION] == seq_res[PMP::Corefinement::UNION]);
+  assert(res[PMP::Corefinement::INTERSECTION] == seq_res[PMP::Corefinement::INTERSECTION]);
+  assert(res[PMP::Corefinement::UNION] && res[PMP::Corefinement::INTERSECTION]);
+
+  check_same(out_union, seq_out_union);
+  check_same(out_inter, seq_out_inter);
+  const double v = CGAL::to_double(PMP::volume(out_inter));
+  const double seq_v = CGAL::to_double(PMP::volume(seq_out_inter));
+  assert(std::abs(v - seq_v) <= 1e-10 * std::abs(seq_v));
+}
+
+template <typename K>
+void test_corefine(const std::string& fname)
+{
+  typedef CGAL::Surface_mesh<typename K::Point_3> Mesh;
+
+  std::cout << "== corefine " << fname << std::endl;
+
+  Mesh tm1, tm2;
+  read_mesh(fname, tm1);
+  tm2 = tm1;
+  PMP::transform(typename K::Aff_transformation_3(CGAL::Translation(),
+                                                  typename K::Vector_3(0.013, 0.017, 0.011)), tm2);
+
+  Mesh seq_tm1 = tm1, seq_tm2 = tm2;
+  Mesh other_tm1 = tm1, other_tm2 = tm2;
+
+  PMP::corefine(tm1, tm2, CGAL::parameters::concurrency_tag(Concurrency_tag()));
+  PMP::corefine(seq_tm1, seq_tm2);
+
+  check_same(tm1, seq_tm1);
+  check_same(tm2, seq_tm2);
+
+  PMP::corefine(other_tm1, other_tm2, CGAL::parameters::concurrency_tag(Concurrency_tag()));
+  check_identical(tm1, other_tm1);
+  check_identical(tm2, other_tm2);
+}
+
+void test(const std::string& filename)
+{
+  test_corefine<CGAL::Exact_predicates_inexact_constructions_kernel>(filename);
+  test_corefine<CGAL::Exact_predicates_exact_constructions_kernel>(filename);
+
+  test_boolean_operations<CGAL::Exact_predicates_exact_constructions_kernel>("data-coref/cube.off",
+                                                                             "data-coref/coplanar_with_cube1.off");
+  test_boolean_operations<CGAL::Exact_predicates_inexact_constructions_kernel>("data-coref/cow.off",
+                                                                               "data-coref/cross.off");
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : "data-coref/elephant.off";
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // use several threads even on a single core machine
+  tbb::global_control c(tbb::global_control::max_allowed_parallelism, 4);
+  tbb::task_arena arena(4);
+  arena.execute([&]{ test(filename); });
+#else
+  test(filename);
+#endif
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
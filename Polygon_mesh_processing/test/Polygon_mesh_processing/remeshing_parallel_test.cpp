@@ -0,0 +1,125 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Polyhedron_3.h>
+
+#include <CGAL/Polygon_mesh_processing/remesh.h>
+#include <CGAL/Polygon_mesh_processing/tangential_relaxation.h>
+#include <CGAL/Polygon_mesh_processing/detect_features.h>
+#include <CGAL/Polygon_mesh_processing/measure.h>
+#include <CGAL/Polygon_mesh_processing/self_intersections.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/boost/graph/IO/polygon_mesh_io.h>
+#include <CGAL/tags.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel                    Kernel;
+typedef Kernel::Point_3                                                        Point_3;
+typedef CGAL::Surface_mesh<Point_3>                                            Surface_mesh;
+typedef CGAL::Polyhedron_3<Kernel>                                             Polyhedron;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+template <typename Mesh>
+double mean_edge_length(const Mesh& mesh)
+{
+  double sum = 0;
+  for(auto e : edges(mesh))
+    sum += PMP::edge_length(e, mesh);
+  return sum / static_cast<double>(num_edges(mesh));
+}
+
+template <typename Mesh>
+void test_remeshing(const std::string& filename)
+{
+  std::cout << "== remeshing " << filename << std::endl;
+
+  Mesh mesh;
+  if(!CGAL::IO::read_polygon_mesh(filename, mesh) || !CGAL::is_triangle_mesh(mesh))
+  {
+    std::cerr << "Error: cannot read " << filename << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  Mesh seq_mesh = mesh;
+  const bool closed = CGAL::is_closed(mesh);
+
+  const double target_edge_length = 1.5 * mean_edge_length(mesh);
+
+  PMP::isotropic_remeshing(faces(mesh), target_edge_length, mesh,
+                           CGAL::parameters::number_of_iterations(3)
+                                            .concurrency_tag(Concurrency_tag()));
+  PMP::isotropic_remeshing(faces(seq_mesh), target_edge_length, seq_mesh,
+                           CGAL::parameters::number_of_iterations(3));
+
+  std::cout << num_faces(mesh) << " faces (" << num_faces(seq_mesh) << " sequentially)" << std::endl;
+
+  assert(CGAL::is_valid_polygon_mesh(mesh));
+  assert(CGAL::is_triangle_mesh(mesh));
+  assert(CGAL::is_closed(mesh) == closed);
+
+  // the parallel version only differs in the order in which vertices are moved
+  const double l = mean_edge_length(mesh), seq_l = mean_edge_length(seq_mesh);
+  std::cout << "mean edge length: " << l << " (" << seq_l << " sequentially)" << std::endl;
+  assert(l > 0.8 * seq_l && l < 1.2 * seq_l);
+  assert(num_faces(mesh) > 0.8 * num_faces(seq_mesh) && num_faces(mesh) < 1.2 * num_faces(seq_mesh));
+}
+
+template <typename Mesh>
+void test_relaxation(const std::string& filename)
+{
+  std::cout << "== relaxation " << filename << std::endl;
+
+  Mesh mesh;
+  CGAL::IO::read_polygon_mesh(filename, mesh);
+
+  typedef typename boost::graph_traits<Mesh>::edge_descriptor   edge_descriptor;
+  typedef typename boost::graph_traits<Mesh>::vertex_descriptor vertex_descriptor;
+
+  typedef CGAL::dynamic_edge_property_t<bool>                   Edge_bool_tag;
+  typedef typename boost::property_map<Mesh, Edge_bool_tag>::type Mark_map;
+  Mark_map is_feature = get(Edge_bool_tag(), mesh);
+  PMP::detect_sharp_edges(mesh, 60, is_feature);
+
+  std::vector<std::pair<vertex_descriptor, Point_3> > constrained_points;
+  for(edge_descriptor e : edges(mesh))
+  {
+    if(get(is_feature, e))
+    {
+      constrained_points.emplace_back(source(e, mesh), get(CGAL::vertex_point, mesh, source(e, mesh)));
+      constrained_points.emplace_back(target(e, mesh), get(CGAL::vertex_point, mesh, target(e, mesh)));
+    }
+  }
+
+  PMP::tangential_relaxation(mesh, CGAL::parameters::number_of_iterations(5)
+                                                    .edge_is_constrained_map(is_feature)
+                                                    .concurrency_tag(Concurrency_tag()));
+
+  assert(CGAL::is_valid_polygon_mesh(mesh));
+
+  // endpoints of constrained edges do not move
+  for(const auto& vp : constrained_points)
+    assert(get(CGAL::vertex_point, mesh, vp.first) == vp.second);
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+  const std::string filename_cube = (argc > 2) ? argv[2] : CGAL::data_file_path("meshes/cube-meshed.off");
+
+  test_remeshing<Surface_mesh>(filename);
+  test_remeshing<Polyhedron>(filename);
+  test_relaxation<Surface_mesh>(filename_cube);
+  test_relaxation<Polyhedron>(filename_cube);
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
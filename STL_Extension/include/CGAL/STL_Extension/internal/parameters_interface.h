@@ -115,6 +115,7 @@ CGAL_add_named_parameter(do_project_t, do_project, do_project)
 CGAL_add_named_parameter(do_split_t, do_split, do_split)
 CGAL_add_named_parameter(do_collapse_t, do_collapse, do_collapse)
 CGAL_add_named_parameter(do_flip_t, do_flip, do_flip)
+CGAL_add_named_parameter(concurrency_tag_t, concurrency_tag, concurrency_tag)
 CGAL_add_named_parameter(do_orientation_tests_t, do_orientation_tests, do_orientation_tests)
 CGAL_add_named_parameter(do_self_intersection_tests_t, do_self_intersection_tests, do_self_intersection_tests)
 CGAL_add_named_parameter(error_codes_t, error_codes, error_codes)
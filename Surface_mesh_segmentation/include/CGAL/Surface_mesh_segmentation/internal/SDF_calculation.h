@@ -22,12 +22,19 @@
 #include <CGAL/Surface_mesh_segmentation/internal/AABB_traits.h>
 #include <CGAL/Surface_mesh_segmentation/internal/Disk_samplers.h>
 #include <CGAL/constructions/kernel_ftC3.h>
+#include <CGAL/tags.h>
 #include <vector>
 #include <algorithm>
+#include <type_traits>
 
 #include <boost/tuple/tuple.hpp>
 #include <optional>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 #define CGAL_NUMBER_OF_MAD 1.5
 
 namespace CGAL
@@ -180,6 +187,7 @@ public:
 
   /**
    * Calculates SDF values for each facet in a range, and stores them in @a sdf_values. Note that sdf values are neither smoothed nor normalized.
+   * @tparam ConcurrencyTag if `Parallel_tag`, the rays of the facets are cast concurrently, and the values are stored once all of them are calculated
    * @tparam FacetValueMap `WritablePropertyMap` with `boost::graph_traits<Polyhedron>::face_handle` as key and `double` as value type
    * @tparam InputIterator Iterator over polyhedrons. Its value type is `pointer to polyhedron`.
    * @param facet_begin range begin
@@ -188,7 +196,8 @@ public:
    * @param number_of_rays number of rays picked from cone for each facet
    * @param[out] sdf_values
    */
-  template <class FacetValueMap, class InputIterator, class DiskSampling>
+  template <class ConcurrencyTag = Sequential_tag,
+            class FacetValueMap, class InputIterator, class DiskSampling>
   void calculate_sdf_values(
     InputIterator facet_begin,
     InputIterator facet_end,
@@ -196,9 +205,37 @@ public:
     std::size_t number_of_rays,
     FacetValueMap sdf_values,
     DiskSampling disk_sampler) const {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert(!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                  "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
     Disk_samples_list disk_samples;
     disk_sampler(number_of_rays, std::back_inserter(disk_samples));
 
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      // The AABB tree and the samples are shared, while each ray casting has
+      // its own traversal state. The property map may not support concurrent
+      // writes (e.g. an associative map), so it is filled afterwards.
+      std::vector<face_handle> facets(facet_begin, facet_end);
+      std::vector<double> values(facets.size());
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, facets.size()),
+                        [&](const tbb::blocked_range<std::size_t>& range) {
+        for(std::size_t i = range.begin(); i != range.end(); ++i) {
+          std::optional<double> sdf_value = calculate_sdf_value_of_facet(facets[i],
+                                              cone_angle, true, disk_samples);
+          values[i] = sdf_value ? *sdf_value : -1.0;
+        }
+      });
+
+      for(std::size_t i = 0; i < facets.size(); ++i) {
+        put(sdf_values, facets[i], values[i]);
+      }
+      return;
+    }
+#endif
+
     for( ; facet_begin != facet_end; ++facet_begin) {
       std::optional<double> sdf_value = calculate_sdf_value_of_facet(*facet_begin,
                                           cone_angle, true, disk_samples);
@@ -214,15 +251,17 @@ public:
   /**
    * Overload for default sampling parameter
    */
-  template <class FacetValueMap, class InputIterator>
+  template <class ConcurrencyTag = Sequential_tag,
+            class FacetValueMap, class InputIterator>
   void calculate_sdf_values(
     InputIterator facet_begin,
     InputIterator facet_end,
     double cone_angle,
     std::size_t number_of_rays,
     FacetValueMap sdf_values) const {
-    calculate_sdf_values(facet_begin, facet_end, cone_angle, number_of_rays,
-                         sdf_values, Default_sampler());
+    calculate_sdf_values<ConcurrencyTag>(facet_begin, facet_end, cone_angle,
+                                         number_of_rays, sdf_values,
+                                         Default_sampler());
   }
 
   /**
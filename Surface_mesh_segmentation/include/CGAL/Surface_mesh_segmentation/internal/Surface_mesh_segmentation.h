@@ -28,12 +28,15 @@
 #include <CGAL/Kernel/global_functions_3.h>
 
 #include <CGAL/property_map.h>
+#include <CGAL/tags.h>
 
 #include <cmath>
 #include <vector>
 #include <algorithm>
+#include <functional>
 #include <utility>
 #include <map>
+#include <queue>
 
 #define CGAL_NORMALIZATION_ALPHA 5.0
 #define CGAL_CONVEX_FACTOR 0.08
@@ -245,7 +248,7 @@ public:
   }
 
 // Use these two functions together
-  template <class SDFPropertyMap>
+  template <class ConcurrencyTag = Sequential_tag, class SDFPropertyMap>
   std::pair<double, double>
   calculate_sdf_values(double cone_angle, std::size_t number_of_rays,
                        SDFPropertyMap sdf_pmap, bool postprocess_req) {
@@ -254,8 +257,8 @@ public:
                                          false, /* build_kd_ree */
                                          true, /* use_diagonal --> set to false to use `AABB_tree::first_intersection()` */
                                          traits);
-    sdf_calculator.calculate_sdf_values(faces(mesh).first, faces(mesh).second,
-                                        cone_angle, number_of_rays, sdf_pmap);
+    sdf_calculator.template calculate_sdf_values<ConcurrencyTag>(
+      faces(mesh).first, faces(mesh).second, cone_angle, number_of_rays, sdf_pmap);
 
     Postprocess_sdf_values<Polyhedron> p;
     return postprocess_req ? p.template postprocess<Filter>(mesh,
@@ -263,6 +266,30 @@ public:
            p.min_max_value(mesh, sdf_pmap);
   }
 
+  /**
+   * Recalculates raw sdf values of the facets which are within geodesic distance @a radius of @a changed_facets.
+   * Sdf values of other facets are kept as they are.
+   * @return minimum and maximum raw sdf values
+   */
+  template <class ConcurrencyTag = Sequential_tag, class SDFPropertyMap, class FacetRange>
+  std::pair<double, double>
+  update_sdf_values(double cone_angle, std::size_t number_of_rays,
+                    SDFPropertyMap sdf_pmap, const FacetRange& changed_facets,
+                    double radius) {
+    std::vector<face_descriptor> facets;
+    collect_facets_within_radius(changed_facets, radius, facets);
+
+    // the tree is built on the whole mesh, since rays might hit any facet
+    SDF_calculation_class sdf_calculator(mesh, vertex_point_pmap,
+                                         false, /* build_kd_ree */
+                                         true, /* use_diagonal */
+                                         traits);
+    sdf_calculator.template calculate_sdf_values<ConcurrencyTag>(
+      facets.begin(), facets.end(), cone_angle, number_of_rays, sdf_pmap);
+
+    return Postprocess_sdf_values<Polyhedron>().min_max_value(mesh, sdf_pmap);
+  }
+
   template <class FacetSegmentMap, class SDFPropertyMap>
   std::size_t partition(std::size_t number_of_centers, double smoothing_lambda,
                         SDFPropertyMap sdf_pmap, FacetSegmentMap segment_pmap,
@@ -342,6 +369,72 @@ private:
     return angle;
   }
 
+  /**
+   * Collects facets whose geodesic distance to @a sources is at most @a radius.
+   * Geodesic distance is approximated with shortest paths between centroids of edge-adjacent facets (Dijkstra).
+   * @param sources range of facets with zero distance
+   * @param radius maximum distance
+   * @param[out] facets collected facets, including @a sources
+   */
+  template<class FacetRange>
+  void collect_facets_within_radius(const FacetRange& sources, double radius,
+                                    std::vector<face_descriptor>& facets) const {
+    typedef std::pair<double, face_descriptor> Distance_facet;
+    std::priority_queue<Distance_facet, std::vector<Distance_facet>,
+                        std::greater<Distance_facet> > facet_queue;
+    // only the visited region is stored, which is small for a local change
+    std::map<face_descriptor, double> distances;
+    std::map<face_descriptor, Point> centroids;
+
+    for(face_descriptor facet : sources) {
+      if(distances.insert(std::make_pair(facet, 0.0)).second) {
+        facet_queue.push(Distance_facet(0.0, facet));
+      }
+    }
+
+    while(!facet_queue.empty()) {
+      const double distance = facet_queue.top().first;
+      const face_descriptor facet = facet_queue.top().second;
+      facet_queue.pop();
+      if(distance > distances[facet]) {
+        continue;  // already settled with a shorter distance
+      }
+      facets.push_back(facet);
+
+      const Point& center = facet_centroid(facet, centroids);
+      Halfedge_around_face_circulator<Polyhedron> facet_circulator(halfedge(facet,mesh),mesh), done(facet_circulator);
+      do {
+        face_descriptor neighbor = face(opposite(*facet_circulator,mesh),mesh);
+        if(neighbor == boost::graph_traits<Polyhedron>::null_face()) {
+          continue;
+        }
+        const double neighbor_distance = distance + std::sqrt(to_double(
+          traits.compute_squared_distance_3_object()(center, facet_centroid(neighbor, centroids))));
+        if(neighbor_distance > radius) {
+          continue;
+        }
+        typename std::map<face_descriptor, double>::iterator it = distances.find(neighbor);
+        if(it == distances.end() || neighbor_distance < it->second) {
+          distances[neighbor] = neighbor_distance;
+          facet_queue.push(Distance_facet(neighbor_distance, neighbor));
+        }
+      } while( ++facet_circulator != done);
+    }
+  }
+
+  const Point& facet_centroid(face_descriptor facet,
+                              std::map<face_descriptor, Point>& centroids) const {
+    typename std::map<face_descriptor, Point>::iterator it = centroids.find(facet);
+    if(it == centroids.end()) {
+      const Point p1 = get(vertex_point_pmap,target(halfedge(facet,mesh),mesh));
+      const Point p2 = get(vertex_point_pmap,target(next(halfedge(facet,mesh),mesh),mesh));
+      const Point p3 = get(vertex_point_pmap,target(prev(halfedge(facet,mesh),mesh),mesh));
+      it = centroids.insert(std::make_pair(facet,
+             traits.construct_centroid_3_object()(p1, p2, p3))).first;
+    }
+    return it->second;
+  }
+
   /**
    * Normalize sdf values using function:
    * normalized_sdf = log( alpha * ( current_sdf - min_sdf ) / ( max_sdf - min_sdf ) + 1 ) / log( alpha + 1 )
@@ -24,6 +24,7 @@
 #include <CGAL/boost/graph/helpers.h>
 #include <boost/config.hpp>
 #include <CGAL/Kernel/global_functions_3.h>
+#include <CGAL/tags.h>
 
 namespace CGAL
 {
@@ -40,6 +41,7 @@ template <bool Fast_sdf_calculation_mode, class TriangleMesh,
 #ifdef DOXYGEN_RUNNING
          = typename Kernel_traits<typename boost::property_traits<PointPropertyMap>::value_type>::Kernel
 #endif
+         , class ConcurrencyTag = Sequential_tag
          >
 std::pair<double, double>
 sdf_values( const TriangleMesh& triangle_mesh,
@@ -53,8 +55,8 @@ sdf_values( const TriangleMesh& triangle_mesh,
   typedef PointPropertyMap VPMap;
   internal::Surface_mesh_segmentation<TriangleMesh, GeomTraits, VPMap, Fast_sdf_calculation_mode>
     algorithm(triangle_mesh, traits, ppmap);
-  return algorithm.calculate_sdf_values(cone_angle, number_of_rays,
-                                        sdf_values_map, postprocess);
+  return algorithm.template calculate_sdf_values<ConcurrencyTag>(cone_angle, number_of_rays,
+                                                                 sdf_values_map, postprocess);
 }
 /// @endcond
 
@@ -68,6 +70,8 @@ sdf_values( const TriangleMesh& triangle_mesh,
  *
  * @pre `is_triangle_mesh(triangle_mesh)`
  *
+ * @tparam ConcurrencyTag enables sequential versus parallel algorithm. Possible values are `Sequential_tag`,
+ *                        `Parallel_tag`, and `Parallel_if_available_tag`. In parallel, the rays of the facets are cast concurrently.
  * @tparam TriangleMesh a model of `FaceListGraph`
  * @tparam SDFPropertyMap  a `ReadWritePropertyMap` with `boost::graph_traits<TriangleMesh>::%face_descriptor` as key and `double` as value type
  * @tparam GeomTraits a model of `SegmentationGeomTraits`
@@ -83,7 +87,11 @@ sdf_values( const TriangleMesh& triangle_mesh,
  *
  * @return minimum and maximum raw SDF values if  `postprocess` is `true`, otherwise minimum and maximum SDF values (before linear normalization)
  */
-template <class TriangleMesh, class SDFPropertyMap, class PointPropertyMap
+template <class ConcurrencyTag
+#ifdef DOXYGEN_RUNNING
+         = Sequential_tag
+#endif
+, class TriangleMesh, class SDFPropertyMap, class PointPropertyMap
 #ifdef DOXYGEN_RUNNING
          = typename boost::property_map<TriangleMesh, boost::vertex_point_t>::type
 #endif
@@ -101,11 +109,80 @@ sdf_values( const TriangleMesh& triangle_mesh,
             PointPropertyMap ppmap = PointPropertyMap(),
             GeomTraits traits = GeomTraits())
 {
-  return sdf_values<true, TriangleMesh, SDFPropertyMap, PointPropertyMap, GeomTraits>
+  return sdf_values<true, TriangleMesh, SDFPropertyMap, PointPropertyMap, GeomTraits, ConcurrencyTag>
          (triangle_mesh, sdf_values_map, cone_angle, number_of_rays, postprocess, ppmap, traits);
 }
 
 
+/*!
+ * \ingroup PkgSurfaceMeshSegmentationRef
+ * @brief Function updating the raw SDF values of a surface mesh after a local modification.
+ *
+ * The raw SDF values of the facets whose geodesic distance to the facets in `changed_facets` is at most `radius`
+ * are recomputed, and the values of the other facets are kept. The geodesic distance is approximated by
+ * the length of the shortest path between the centroids of edge-adjacent facets.
+ *
+ * The rays of a facet that is farther from the modification may still hit it, so `radius` trades
+ * the cost of the update for its accuracy: with a radius larger than the diameter of the mesh,
+ * all values are those that `CGAL::sdf_values()` computes without post-processing.
+ *
+ * \note The values are not post-processed, so that they can be updated again. `CGAL::sdf_values_postprocessing()`
+ *       can be called on a copy of them.
+ *
+ * @pre `is_triangle_mesh(triangle_mesh)`
+ * @pre `sdf_values_map` contains the raw SDF values (computed by `CGAL::sdf_values()` with `postprocess` set to `false`,
+ *      or by a previous call to this function) of the facets that are not within `radius` of `changed_facets`.
+ *      In particular, new facets must belong to `changed_facets`.
+ *
+ * @tparam ConcurrencyTag enables sequential versus parallel algorithm. Possible values are `Sequential_tag`,
+ *                        `Parallel_tag`, and `Parallel_if_available_tag`. In parallel, the rays of the facets are cast concurrently.
+ * @tparam TriangleMesh a model of `FaceListGraph`
+ * @tparam SDFPropertyMap  a `ReadWritePropertyMap` with `boost::graph_traits<TriangleMesh>::%face_descriptor` as key and `double` as value type
+ * @tparam FacetRange a model of `ConstRange` with `boost::graph_traits<TriangleMesh>::%face_descriptor` as value type
+ * @tparam GeomTraits a model of `SegmentationGeomTraits`
+ * @tparam PointPropertyMap a `ReadablePropertyMap` with `boost::graph_traits<TriangleMesh>::%vertex_descriptor` as key and `GeomTraits::Point_3` as value type.
+ *
+ * @param triangle_mesh surface mesh on which SDF values are computed
+ * @param[in, out] sdf_values_map the raw SDF value of each facet
+ * @param changed_facets the facets that were created or modified since the values were computed
+ * @param radius the geodesic radius around `changed_facets` in which the values are recomputed
+ * @param cone_angle opening angle in radians for the cone of each facet
+ * @param number_of_rays number of rays picked in the cone of each facet
+ * @param traits traits class
+ * @param ppmap point property map. An overload is provided with `get(boost::vertex_point,triangle_mesh)` as default.
+ *
+ * @return minimum and maximum raw SDF values
+ */
+template <class ConcurrencyTag
+#ifdef DOXYGEN_RUNNING
+         = Sequential_tag
+#endif
+, class TriangleMesh, class SDFPropertyMap, class FacetRange, class PointPropertyMap
+#ifdef DOXYGEN_RUNNING
+         = typename boost::property_map<TriangleMesh, boost::vertex_point_t>::type
+#endif
+, class GeomTraits
+#ifdef DOXYGEN_RUNNING
+=  typename Kernel_traits<typename boost::property_traits<PointPropertyMap>::value_type>::Kernel
+#endif
+>
+std::pair<double, double>
+update_sdf_values( const TriangleMesh& triangle_mesh,
+                   SDFPropertyMap sdf_values_map,
+                   const FacetRange& changed_facets,
+                   double radius,
+                   double cone_angle = 2.0 / 3.0 * CGAL_PI,
+                   std::size_t number_of_rays = 25,
+                   PointPropertyMap ppmap = PointPropertyMap(),
+                   GeomTraits traits = GeomTraits())
+{
+  internal::Surface_mesh_segmentation<TriangleMesh, GeomTraits, PointPropertyMap>
+    algorithm(triangle_mesh, traits, ppmap);
+  return algorithm.template update_sdf_values<ConcurrencyTag>(cone_angle, number_of_rays,
+                                                              sdf_values_map, changed_facets, radius);
+}
+
+
 /*!
  * \ingroup PkgSurfaceMeshSegmentationRef
  * @brief Function post-processing raw SDF values computed per facet.
@@ -335,7 +412,7 @@ sdf_values( const TriangleMesh& triangle_mesh,
          (triangle_mesh, sdf_values_map, cone_angle, number_of_rays, postprocess, ppmap, traits);
 }
 
-template < class TriangleMesh, class SDFPropertyMap, class PointPropertyMap>
+template < class ConcurrencyTag, class TriangleMesh, class SDFPropertyMap, class PointPropertyMap>
 std::pair<double, double>
 sdf_values( const TriangleMesh& triangle_mesh,
             SDFPropertyMap sdf_values_map,
@@ -347,11 +424,11 @@ sdf_values( const TriangleMesh& triangle_mesh,
   typedef typename boost::property_traits<PointPropertyMap>::value_type Point_3;
   typedef typename Kernel_traits<Point_3>::Kernel GeomTraits;
   GeomTraits traits;
-  return sdf_values<true, TriangleMesh, SDFPropertyMap, PointPropertyMap, GeomTraits>
+  return sdf_values<true, TriangleMesh, SDFPropertyMap, PointPropertyMap, GeomTraits, ConcurrencyTag>
          (triangle_mesh, sdf_values_map, cone_angle, number_of_rays, postprocess, ppmap, traits);
 }
 
-template < class TriangleMesh, class SDFPropertyMap>
+template < class ConcurrencyTag, class TriangleMesh, class SDFPropertyMap>
 std::pair<double, double>
 sdf_values( const TriangleMesh& triangle_mesh,
             SDFPropertyMap sdf_values_map,
@@ -364,10 +441,127 @@ sdf_values( const TriangleMesh& triangle_mesh,
   typedef typename boost::property_traits<PointPropertyMap>::value_type Point_3;
   typedef typename Kernel_traits<Point_3>::Kernel GeomTraits;
   GeomTraits traits;
-  return sdf_values<true, TriangleMesh, SDFPropertyMap, PointPropertyMap, GeomTraits>
+  return sdf_values<true, TriangleMesh, SDFPropertyMap, PointPropertyMap, GeomTraits, ConcurrencyTag>
+         (triangle_mesh, sdf_values_map, cone_angle, number_of_rays, postprocess, ppmap, traits);
+}
+
+template < class TriangleMesh, class SDFPropertyMap, class PointPropertyMap, class GeomTraits>
+std::pair<double, double>
+sdf_values( const TriangleMesh& triangle_mesh,
+            SDFPropertyMap sdf_values_map,
+            double cone_angle,
+            std::size_t number_of_rays,
+            bool postprocess,
+            PointPropertyMap ppmap,
+            GeomTraits traits)
+{
+  return sdf_values<Sequential_tag, TriangleMesh, SDFPropertyMap, PointPropertyMap, GeomTraits>
          (triangle_mesh, sdf_values_map, cone_angle, number_of_rays, postprocess, ppmap, traits);
 }
 
+template < class TriangleMesh, class SDFPropertyMap, class PointPropertyMap>
+std::pair<double, double>
+sdf_values( const TriangleMesh& triangle_mesh,
+            SDFPropertyMap sdf_values_map,
+            double cone_angle = 2.0 / 3.0 * CGAL_PI,
+            std::size_t number_of_rays = 25,
+            bool postprocess = true,
+            PointPropertyMap ppmap = PointPropertyMap())
+{
+  return sdf_values<Sequential_tag, TriangleMesh, SDFPropertyMap, PointPropertyMap>
+         (triangle_mesh, sdf_values_map, cone_angle, number_of_rays, postprocess, ppmap);
+}
+
+template < class TriangleMesh, class SDFPropertyMap>
+std::pair<double, double>
+sdf_values( const TriangleMesh& triangle_mesh,
+            SDFPropertyMap sdf_values_map,
+            double cone_angle = 2.0 / 3.0 * CGAL_PI,
+            std::size_t number_of_rays = 25,
+            bool postprocess = true)
+{
+  return sdf_values<Sequential_tag, TriangleMesh, SDFPropertyMap>
+         (triangle_mesh, sdf_values_map, cone_angle, number_of_rays, postprocess);
+}
+
+/// update_sdf_values ///
+template < class ConcurrencyTag, class TriangleMesh, class SDFPropertyMap, class FacetRange, class PointPropertyMap>
+std::pair<double, double>
+update_sdf_values( const TriangleMesh& triangle_mesh,
+                   SDFPropertyMap sdf_values_map,
+                   const FacetRange& changed_facets,
+                   double radius,
+                   double cone_angle = 2.0 / 3.0 * CGAL_PI,
+                   std::size_t number_of_rays = 25,
+                   PointPropertyMap ppmap = PointPropertyMap())
+{
+  typedef typename boost::property_traits<PointPropertyMap>::value_type Point_3;
+  typedef typename Kernel_traits<Point_3>::Kernel GeomTraits;
+  GeomTraits traits;
+  return update_sdf_values<ConcurrencyTag, TriangleMesh, SDFPropertyMap, FacetRange, PointPropertyMap, GeomTraits>
+         (triangle_mesh, sdf_values_map, changed_facets, radius, cone_angle, number_of_rays, ppmap, traits);
+}
+
+template < class ConcurrencyTag, class TriangleMesh, class SDFPropertyMap, class FacetRange>
+std::pair<double, double>
+update_sdf_values( const TriangleMesh& triangle_mesh,
+                   SDFPropertyMap sdf_values_map,
+                   const FacetRange& changed_facets,
+                   double radius,
+                   double cone_angle = 2.0 / 3.0 * CGAL_PI,
+                   std::size_t number_of_rays = 25)
+{
+  typedef typename boost::property_map<TriangleMesh, boost::vertex_point_t>::type PointPropertyMap;
+  PointPropertyMap ppmap = get(boost::vertex_point, const_cast<TriangleMesh&>(triangle_mesh));
+  typedef typename boost::property_traits<PointPropertyMap>::value_type Point_3;
+  typedef typename Kernel_traits<Point_3>::Kernel GeomTraits;
+  GeomTraits traits;
+  return update_sdf_values<ConcurrencyTag, TriangleMesh, SDFPropertyMap, FacetRange, PointPropertyMap, GeomTraits>
+         (triangle_mesh, sdf_values_map, changed_facets, radius, cone_angle, number_of_rays, ppmap, traits);
+}
+
+template < class TriangleMesh, class SDFPropertyMap, class FacetRange, class PointPropertyMap, class GeomTraits>
+std::pair<double, double>
+update_sdf_values( const TriangleMesh& triangle_mesh,
+                   SDFPropertyMap sdf_values_map,
+                   const FacetRange& changed_facets,
+                   double radius,
+                   double cone_angle,
+                   std::size_t number_of_rays,
+                   PointPropertyMap ppmap,
+                   GeomTraits traits)
+{
+  return update_sdf_values<Sequential_tag, TriangleMesh, SDFPropertyMap, FacetRange, PointPropertyMap, GeomTraits>
+         (triangle_mesh, sdf_values_map, changed_facets, radius, cone_angle, number_of_rays, ppmap, traits);
+}
+
+template < class TriangleMesh, class SDFPropertyMap, class FacetRange, class PointPropertyMap>
+std::pair<double, double>
+update_sdf_values( const TriangleMesh& triangle_mesh,
+                   SDFPropertyMap sdf_values_map,
+                   const FacetRange& changed_facets,
+                   double radius,
+                   double cone_angle = 2.0 / 3.0 * CGAL_PI,
+                   std::size_t number_of_rays = 25,
+                   PointPropertyMap ppmap = PointPropertyMap())
+{
+  return update_sdf_values<Sequential_tag, TriangleMesh, SDFPropertyMap, FacetRange, PointPropertyMap>
+         (triangle_mesh, sdf_values_map, changed_facets, radius, cone_angle, number_of_rays, ppmap);
+}
+
+template < class TriangleMesh, class SDFPropertyMap, class FacetRange>
+std::pair<double, double>
+update_sdf_values( const TriangleMesh& triangle_mesh,
+                   SDFPropertyMap sdf_values_map,
+                   const FacetRange& changed_facets,
+                   double radius,
+                   double cone_angle = 2.0 / 3.0 * CGAL_PI,
+                   std::size_t number_of_rays = 25)
+{
+  return update_sdf_values<Sequential_tag, TriangleMesh, SDFPropertyMap, FacetRange>
+         (triangle_mesh, sdf_values_map, changed_facets, radius, cone_angle, number_of_rays);
+}
+
 /// segmentation_from_sdf_values ///
 template <class TriangleMesh, class SDFPropertyMap, class SegmentPropertyMap, class PointPropertyMap>
 std::size_t
@@ -0,0 +1,174 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Polyhedron_3.h>
+#include <CGAL/tags.h>
+
+#include <CGAL/mesh_segmentation.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+#endif
+
+#include <cassert>
+#include <map>
+#include <set>
+#include <vector>
+#include <CGAL/property_map.h>
+
+#include "Utils.h"
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef CGAL::Polyhedron_3<Kernel> Polyhedron;
+
+typedef std::map<Polyhedron::Facet_const_handle, double> Facet_double_map;
+typedef boost::associative_property_map<Facet_double_map> Facet_double_pmap;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+void test_parallel_sdf_values(const Polyhedron& mesh)
+{
+  Facet_double_map seq_map, par_map;
+  std::pair<double, double> seq_min_max = CGAL::sdf_values(mesh, Facet_double_pmap(seq_map));
+  std::pair<double, double> par_min_max =
+    CGAL::sdf_values<Concurrency_tag>(mesh, Facet_double_pmap(par_map));
+  assert(seq_min_max == par_min_max);
+  assert(seq_map == par_map);
+
+  Facet_double_map seq_raw_map, par_raw_map;
+  CGAL::sdf_values(mesh, Facet_double_pmap(seq_raw_map), 2.0 / 3.0 * CGAL_PI, 25, false);
+  CGAL::sdf_values<Concurrency_tag>(mesh, Facet_double_pmap(par_raw_map), 2.0 / 3.0 * CGAL_PI, 25, false);
+  assert(seq_raw_map == par_raw_map);
+  std::cout << "  " << par_map.size() << " facets, raw SDF values in ["
+            << par_min_max.first << ", " << par_min_max.second << "]" << std::endl;
+}
+
+void test_update_sdf_values(Polyhedron& mesh)
+{
+  Facet_double_map raw_map;
+  CGAL::sdf_values(mesh, Facet_double_pmap(raw_map), 2.0 / 3.0 * CGAL_PI, 25, false);
+  const Facet_double_map old_map = raw_map;
+
+  // pull a vertex outward, and its neighbors halfway
+  Polyhedron::Vertex_handle v = mesh.vertices_begin();
+  Kernel::Vector_3 n = CGAL::NULL_VECTOR;
+  Polyhedron::Halfedge_around_vertex_circulator hc = v->vertex_begin(), done(hc);
+  do {
+    if(!hc->is_border())
+      n = n + CGAL::unit_normal(hc->vertex()->point(), hc->next()->vertex()->point(),
+                                hc->prev()->vertex()->point());
+  } while(++hc != done);
+  const Kernel::Vector_3 shift = 0.5 * CGAL::sqrt(CGAL::squared_distance(v->point(),
+                                                  v->halfedge()->opposite()->vertex()->point())) * n;
+
+  std::set<Polyhedron::Facet_handle> changed_facets;
+  std::vector<Polyhedron::Vertex_handle> neighbors;
+  do {
+    neighbors.push_back(hc->opposite()->vertex());
+  } while(++hc != done);
+  v->point() = v->point() + shift;
+  for(Polyhedron::Vertex_handle w : neighbors)
+    w->point() = w->point() + 0.5 * shift;
+  neighbors.push_back(v);
+  for(Polyhedron::Vertex_handle w : neighbors)
+  {
+    hc = w->vertex_begin(); done = hc;
+    do {
+      if(!hc->is_border())
+        changed_facets.insert(hc->facet());
+    } while(++hc != done);
+  }
+
+  Facet_double_map full_map;
+  std::pair<double, double> full_min_max =
+    CGAL::sdf_values(mesh, Facet_double_pmap(full_map), 2.0 / 3.0 * CGAL_PI, 25, false);
+
+  // a radius larger than the mesh recomputes everything
+  Facet_double_map all_map = old_map;
+  std::pair<double, double> all_min_max =
+    CGAL::update_sdf_values<Concurrency_tag>(mesh, Facet_double_pmap(all_map), changed_facets, 1e10);
+  assert(all_map == full_map);
+  assert(all_min_max == full_min_max);
+
+  // a local update recomputes the facets close to the modification only
+  const CGAL::Bbox_3 bbox = CGAL::bbox_3(mesh.points_begin(), mesh.points_end());
+  const double radius = 0.1 * (bbox.xmax() - bbox.xmin());
+  Facet_double_map local_map = old_map;
+  CGAL::update_sdf_values(mesh, Facet_double_pmap(local_map), changed_facets, radius);
+
+  std::size_t nb_updated = 0;
+  for(Polyhedron::Facet_iterator f = mesh.facets_begin(); f != mesh.facets_end(); ++f)
+  {
+    assert(local_map[f] == old_map.at(f) || local_map[f] == full_map[f]);
+    if(changed_facets.count(f) != 0)
+      assert(local_map[f] == full_map[f]);
+    if(local_map[f] != old_map.at(f))
+      ++nb_updated;
+  }
+  std::cout << "  " << changed_facets.size() << " changed facets, "
+            << nb_updated << " updated SDF values" << std::endl;
+  assert(nb_updated > 0);
+  assert(nb_updated < mesh.size_of_facets());
+
+  // a null radius recomputes the changed facets only
+  Facet_double_map null_map = old_map;
+  CGAL::update_sdf_values<Concurrency_tag>(mesh, Facet_double_pmap(null_map), changed_facets, 0.);
+  for(Polyhedron::Facet_iterator f = mesh.facets_begin(); f != mesh.facets_end(); ++f)
+    assert(null_map[f] == (changed_facets.count(f) != 0 ? full_map[f] : old_map.at(f)));
+}
+
+void test_explicit_traits(Polyhedron& mesh)
+{
+  // the full calls without a concurrency tag
+  Facet_double_map default_map, traits_map;
+  CGAL::sdf_values(mesh, Facet_double_pmap(default_map), 2.0 / 3.0 * CGAL_PI, 25, false);
+  std::pair<double, double> min_max =
+    CGAL::sdf_values(mesh, Facet_double_pmap(traits_map), 2.0 / 3.0 * CGAL_PI, 25, false,
+                     get(CGAL::vertex_point, mesh), Kernel());
+  assert(traits_map == default_map);
+
+  std::set<Polyhedron::Facet_handle> changed_facets;
+  changed_facets.insert(mesh.facets_begin());
+  Facet_double_map updated_map = traits_map;
+  std::pair<double, double> updated_min_max =
+    CGAL::update_sdf_values(mesh, Facet_double_pmap(updated_map), changed_facets, 1e10,
+                            2.0 / 3.0 * CGAL_PI, 25, get(CGAL::vertex_point, mesh), Kernel());
+  assert(updated_map == traits_map);
+  assert(updated_min_max == min_max);
+
+  Facet_double_map par_map;
+  CGAL::sdf_values<Concurrency_tag>(mesh, Facet_double_pmap(par_map), 2.0 / 3.0 * CGAL_PI, 25, false,
+                                    get(CGAL::vertex_point, mesh), Kernel());
+  assert(par_map == traits_map);
+}
+
+void test(Polyhedron& mesh)
+{
+  std::cout << "== explicit traits" << std::endl;
+  test_explicit_traits(mesh);
+  std::cout << "== parallel SDF values" << std::endl;
+  test_parallel_sdf_values(mesh);
+  std::cout << "== incremental SDF values" << std::endl;
+  test_update_sdf_values(mesh);
+}
+
+int main(void)
+{
+  Polyhedron mesh;
+  if( !read_to_polyhedron(CGAL::data_file_path("meshes/cactus.off"), mesh) ) { return 1; }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // cast rays with several threads, whatever the number of cores
+  tbb::global_control c(tbb::global_control::max_allowed_parallelism, 4);
+  tbb::task_arena arena(4);
+  arena.execute([&]{ test(mesh); });
+#else
+  test(mesh);
+#endif
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -24,7 +24,12 @@
 #include <CGAL/boost/graph/iterator.h>
 #include <CGAL/Default.h>
 #include <CGAL/enum.h>
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/Kernel_traits.h>
 #include <CGAL/number_utils.h>
+#include <CGAL/property_map.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+#include <CGAL/tags.h>
 
 #include <boost/lexical_cast.hpp>
 #include <boost/variant/get.hpp>
@@ -33,11 +38,21 @@
 #include <cstddef>
 #include <iterator>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
 #include <queue>
 #include <utility>
 #include <vector>
 #include <type_traits>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
+
 namespace CGAL {
 
 /*!
@@ -289,6 +304,42 @@ private:
                               Surface_mesh_shortest_paths_3::internal::Cone_expansion_event_min_priority_queue_comparator<Traits> > Expansion_priqueue;
   typedef std::pair<Cone_tree_node*, FT> Node_distance_pair;
 
+  // The smallest distances found at the vertices by the sequence trees of groups
+  // of source points, which are built concurrently. Each tree uses the distances
+  // found by the others to filter its windows.
+  class Shared_vertex_distances
+  {
+    std::vector<FT> m_distances; // negative if no distance was found
+    std::vector<std::mutex> m_mutexes;
+
+    std::mutex& mutex(const std::size_t vertexIndex)
+    {
+      return m_mutexes[vertexIndex % m_mutexes.size()];
+    }
+
+  public:
+    Shared_vertex_distances(const std::size_t numVertices)
+      : m_distances(numVertices, FT(-1))
+      , m_mutexes(1024)
+    {
+    }
+
+    FT distance(const std::size_t vertexIndex)
+    {
+      std::lock_guard<std::mutex> lock(mutex(vertexIndex));
+      return m_distances[vertexIndex];
+    }
+
+    void update(const std::size_t vertexIndex, const FT& distance)
+    {
+      std::lock_guard<std::mutex> lock(mutex(vertexIndex));
+      if (m_distances[vertexIndex] < FT(0) || distance < m_distances[vertexIndex])
+      {
+        m_distances[vertexIndex] = distance;
+      }
+    }
+  };
+
 private:
 
   template <class OutputIterator>
@@ -345,6 +396,14 @@ private:
 
   Expansion_priqueue m_expansionPriqueue;
 
+  std::optional<FT> m_maxDistance;
+  std::optional<FT> m_builtMaxDistance;
+
+  // Set while the sequence tree of a group of source points is built concurrently with the others
+  Shared_vertex_distances* m_sharedDistances = nullptr;
+  // The objects that own the sequence trees of the groups of source points, if built in parallel
+  std::vector<std::unique_ptr<Surface_mesh_shortest_path> > m_sourceGroups;
+
 #if !defined(NDEBUG)
   std::size_t m_currentNodeCount;
   std::size_t m_peakNodeCount;
@@ -631,6 +690,33 @@ private:
       return false;
     }
 
+    // Same tests with the distances found by the sequence trees of the other groups of source points,
+    // when they are smaller than the ones of this tree
+    if (m_sharedDistances != nullptr)
+    {
+      const FT s1 = m_sharedDistances->distance(v1Index);
+      const FT s2 = m_sharedDistances->distance(v2Index);
+      const FT s3 = m_sharedDistances->distance(v3Index);
+
+      if (s1 >= FT(0) && (v1Distance.first == nullptr || s1 < d1) &&
+          d + CGAL::approximate_sqrt(csd2(I, B)) > s1 + CGAL::approximate_sqrt(csd2(v1, B)))
+      {
+        return false;
+      }
+
+      if (s2 >= FT(0) && (v2Distance.first == nullptr || s2 < d2) &&
+          d + CGAL::approximate_sqrt(csd2(I, A)) > s2 + CGAL::approximate_sqrt(csd2(v2, A)))
+      {
+        return false;
+      }
+
+      if (s3 >= FT(0) && (v3Distance.first == nullptr || s3 < d3) &&
+          d + CGAL::approximate_sqrt(csd2(I, A)) > s3 + CGAL::approximate_sqrt(csd2(v3, A)))
+      {
+        return false;
+      }
+    }
+
     return true;
   }
 
@@ -959,6 +1045,11 @@ private:
 
     m_closestToVertices[get(m_vertexIndexMap, vertex)] = Node_distance_pair(vertexRoot, FT(0));
 
+    if (m_sharedDistances != nullptr)
+    {
+      m_sharedDistances->update(get(m_vertexIndexMap, vertex), FT(0));
+    }
+
     expand_pseudo_source(vertexRoot);
   }
 
@@ -1441,6 +1532,11 @@ private:
           }
 
           m_closestToVertices[targetVertexIndex] = Node_distance_pair(node, currentNodeDistance);
+
+          if (m_sharedDistances != nullptr)
+          {
+            m_sharedDistances->update(targetVertexIndex, currentNodeDistance);
+          }
         }
       }
       else // there is already an occupier, at a strictly smaller distance
@@ -1710,6 +1806,12 @@ private:
 
   void delete_all_nodes()
   {
+    // the nodes of sequence trees built in parallel are owned by the groups of source points
+    if (!m_sourceGroups.empty())
+    {
+      return;
+    }
+
     for (std::size_t i = 0; i < m_rootNodes.size(); ++i)
     {
       delete_node(m_rootNodes[i].first, true);
@@ -1736,6 +1838,7 @@ private:
 
     delete_all_nodes();
     m_rootNodes.clear();
+    m_sourceGroups.clear();
     m_vertexIsPseudoSource.assign(num_vertices(m_graph), false);
 
 #if !defined(NDEBUG)
@@ -1908,6 +2011,11 @@ private:
       {
         FT currentDistance = current->distance_to_root(locationInContext);
 
+        if (m_builtMaxDistance && currentDistance > *m_builtMaxDistance)
+        {
+          continue;
+        }
+
         if (closest == nullptr || currentDistance < closestDistance)
         {
           closest = current;
@@ -2152,6 +2260,15 @@ private:
       }
 
       Cone_expansion_event* event = m_expansionPriqueue.top();
+
+      // The estimates are lower bounds of the distances in the windows, and they are
+      // popped in increasing order, so no other point is within the maximum distance
+      if (m_maxDistance && event->m_distanceEstimate > *m_maxDistance)
+      {
+        discard_pending_events();
+        break;
+      }
+
       m_expansionPriqueue.pop();
 
       if (!event->m_cancelled)
@@ -2206,6 +2323,67 @@ private:
       delete event;
     }
 
+    build_face_occupiers();
+    discard_vertices_beyond_maximum_distance();
+
+    if (m_debugOutput)
+    {
+      std::cout << "Closest distances: " << std::endl;
+
+      for (std::size_t i = 0; i < m_closestToVertices.size(); ++i)
+      {
+        std::cout << "\tVertex = " << i << std::endl;
+        std::cout << "\tDistance = " << m_closestToVertices[i].second << " to " << m_closestToVertices[i].first << std::endl;
+      }
+
+      std::cout << std::endl;
+
+      for (std::size_t i = 0; i < m_faceOccupiers.size(); ++i)
+      {
+        std::cout << "\tFace = " << i << std::endl;
+        std::cout << "\t#Occupiers = " << m_faceOccupiers[i].size() << std::endl;
+      }
+
+      std::cout << std::endl << "Done!" << std::endl;
+    }
+
+    m_firstNewSourcePoint = m_faceLocations.end();
+    m_deletedSourceLocations.clear();
+    m_builtMaxDistance = m_maxDistance;
+  }
+
+  /*
+    Delete the events left in the queue when the expansion stops at the maximum distance
+  */
+  void discard_pending_events()
+  {
+    while (!m_expansionPriqueue.empty())
+    {
+      Cone_expansion_event* event = m_expansionPriqueue.top();
+      m_expansionPriqueue.pop();
+
+      if (!event->m_cancelled)
+      {
+        switch (event->m_type)
+        {
+          case Cone_expansion_event::PSEUDO_SOURCE:
+            event->m_parent->m_pendingMiddleSubtree = nullptr;
+            break;
+          case Cone_expansion_event::LEFT_CHILD:
+            event->m_parent->m_pendingLeftSubtree = nullptr;
+            break;
+          case Cone_expansion_event::RIGHT_CHILD:
+            event->m_parent->m_pendingRightSubtree = nullptr;
+            break;
+        }
+      }
+
+      delete event;
+    }
+  }
+
+  void build_face_occupiers()
+  {
     m_faceOccupiers.clear();
     m_faceOccupiers.resize(num_faces(m_graph));
 
@@ -2219,32 +2397,156 @@ private:
       std::vector<Cone_tree_node*>& currentFaceList = m_faceOccupiers[i];
       std::sort(currentFaceList.begin(), currentFaceList.end(), cone_comparator);
     }
+  }
 
-    if (m_debugOutput)
+  /*
+    Nodes processed before the expansion stopped may reach vertices farther than the maximum distance,
+    possibly not along their shortest paths
+  */
+  void discard_vertices_beyond_maximum_distance()
+  {
+    if (!m_maxDistance)
     {
-      std::cout << "Closest distances: " << std::endl;
+      return;
+    }
 
-      for (std::size_t i = 0; i < m_closestToVertices.size(); ++i)
+    for (std::size_t i = 0; i < m_closestToVertices.size(); ++i)
+    {
+      if (m_closestToVertices[i].first != nullptr && m_closestToVertices[i].second > *m_maxDistance)
       {
-        std::cout << "\tVertex = " << i << std::endl;
-        std::cout << "\tDistance = " << m_closestToVertices[i].second << " to " << m_closestToVertices[i].first << std::endl;
+        m_closestToVertices[i] = Node_distance_pair(nullptr, FT(-1));
       }
+    }
+  }
 
-      std::cout << std::endl;
+  static bool is_closer(const Node_distance_pair& candidate, const Node_distance_pair& current)
+  {
+    // If equal times, give priority to vertex sources, as in `process_node()`
+    return candidate.first != nullptr &&
+           (current.first == nullptr ||
+            candidate.second < current.second ||
+            (candidate.second == current.second &&
+             candidate.first->node_type() == Cone_tree_node::VERTEX_SOURCE));
+  }
 
-      for (std::size_t i = 0; i < m_faceOccupiers.size(); ++i)
+#ifdef CGAL_LINKED_WITH_TBB
+  /*
+    Split the source points into groups of nearby points along a Hilbert curve, build the sequence
+    trees of the groups concurrently, and merge them. The trees filter their windows with the distances
+    at the vertices found by the other trees, so that a tree does not expand far into the regions that
+    are closer to other groups.
+  */
+  void construct_sequence_tree_in_parallel(const std::size_t numGroups)
+  {
+    typedef typename Kernel_traits<Point_3>::Kernel Kernel;
+    typedef typename Pointer_property_map<Point_3>::type Point_pmap;
+    typedef Spatial_sort_traits_adapter_3<Kernel, Point_pmap> Search_traits;
+
+    reset_algorithm(false);
+    set_vertex_types();
+
+    std::vector<Source_point_underlying_iterator> sourcePoints;
+    std::vector<Point_3> sourceLocations;
+    for (Source_point_underlying_iterator it = m_faceLocations.begin(); it != m_faceLocations.end(); ++it)
+    {
+      sourcePoints.push_back(it);
+      sourceLocations.push_back(point(it->first, it->second));
+    }
+
+    std::vector<std::size_t> order(sourcePoints.size());
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    hilbert_sort(order.begin(), order.end(), Search_traits(make_property_map(sourceLocations)));
+
+    Shared_vertex_distances sharedDistances(num_vertices(m_graph));
+    std::vector<std::size_t> groupBegins;
+    for (std::size_t g = 0; g < numGroups; ++g)
+    {
+      m_sourceGroups.emplace_back(new Surface_mesh_shortest_path(m_graph, m_vertexIndexMap, m_halfedgeIndexMap,
+                                                                 m_faceIndexMap, m_vertexPointMap, m_traits));
+      Surface_mesh_shortest_path& group = *m_sourceGroups.back();
+      group.m_maxDistance = m_maxDistance;
+      group.m_sharedDistances = &sharedDistances;
+
+      groupBegins.push_back(g * order.size() / numGroups);
+      for (std::size_t i = groupBegins.back(); i < (g + 1) * order.size() / numGroups; ++i)
       {
-        std::cout << "\tFace = " << i << std::endl;
-        std::cout << "\t#Occupiers = " << m_faceOccupiers[i].size() << std::endl;
+        group.add_source_point(*sourcePoints[order[i]]);
       }
+    }
 
-      std::cout << std::endl << "Done!" << std::endl;
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, numGroups, 1),
+                      [&](const tbb::blocked_range<std::size_t>& range)
+    {
+      for (std::size_t g = range.begin(); g != range.end(); ++g)
+      {
+        m_sourceGroups[g]->construct_sequence_tree_internal();
+      }
+    });
+
+    for (std::size_t g = 0; g < numGroups; ++g)
+    {
+      Surface_mesh_shortest_path& group = *m_sourceGroups[g];
+      group.m_sharedDistances = nullptr;
+
+      // The roots are created in the order of the source points of the group
+      for (std::size_t i = 0; i < group.m_rootNodes.size(); ++i)
+      {
+        std::vector<Cone_tree_node*> stack(1, group.m_rootNodes[i].first);
+        while (!stack.empty())
+        {
+          Cone_tree_node* node = stack.back();
+          stack.pop_back();
+          node->set_tree_id(m_rootNodes.size());
+
+          if (node->get_left_child() != nullptr)
+          {
+            stack.push_back(node->get_left_child());
+          }
+
+          if (node->get_right_child() != nullptr)
+          {
+            stack.push_back(node->get_right_child());
+          }
+
+          for (std::size_t j = 0; j < node->num_middle_children(); ++j)
+          {
+            stack.push_back(node->get_middle_child(j));
+          }
+        }
+
+        m_rootNodes.emplace_back(group.m_rootNodes[i].first,
+                                 Source_point_iterator(sourcePoints[order[groupBegins[g] + i]]));
+      }
+
+      for (std::size_t i = 0; i < m_closestToVertices.size(); ++i)
+      {
+        if (is_closer(group.m_closestToVertices[i], m_closestToVertices[i]))
+        {
+          m_closestToVertices[i] = group.m_closestToVertices[i];
+        }
+      }
+
+      for (std::size_t i = 0; i < m_vertexOccupiers.size(); ++i)
+      {
+        if (is_closer(group.m_vertexOccupiers[i], m_vertexOccupiers[i]))
+        {
+          m_vertexOccupiers[i] = group.m_vertexOccupiers[i];
+        }
+      }
+
+      // only the nodes of the group are still used
+      std::vector<Node_distance_pair>().swap(group.m_closestToVertices);
+      std::vector<Node_distance_pair>().swap(group.m_vertexOccupiers);
+      std::vector<std::vector<Cone_tree_node*> >().swap(group.m_faceOccupiers);
     }
 
+    build_face_occupiers();
+
     m_firstNewSourcePoint = m_faceLocations.end();
     m_deletedSourceLocations.clear();
-
+    m_builtMaxDistance = m_maxDistance;
   }
+#endif
 
 public:
 
@@ -2465,6 +2767,39 @@ public:
     }
   }
 
+  /*!
+  \brief Computes all pending changes to the internal sequence tree, possibly in parallel.
+
+  \details With `Parallel_tag`, the source points are split into groups of nearby points, one per thread,
+  whose sequence trees are built concurrently and then merged. The expansion of each tree is pruned with
+  the distances found by the other trees. The distances found are the same as the ones found by
+  `build_sequence_tree()`, up to rounding errors when `FT` is not exact.
+
+  \tparam ConcurrencyTag enables sequential versus parallel algorithm. Possible values are `Sequential_tag`,
+                         `Parallel_tag`, and `Parallel_if_available_tag`.
+  */
+  template <class ConcurrencyTag>
+  void build_sequence_tree()
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert(!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                  "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      const std::size_t numGroups = (std::min)(number_of_source_points(),
+                                               std::size_t(tbb::this_task_arena::max_concurrency()));
+      if (changed_since_last_build() && numGroups > 1)
+      {
+        construct_sequence_tree_in_parallel(numGroups);
+        return;
+      }
+    }
+#endif
+
+    build_sequence_tree();
+  }
+
   /*!
   \brief removes all data, the class is as if it was constructed.
 
@@ -2479,6 +2814,43 @@ public:
 
   /// @}
 
+  /// \name Bounded Expansion
+  /// @{
+
+  /*!
+  \brief bounds the expansion of the sequence tree to the points at distance at most `d` from the source points.
+
+  \details The sequence tree is then only built in the neighborhoods of the source points, which is much faster
+  when `d` is small with respect to the size of the input face graph. The points farther than `d` from
+  all source points are considered unreachable by the queries.
+
+  No change to the internal shortest paths data structure occurs
+  until either `Surface_mesh_shortest_path::build_sequence_tree()` or
+  the first shortest path query is done.
+  */
+  void set_maximum_distance(const FT d)
+  {
+    m_maxDistance = d;
+  }
+
+  /*!
+  \brief removes the bound on the expansion of the sequence tree set by `set_maximum_distance()`.
+  */
+  void clear_maximum_distance()
+  {
+    m_maxDistance = std::nullopt;
+  }
+
+  /*!
+  \brief returns the bound on the expansion of the sequence tree, if any.
+  */
+  const std::optional<FT>& maximum_distance() const
+  {
+    return m_maxDistance;
+  }
+
+  /// @}
+
   /// \name Accessors
   /// @{
 
@@ -2518,13 +2890,14 @@ public:
   }
 
   /*!
-  \brief determines if the internal sequence tree is valid (already built and no new source point has been added).
+  \brief determines if the internal sequence tree is valid (already built, and neither the source points nor the maximum distance changed).
 
   \return true if the structure needs to be rebuilt, false otherwise
   */
   bool changed_since_last_build() const
   {
-    return m_firstNewSourcePoint != m_faceLocations.end() || !m_deletedSourceLocations.empty();
+    return m_firstNewSourcePoint != m_faceLocations.end() || !m_deletedSourceLocations.empty() ||
+           m_maxDistance != m_builtMaxDistance;
   }
 
   /// @}
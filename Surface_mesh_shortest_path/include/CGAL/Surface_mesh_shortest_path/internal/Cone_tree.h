@@ -152,6 +152,11 @@ public:
     return m_treeId;
   }
 
+  void set_tree_id(const std::size_t treeId)
+  {
+    m_treeId = treeId;
+  }
+
   std::size_t level() const
   {
     return m_level;
@@ -0,0 +1,182 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Surface_mesh_shortest_path.h>
+#include <CGAL/Random.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+#endif
+
+#include <cassert>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+
+typedef CGAL::Surface_mesh<Kernel::Point_3> Triangle_mesh;
+
+typedef CGAL::Surface_mesh_shortest_path_traits<Kernel, Triangle_mesh> Traits;
+typedef CGAL::Surface_mesh_shortest_path<Traits> Surface_mesh_shortest_path;
+typedef Surface_mesh_shortest_path::Face_location Face_location;
+
+typedef boost::graph_traits<Triangle_mesh>::vertex_descriptor vertex_descriptor;
+typedef boost::graph_traits<Triangle_mesh>::face_descriptor face_descriptor;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+bool same_distance(double d1, double d2)
+{
+  return std::abs(d1 - d2) <= 1e-7 * (std::max)(1., std::abs(d1));
+}
+
+Face_location random_face_location(const Triangle_mesh& mesh, CGAL::Random& rnd)
+{
+  const face_descriptor f(rnd.get_int(0, static_cast<int>(num_faces(mesh))));
+  const double a = rnd.get_double(), b = rnd.get_double(0., 1. - a);
+  Surface_mesh_shortest_path::Barycentric_coordinates bc = {{ a, b, 1. - a - b }};
+  return Face_location(f, bc);
+}
+
+void test_parallel_build(const Triangle_mesh& mesh, CGAL::Random& rnd)
+{
+  std::vector<Face_location> sources, queries;
+  for (int i = 0; i < 12; ++i)
+    sources.push_back(random_face_location(mesh, rnd));
+  for (int i = 0; i < 100; ++i)
+    queries.push_back(random_face_location(mesh, rnd));
+
+  Surface_mesh_shortest_path seq_paths(mesh), par_paths(mesh);
+  seq_paths.add_source_points(sources.begin(), sources.end());
+  par_paths.add_source_points(sources.begin(), sources.end());
+  // a vertex source
+  seq_paths.add_source_point(*vertices(mesh).begin());
+  par_paths.add_source_point(*vertices(mesh).begin());
+
+  seq_paths.build_sequence_tree();
+  par_paths.build_sequence_tree<Concurrency_tag>();
+  assert(par_paths.number_of_source_points() == 13);
+
+  for (vertex_descriptor v : vertices(mesh))
+  {
+    const double d = par_paths.shortest_distance_to_source_points(v).first;
+    assert(same_distance(seq_paths.shortest_distance_to_source_points(v).first, d));
+    assert(d >= 0.);
+  }
+  for (const Face_location& q : queries)
+  {
+    const Surface_mesh_shortest_path::Shortest_path_result res =
+      par_paths.shortest_distance_to_source_points(q.first, q.second);
+    assert(same_distance(seq_paths.shortest_distance_to_source_points(q.first, q.second).first, res.first));
+
+    // the source point is the one at the end of the path
+    std::vector<Kernel::Point_3> points;
+    par_paths.shortest_path_points_to_source_points(q.first, q.second, std::back_inserter(points));
+    assert(!points.empty());
+    assert(CGAL::squared_distance(points.back(), par_paths.point(res.second->first, res.second->second)) < 1e-10);
+  }
+
+  // incremental changes are also built in parallel
+  par_paths.remove_source_point(par_paths.source_points_begin());
+  seq_paths.remove_source_point(seq_paths.source_points_begin());
+  par_paths.build_sequence_tree<Concurrency_tag>();
+  for (vertex_descriptor v : vertices(mesh))
+    assert(same_distance(seq_paths.shortest_distance_to_source_points(v).first,
+                         par_paths.shortest_distance_to_source_points(v).first));
+  std::cout << "  " << par_paths.number_of_source_points() << " source points" << std::endl;
+}
+
+void test_maximum_distance(const Triangle_mesh& mesh, CGAL::Random& rnd)
+{
+  std::vector<Face_location> sources;
+  for (int i = 0; i < 4; ++i)
+    sources.push_back(random_face_location(mesh, rnd));
+
+  Surface_mesh_shortest_path full_paths(mesh), bounded_paths(mesh), par_bounded_paths(mesh);
+  full_paths.add_source_points(sources.begin(), sources.end());
+  bounded_paths.add_source_points(sources.begin(), sources.end());
+  par_bounded_paths.add_source_points(sources.begin(), sources.end());
+
+  double max_distance = 0.;
+  for (vertex_descriptor v : vertices(mesh))
+    max_distance = (std::max)(max_distance, full_paths.shortest_distance_to_source_points(v).first);
+  const double radius = 0.2 * max_distance;
+
+  assert(!bounded_paths.maximum_distance());
+  bounded_paths.set_maximum_distance(radius);
+  par_bounded_paths.set_maximum_distance(radius);
+  assert(*bounded_paths.maximum_distance() == radius);
+
+  // a fresh object for the parallel build, as a second build of the same tree does nothing
+  bounded_paths.build_sequence_tree();
+  assert(par_bounded_paths.changed_since_last_build());
+  par_bounded_paths.build_sequence_tree<Concurrency_tag>();
+  assert(!par_bounded_paths.changed_since_last_build());
+
+  for (Surface_mesh_shortest_path* paths : { &bounded_paths, &par_bounded_paths })
+  {
+    std::size_t nb_reached = 0;
+    for (vertex_descriptor v : vertices(mesh))
+    {
+      const double d = full_paths.shortest_distance_to_source_points(v).first;
+      const double bounded_d = paths->shortest_distance_to_source_points(v).first;
+      if (d <= radius)
+      {
+        assert(same_distance(d, bounded_d));
+        ++nb_reached;
+      }
+      else
+      {
+        assert(bounded_d == -1.);
+      }
+    }
+    assert(nb_reached > 0 && nb_reached < num_vertices(mesh));
+    std::cout << "  " << nb_reached << " vertices within the maximum distance" << std::endl;
+  }
+
+  // removing the bound requires a new build
+  bounded_paths.clear_maximum_distance();
+  assert(!bounded_paths.maximum_distance());
+  assert(bounded_paths.changed_since_last_build());
+  for (vertex_descriptor v : vertices(mesh))
+    assert(same_distance(full_paths.shortest_distance_to_source_points(v).first,
+                         bounded_paths.shortest_distance_to_source_points(v).first));
+}
+
+void test(const Triangle_mesh& mesh)
+{
+  CGAL::Random rnd(0);
+  std::cout << "== parallel build" << std::endl;
+  test_parallel_build(mesh, rnd);
+  std::cout << "== maximum distance" << std::endl;
+  test_maximum_distance(mesh, rnd);
+}
+
+int main()
+{
+  Triangle_mesh mesh;
+  std::ifstream input(CGAL::data_file_path("meshes/elephant.off"));
+  input >> mesh;
+  assert(!is_empty(mesh));
+  std::cout << "Input mesh: " << num_vertices(mesh) << " nv" << std::endl;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // build the sequence trees with several threads, whatever the number of cores
+  tbb::global_control c(tbb::global_control::max_allowed_parallelism, 4);
+  tbb::task_arena arena(4);
+  arena.execute([&]{ test(mesh); });
+#else
+  test(mesh);
+#endif
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -7,6 +7,8 @@ namespace Surface_mesh_simplification {
 Simplifies `tmesh` in-place by collapsing edges, and returns
 the number of edges effectively removed.
 
+@tparam ConcurrencyTag enables sequential versus parallel algorithm.
+                       Possible values are `Sequential_tag` (the default), `Parallel_if_available_tag`, and `Parallel_tag`.
 @tparam TriangleMesh a model of the `MutableFaceGraph` and `HalfedgeListGraph` concepts.
 @tparam StopPolicy a model of `StopPredicate`
 @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
@@ -109,8 +111,18 @@ and the remaining vertex is re-positioned.
 
 `visitor` is used to keep track of the simplification process. It has several member functions which
 are called at certain points in the simplification code.
+
+With `Parallel_tag`, the edges are processed by batches: edges are extracted from the priority queue
+in cost order as long as their neighborhoods are disjoint from the ones of the edges already in the batch.
+The costs, placements, validity tests and filters of the edges of a batch are then evaluated concurrently,
+after what the edges are collapsed in cost order. `should_stop` is evaluated before each collapse,
+and the visitor is only called from the calling thread. Since an edge whose cost decreased because
+of a collapse in the batch can only be collapsed in a later batch, the result may slightly differ
+from the sequential algorithm. The cost, placement and filter policies must support
+concurrent calls to their `operator()`.
 */
-template<class TriangleMesh, class StopPolicy, class NamedParameters = parameters::Default_named_parameters>
+template<class ConcurrencyTag = Sequential_tag,
+         class TriangleMesh, class StopPolicy, class NamedParameters = parameters::Default_named_parameters>
 int edge_collapse(TriangleMesh& tmesh,
                   const StopPolicy& should_stop,
                   const NamedParameters& np = parameters::default_values());
@@ -19,10 +19,19 @@
 #include <CGAL/boost/graph/Euler_operations.h>
 #include <CGAL/boost/graph/helpers.h>
 #include <CGAL/Modifiable_priority_queue.h>
+#include <CGAL/tags.h>
 #include <CGAL/use.h>
 
 #include <boost/scoped_array.hpp>
 
+#include <type_traits>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#  include <tbb/blocked_range.h>
+#  include <tbb/parallel_for.h>
+#endif
+
 namespace CGAL {
 namespace Surface_mesh_simplification {
 namespace internal {
@@ -91,7 +100,8 @@ template<class TM_,
          class GetPlacement_,
          class ShouldIgnore_,
          class VisitorT_,
-         bool use_relaxed_heap>
+         bool use_relaxed_heap,
+         class ConcurrencyTag_ = Sequential_tag>
 class EdgeCollapse
 {
   typedef EdgeCollapse                                                    Self;
@@ -108,6 +118,7 @@ public:
   typedef GetPlacement_                                                   Get_placement;
   typedef ShouldStop_                                                     Should_stop;
   typedef VisitorT_                                                       Visitor;
+  typedef ConcurrencyTag_                                                 Concurrency_tag;
 
   typedef Edge_profile<Triangle_mesh, Vertex_point_map, Geom_traits>      Profile;
 
@@ -223,13 +234,16 @@ public:
 private:
   void collect();
   void loop();
+  void loop_in_batches();
 
   bool is_collapse_topologically_valid(const Profile& profile);
   bool is_tetrahedron(const halfedge_descriptor h);
   bool is_open_triangle(const halfedge_descriptor h1);
   bool is_collapse_geometrically_valid(const Profile& profile, Placement_type placement);
   void collapse(const Profile& profile, Placement_type placement);
+  vertex_descriptor collapse_without_update(const Profile& profile, Placement_type placement);
   void update_neighbors(const vertex_descriptor v_kept);
+  void update_neighbors(const std::vector<vertex_descriptor>& vertices_kept);
 
   Profile create_profile(const halfedge_descriptor h) {
     return Profile(h, m_tm, m_traits, m_vim, m_vpm, m_him, m_has_border);
@@ -375,6 +389,35 @@ private:
     return false;
   }
 
+  // Batched collapses (parallel mode)
+  //
+  // The edges of a batch are popped from the PQ in cost order, and an edge is only accepted
+  // if its star (the two vertices and their neighbors) does not intersect the star of an edge
+  // already accepted in the batch. The validity tests, placement and filter of an edge only read
+  // the faces incident to its star, and a collapse only modifies the faces incident to the edge
+  // vertices, so the candidates of a batch can be evaluated concurrently and collapsed in turn.
+  enum Batch_candidate_status
+  {
+    TOPOLOGICALLY_INVALID = 0,
+    GEOMETRICALLY_INVALID,
+    FILTERED_OUT,
+    COLLAPSIBLE
+  };
+
+  struct Batch_candidate
+  {
+    Batch_candidate(const halfedge_descriptor h) : h(h), status(TOPOLOGICALLY_INVALID) { }
+
+    halfedge_descriptor h;
+    Placement_type placement;
+    Batch_candidate_status status;
+  };
+
+  static constexpr std::size_t collapse_batch_size = 1024;
+
+  bool mark_star(const halfedge_descriptor h);
+  void evaluate(Batch_candidate& candidate);
+
 private:
   Triangle_mesh& m_tm;
   const Geom_traits& m_traits;
@@ -400,11 +443,15 @@ private:
 
   FT m_max_dihedral_angle_squared_cos;
 
+  // batch in which a vertex was last marked, indexed by vertex index
+  std::vector<std::size_t> m_star_stamps;
+  std::size_t m_current_stamp;
+
   CGAL_SMS_DEBUG_CODE(unsigned m_step;)
 };
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 EdgeCollapse(Triangle_mesh& tmesh,
              const Geom_traits& traits,
              const Should_stop& should_stop,
@@ -428,7 +475,8 @@ EdgeCollapse(Triangle_mesh& tmesh,
     m_get_placement(get_placement),
     m_should_ignore(should_ignore),
     m_visitor(visitor),
-    m_has_border(!is_closed(tmesh))
+    m_has_border(!is_closed(tmesh)),
+    m_current_stamp(0)
 {
   m_max_dihedral_angle_squared_cos = CGAL::square(std::cos(1.0 * CGAL_PI / 180.0));
 
@@ -445,13 +493,18 @@ EdgeCollapse(Triangle_mesh& tmesh,
 #endif
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 int
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 run()
 {
   CGAL_expensive_precondition(is_valid_polygon_mesh(m_tm) && CGAL::is_triangle_mesh(m_tm));
 
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!(std::is_convertible<Concurrency_tag, Parallel_tag>::value),
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
   m_visitor.OnStarted(m_tm);
 
   // this is similar to the visitor, but for the cost/stop/placement oracles
@@ -461,7 +514,12 @@ run()
   collect();
 
   // Then proceed to collapse each edge in turn
-  loop();
+#ifdef CGAL_LINKED_WITH_TBB
+  if(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+    loop_in_batches();
+  else
+#endif
+    loop();
 
   CGAL_SMS_TRACE(0, "Finished: " << (m_initial_edge_count - m_current_edge_count) << " edges removed.");
 
@@ -472,9 +530,9 @@ run()
   return r;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 collect()
 {
   CGAL_SMS_TRACE(0, "collecting edges...");
@@ -492,6 +550,40 @@ collect()
 
   std::set<halfedge_descriptor> zero_length_edges;
 
+  const bool costs_precomputed = std::is_convertible<Concurrency_tag, Parallel_tag>::value;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  if(costs_precomputed)
+  {
+    std::vector<halfedge_descriptor> hs;
+    hs.reserve(m_initial_edge_count);
+    for(edge_descriptor e : edges(m_tm))
+    {
+      const halfedge_descriptor h = halfedge(e, m_tm);
+      if(!is_constrained(h))
+        hs.push_back(h);
+    }
+
+    auto compute_cost = [&](const halfedge_descriptor h)
+    {
+      const Profile profile = create_profile(h);
+      if(!m_traits.equal_3_object()(profile.p0(), profile.p1()))
+        get_data(h).cost() = cost(profile);
+    };
+
+    // the first evaluation is sequential so that the policies can lazily initialize themselves
+    if(!hs.empty())
+      compute_cost(hs.front());
+
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(1, (std::max)(hs.size(), std::size_t(1))),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                          compute_cost(hs[i]);
+                      });
+  }
+#endif
+
   for(edge_descriptor e : edges(m_tm))
   {
     const halfedge_descriptor h = halfedge(e, m_tm);
@@ -507,7 +599,8 @@ collect()
     {
       Edge_data& data = get_data(h);
 
-      data.cost() = cost(profile);
+      if(!costs_precomputed)
+        data.cost() = cost(profile);
       insert_in_PQ(h, data);
 
       m_visitor.OnCollected(profile, data.cost());
@@ -581,9 +674,9 @@ collect()
   CGAL_SMS_TRACE(0, "Initial edge count: " << m_initial_edge_count);
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 loop()
 {
   CGAL_SMS_TRACE(0, "Collapsing edges...");
@@ -670,9 +763,201 @@ loop()
   }
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+bool
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+mark_star(const halfedge_descriptor h)
+{
+  const vertex_descriptor vs[2] = { source(h, m_tm), target(h, m_tm) };
+
+  for(const vertex_descriptor v : vs)
+    for(halfedge_descriptor hv : halfedges_around_target(v, m_tm))
+      if(m_star_stamps[get(m_vim, source(hv, m_tm))] == m_current_stamp)
+        return false;
+
+  for(const vertex_descriptor v : vs)
+    for(halfedge_descriptor hv : halfedges_around_target(v, m_tm))
+      m_star_stamps[get(m_vim, source(hv, m_tm))] = m_current_stamp;
+
+  return true;
+}
+
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+void
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+evaluate(Batch_candidate& candidate)
+{
+  const Profile profile = create_profile(candidate.h);
+
+  if(!is_collapse_topologically_valid(profile))
+  {
+    candidate.status = TOPOLOGICALLY_INVALID;
+    return;
+  }
+
+  candidate.placement = get_placement(profile);
+
+  if(!is_collapse_geometrically_valid(profile, candidate.placement))
+    candidate.status = GEOMETRICALLY_INVALID;
+  else if(m_should_ignore(profile, candidate.placement) != std::nullopt)
+    candidate.status = COLLAPSIBLE;
+  else
+    candidate.status = FILTERED_OUT;
+}
+
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+void
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+loop_in_batches()
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  CGAL_SMS_TRACE(0, "Collapsing edges in batches...");
+
+  std::size_t max_vertex_id = 0;
+  for(vertex_descriptor v : vertices(m_tm))
+    max_vertex_id = (std::max)(max_vertex_id, std::size_t(get(m_vim, v)));
+  m_star_stamps.assign(max_vertex_id + 1, 0);
+
+  std::vector<Batch_candidate> candidates;
+  std::vector<halfedge_descriptor> postponed;
+  std::vector<vertex_descriptor> vertices_kept;
+
+  bool first_evaluation = true;
+
+  for(;;)
+  {
+    candidates.clear();
+    postponed.clear();
+    ++m_current_stamp;
+
+    // (A) pop, in cost order, edges whose stars are pairwise disjoint
+    std::optional<halfedge_descriptor> opt_h;
+    while(candidates.size() < collapse_batch_size &&
+          postponed.size() < collapse_batch_size &&
+          (opt_h = pop_from_PQ()))
+    {
+      CGAL_assertion(!is_constrained(*opt_h));
+
+      if(!get_data(*opt_h).cost())
+      {
+        m_visitor.OnSelected(create_profile(*opt_h), get_data(*opt_h).cost(),
+                             m_initial_edge_count, m_current_edge_count);
+        CGAL_SMS_TRACE(1, edge_to_string(*opt_h) << " uncomputable cost." );
+        continue;
+      }
+
+      if(mark_star(*opt_h))
+        candidates.push_back(Batch_candidate(*opt_h));
+      else
+        postponed.push_back(*opt_h);
+    }
+
+    if(candidates.empty())
+      break;
+
+    // postponed edges go back in the PQ before any collapse, so that they are
+    // removed from it if the collapse of a candidate deletes them
+    for(halfedge_descriptor h : postponed)
+      insert_in_PQ(h, get_data(h));
+
+    // (B) evaluate the candidates concurrently
+    std::size_t first_parallel = 0;
+    if(first_evaluation)
+    {
+      // sequential, so that the policies can lazily initialize themselves
+      evaluate(candidates.front());
+      first_parallel = 1;
+      first_evaluation = false;
+    }
+
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(first_parallel, (std::max)(first_parallel, candidates.size())),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                          evaluate(candidates[i]);
+                      });
+
+    // (C) collapse in cost order, checking the stop condition before each collapse
+    vertices_kept.clear();
+    bool stop = false;
+    for(std::size_t i=0; i<candidates.size(); ++i)
+    {
+      const Batch_candidate& candidate = candidates[i];
+      const Profile profile = create_profile(candidate.h);
+      const Cost_type& cost = get_data(candidate.h).cost();
+
+      // a postponed edge can be cheaper than the candidate: the sequential loop
+      // would evaluate the stop condition on it first
+      if(!mPQ->empty())
+      {
+        const halfedge_descriptor top = mPQ->top();
+        const Cost_type& top_cost = get_data(top).cost();
+        if(top_cost && *top_cost < *cost)
+        {
+          const Profile top_profile = create_profile(top);
+          if(m_should_stop(*top_cost, top_profile, m_initial_edge_count, m_current_edge_count))
+          {
+            m_visitor.OnSelected(top_profile, top_cost, m_initial_edge_count, m_current_edge_count);
+            m_visitor.OnStopConditionReached(top_profile);
+
+            CGAL_SMS_TRACE(0, "Stop condition reached with initial edge count=" << m_initial_edge_count
+                                << " current edge count=" << m_current_edge_count
+                                << " current edge: " << edge_to_string(top));
+            stop = true;
+            break;
+          }
+
+          // the candidate would stop, but not the cheaper edge: the remaining candidates
+          // go back in the PQ and the next batch starts with the cheaper edge
+          if(m_should_stop(*cost, profile, m_initial_edge_count, m_current_edge_count))
+          {
+            for(std::size_t j=i; j<candidates.size(); ++j)
+              insert_in_PQ(candidates[j].h, get_data(candidates[j].h));
+            break;
+          }
+        }
+      }
+
+      m_visitor.OnSelected(profile, cost, m_initial_edge_count, m_current_edge_count);
+
+      if(m_should_stop(*cost, profile, m_initial_edge_count, m_current_edge_count))
+      {
+        m_visitor.OnStopConditionReached(profile);
+
+        CGAL_SMS_TRACE(0, "Stop condition reached with initial edge count=" << m_initial_edge_count
+                            << " current edge count=" << m_current_edge_count
+                            << " current edge: " << edge_to_string(candidate.h));
+        stop = true;
+        break;
+      }
+
+      switch(candidate.status)
+      {
+        case COLLAPSIBLE:
+          vertices_kept.push_back(collapse_without_update(profile, candidate.placement));
+          break;
+        case TOPOLOGICALLY_INVALID:
+        case FILTERED_OUT:
+          m_visitor.OnNonCollapsable(profile);
+          CGAL_SMS_TRACE(1, edge_to_string(candidate.h) << " NOT Collapsible" );
+          break;
+        case GEOMETRICALLY_INVALID:
+          break;
+      }
+    }
+
+    if(stop)
+      break;
+
+    // (D) update the costs of the edges around all the collapsed edges at once
+    update_neighbors(vertices_kept);
+  }
+#endif
+}
+
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_border_or_constrained(const vertex_descriptor v) const
 {
   for(halfedge_descriptor h : halfedges_around_target(v, m_tm))
@@ -684,9 +969,9 @@ is_border_or_constrained(const vertex_descriptor v) const
   return false;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_constrained(const vertex_descriptor v) const
 {
   for(halfedge_descriptor h : halfedges_around_target(v, m_tm))
@@ -705,9 +990,9 @@ is_constrained(const vertex_descriptor v) const
 // The link condition is as follows: for every vertex 'k' adjacent to both 'p and 'q',
 // "p,k,q" is a facet of the mesh.
 //
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-  EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+  EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_collapse_topologically_valid(const Profile& profile)
 {
   bool res = true;
@@ -873,17 +1158,17 @@ is_collapse_topologically_valid(const Profile& profile)
   return res;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_tetrahedron(const halfedge_descriptor h)
 {
   return CGAL::is_tetrahedron(h, m_tm);
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_open_triangle(const halfedge_descriptor h1)
 {
   bool res = false;
@@ -912,9 +1197,9 @@ is_open_triangle(const halfedge_descriptor h1)
 // respective areas is no greater than a max value and the internal
 // dihedral angle formed by their supporting planes is no greater than
 // a given threshold
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 are_shared_triangles_valid(const Point& p0, const Point& p1, const Point& p2, const Point& p3) const
 {
   bool res = false;
@@ -964,9 +1249,9 @@ are_shared_triangles_valid(const Point& p0, const Point& p1, const Point& p2, co
 }
 
 // Returns the directed halfedge connecting v0 to v1, if exists.
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::halfedge_descriptor
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::halfedge_descriptor
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 find_connection(const vertex_descriptor v0,
                 const vertex_descriptor v1) const
 {
@@ -981,9 +1266,9 @@ find_connection(const vertex_descriptor v0,
 
 // Given the edge 'e' around the link for the collapsinge edge "v0-v1", finds the vertex that makes a triangle adjacent to 'e' but exterior to the link (i.e not containing v0 nor v1)
 // If 'e' is a null handle OR 'e' is a border edge, there is no such triangle and a null handle is returned.
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::vertex_descriptor
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::vertex_descriptor
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 find_exterior_link_triangle_3rd_vertex(const halfedge_descriptor e,
                                        const vertex_descriptor v0,
                                        const vertex_descriptor v1) const
@@ -1017,9 +1302,9 @@ find_exterior_link_triangle_3rd_vertex(const halfedge_descriptor e,
 // A collapse is geometrically valid if, in the resulting local mesh no two adjacent triangles form an internal dihedral angle
 // greater than a fixed threshold (i.e. triangles do not "fold" into each other)
 //
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_collapse_geometrically_valid(const Profile& profile, Placement_type k0)
 {
   bool res = false;
@@ -1116,11 +1401,22 @@ is_collapse_geometrically_valid(const Profile& profile, Placement_type k0)
   return res;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 collapse(const Profile& profile,
          Placement_type placement)
+{
+  const vertex_descriptor v_res = collapse_without_update(profile, placement);
+
+  update_neighbors(v_res);
+}
+
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::vertex_descriptor
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+collapse_without_update(const Profile& profile,
+                        Placement_type placement)
 {
   CGAL_SMS_TRACE(1, "S" << m_step << ". Collapsing " << edge_to_string(profile.v0_v1()));
 
@@ -1214,14 +1510,14 @@ collapse(const Profile& profile,
   m_visitor.OnCollapsed(profile, v_res);
   internal::After_collapse_oracles_updater<Self>(*this)(profile, v_res);
 
-  update_neighbors(v_res);
-
   CGAL_SMS_DEBUG_CODE(++m_step;)
+
+  return v_res;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 update_neighbors(const vertex_descriptor v_kept)
 {
   CGAL_SMS_TRACE(3,"Updating cost of neighboring edges...");
@@ -1284,6 +1580,59 @@ update_neighbors(const vertex_descriptor v_kept)
   }
 }
 
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+void
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+update_neighbors(const std::vector<vertex_descriptor>& vertices_kept)
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  CGAL_SMS_TRACE(3,"Updating cost of edges around " << vertices_kept.size() << " vertices...");
+
+  // Same as the single vertex version, but the costs are computed concurrently.
+  typedef std::set<halfedge_descriptor, Compare_id>                       Edge_set;
+
+  Edge_set edges_to_update(Compare_id(this));
+  Edge_set edges_to_insert(Compare_id(this));
+
+  for(vertex_descriptor v_kept : vertices_kept)
+  {
+    for(halfedge_descriptor h : halfedges_around_target(v_kept, m_tm))
+    {
+      vertex_descriptor v_adj = source(h, m_tm);
+
+      for(halfedge_descriptor h2 : halfedges_around_target(v_adj, m_tm))
+      {
+        h2 = primary_edge(h2);
+
+        if(get_data(h2).is_in_PQ())
+          edges_to_update.insert(h2);
+        else if(!is_constrained(h2))
+          edges_to_insert.insert(h2);
+      }
+    }
+  }
+
+  std::vector<halfedge_descriptor> hs(edges_to_update.begin(), edges_to_update.end());
+  hs.insert(hs.end(), edges_to_insert.begin(), edges_to_insert.end());
+
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, hs.size()),
+                    [&](const tbb::blocked_range<std::size_t>& r)
+                    {
+                      for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                        get_data(hs[i]).cost() = cost(create_profile(hs[i]));
+                    });
+
+  for(halfedge_descriptor h : edges_to_update)
+    update_in_PQ(h, get_data(h));
+
+  for(halfedge_descriptor h : edges_to_insert)
+    insert_in_PQ(h, get_data(h));
+#else
+  for(vertex_descriptor v_kept : vertices_kept)
+    update_neighbors(v_kept);
+#endif
+}
+
 } // namespace Surface_mesh_simplification
 } // namespace CGAL
 
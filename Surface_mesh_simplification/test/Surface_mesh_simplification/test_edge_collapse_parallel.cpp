@@ -0,0 +1,195 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Surface_mesh_simplification/edge_collapse.h>
+#include <CGAL/Surface_mesh_simplification/Edge_collapse_visitor_base.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Bounded_distance_placement.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Bounded_normal_change_filter.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_count_ratio_stop_predicate.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_count_stop_predicate.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_length_cost.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_length_stop_predicate.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/LindstromTurk_cost.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/LindstromTurk_placement.h>
+
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/boost/graph/IO/polygon_mesh_io.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace SMS = CGAL::Surface_mesh_simplification;
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel     Kernel;
+typedef Kernel::Point_3                                         Point_3;
+typedef CGAL::Surface_mesh<Point_3>                             Surface;
+
+typedef boost::graph_traits<Surface>::edge_descriptor           edge_descriptor;
+
+typedef SMS::LindstromTurk_cost<Surface>                        Cost;
+typedef SMS::LindstromTurk_placement<Surface>                   Placement;
+typedef SMS::Bounded_distance_placement<Placement, Kernel>      Filtered_placement;
+
+struct Counting_visitor
+  : SMS::Edge_collapse_visitor_base<Surface>
+{
+  Counting_visitor(int& collapses, int& stops) : collapses(collapses), stops(stops) { }
+
+  void OnCollapsed(const Profile&, vertex_descriptor) { ++collapses; }
+  void OnStopConditionReached(const Profile&) { ++stops; }
+
+  int& collapses;
+  int& stops;
+};
+
+void read_mesh(const std::string& filename, Surface& mesh)
+{
+  if(!CGAL::IO::read_polygon_mesh(filename, mesh) || !CGAL::is_triangle_mesh(mesh))
+  {
+    std::cerr << "Error: cannot read " << filename << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+}
+
+template <typename ConcurrencyTag>
+void test_count_stop(const std::string& filename, bool target_reachable)
+{
+  std::cout << "== " << filename << std::endl;
+
+  Surface mesh;
+  read_mesh(filename, mesh);
+  const bool closed = CGAL::is_closed(mesh);
+
+  Surface seq_mesh = mesh;
+
+  const std::size_t target = num_edges(mesh) / 5;
+  SMS::Edge_count_stop_predicate<Surface> stop(target);
+
+  int collapses = 0, stops = 0, seq_collapses = 0, seq_stops = 0;
+  const int removed = SMS::edge_collapse<ConcurrencyTag>(mesh, stop,
+                                                         CGAL::parameters::visitor(Counting_visitor(collapses, stops)));
+  const int seq_removed = SMS::edge_collapse(seq_mesh, stop,
+                                             CGAL::parameters::visitor(Counting_visitor(seq_collapses, seq_stops)));
+
+  std::cout << removed << " edges removed (" << seq_removed << " sequentially)" << std::endl;
+
+  assert(CGAL::is_valid_polygon_mesh(mesh));
+  assert(CGAL::is_triangle_mesh(mesh));
+  assert(CGAL::is_closed(mesh) == closed);
+
+  assert(collapses <= removed);
+
+  // the stop predicate is honored exactly: it fires once the target is
+  // reached, and only then, as in the sequential version
+  assert(stops == seq_stops);
+  assert(stops == (target_reachable ? 1 : 0));
+  assert((edges(mesh).size() <= target) == target_reachable);
+  assert(removed == seq_removed);
+  assert(edges(mesh).size() == edges(seq_mesh).size());
+}
+
+std::size_t number_of_short_edges(const Surface& mesh, double length)
+{
+  std::size_t nb = 0;
+  for(edge_descriptor e : edges(mesh))
+    if(CGAL::squared_distance(mesh.point(source(e, mesh)), mesh.point(target(e, mesh))) <= length * length)
+      ++nb;
+  return nb;
+}
+
+// a stop predicate that does not depend on the edge count is not triggered
+// by an edge of a batch while a cheaper edge is still in the queue
+template <typename ConcurrencyTag>
+void test_length_stop(const std::string& filename)
+{
+  Surface mesh;
+  read_mesh(filename, mesh);
+
+  std::vector<double> lengths;
+  for(edge_descriptor e : edges(mesh))
+    lengths.push_back(CGAL::sqrt(CGAL::squared_distance(mesh.point(source(e, mesh)), mesh.point(target(e, mesh)))));
+  std::sort(lengths.begin(), lengths.end());
+  const double length = 2 * lengths[lengths.size() / 2];
+
+  Surface seq_mesh = mesh;
+  SMS::Edge_length_stop_predicate<double> stop(length);
+
+  const int removed = SMS::edge_collapse<ConcurrencyTag>(mesh, stop, CGAL::parameters::get_cost(SMS::Edge_length_cost<Surface>()));
+  const int seq_removed = SMS::edge_collapse(seq_mesh, stop, CGAL::parameters::get_cost(SMS::Edge_length_cost<Surface>()));
+
+  const std::size_t nb_short = number_of_short_edges(mesh, length);
+  const std::size_t seq_nb_short = number_of_short_edges(seq_mesh, length);
+  std::cout << removed << " edges removed (" << seq_removed << " sequentially), "
+            << nb_short << " edges shorter than " << length << " left (" << seq_nb_short << " sequentially)" << std::endl;
+
+  assert(CGAL::is_valid_polygon_mesh(mesh));
+  assert(CGAL::is_triangle_mesh(mesh));
+  assert(nb_short <= seq_nb_short + seq_nb_short / 10 + 10);
+}
+
+template <typename ConcurrencyTag>
+void test_policies(const std::string& filename)
+{
+  Surface mesh;
+  read_mesh(filename, mesh);
+
+  // lazily initialized placement, filter, and constrained edges
+  Surface::Property_map<edge_descriptor, bool> constrained_map =
+    mesh.add_property_map<edge_descriptor, bool>("e:constrained", false).first;
+
+  std::size_t nb_constrained = 0;
+  for(edge_descriptor e : edges(mesh))
+  {
+    if(e.idx() % 7 == 0)
+    {
+      put(constrained_map, e, true);
+      ++nb_constrained;
+    }
+  }
+
+  SMS::Edge_count_ratio_stop_predicate<Surface> stop(0.2);
+  Filtered_placement placement(0.01, Placement());
+
+  SMS::edge_collapse<ConcurrencyTag>(mesh, stop,
+                                     CGAL::parameters::edge_is_constrained_map(constrained_map)
+                                                      .get_cost(Cost())
+                                                      .get_placement(placement)
+                                                      .filter(SMS::Bounded_normal_change_filter<>()));
+
+  assert(CGAL::is_valid_polygon_mesh(mesh));
+  assert(CGAL::is_triangle_mesh(mesh));
+
+  // constrained edges are never collapsed
+  std::size_t nb_constrained_after = 0;
+  for(edge_descriptor e : edges(mesh))
+    if(get(constrained_map, e))
+      ++nb_constrained_after;
+  assert(nb_constrained_after == nb_constrained);
+
+}
+
+int main(int argc, char** argv)
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+  typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+  const std::string filename = (argc > 1) ? argv[1] : "data/helmet.off";
+
+  test_count_stop<Concurrency_tag>(filename, true);
+  test_count_stop<Concurrency_tag>("data/genus1_null_edges.off", true);
+  // this mesh cannot be simplified down to the target
+  test_count_stop<Concurrency_tag>("data/square_open.off", false);
+  test_length_stop<Concurrency_tag>(filename);
+  test_policies<Concurrency_tag>(filename);
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -12,8 +12,13 @@ of the value of the `report_endpoints` flag). The value-type of
 `InputIterator` is a curve type and the value-type of `OutputIterator`
 is a point type. The output points are reported in an increasing
 \f$xy\f$-lexicographical order.
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+With `CGAL::Parallel_tag`, the plane is split into vertical slabs, which are
+swept concurrently, each with the curves that meet it; the output is the same.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+The default value is `Sequential_tag`.
 */
-template <class InputIterator, class OutputIterator>
+template <class ConcurrencyTag = Sequential_tag, class InputIterator, class OutputIterator>
 OutputIterator compute_intersection_points (InputIterator curves_begin,
                                             InputIterator curves_end,
                                             OutputIterator points,
@@ -31,8 +36,13 @@ must be a model of the `ArrangementTraits_2` concept, such that the
 value-type of `InputIterator` is `Traits::Curve_2`, and the
 value-type of `OutputIterator` is `Traits::Point_2`.
 The output points are reported in an increasing \f$ xy\f$-lexicographical order.
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+With `CGAL::Parallel_tag`, the plane is split into vertical slabs, which are
+swept concurrently, each with the curves that meet it; the output is the same.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+The default value is `Sequential_tag`.
 */
-template <class InputIterator, class OutputIterator, class Traits>
+template <class ConcurrencyTag = Sequential_tag, class InputIterator, class OutputIterator, class Traits>
 OutputIterator compute_intersection_points (InputIterator curves_begin,
                                             InputIterator curves_end,
                                             OutputIterator points,
@@ -49,8 +59,14 @@ represents an overlap of \f$ k\f$ input curves is reported \f$ k\f$ times; other
 each subcurve is reported only once.
 The value-type of `InputIterator` is a curve type, and the value-type of
 `OutputIterator` is an \f$x\f$-monotone curve type.
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+With `CGAL::Parallel_tag`, the plane is split into vertical slabs, which are
+swept concurrently, each with the curves that meet it, and the subcurves are
+reported curve by curve, in the order of the input curves.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+The default value is `Sequential_tag`.
 */
-template <class InputIterator, class OutputIterator>
+template <class ConcurrencyTag = Sequential_tag, class InputIterator, class OutputIterator>
 OutputIterator compute_subcurves (InputIterator curves_begin,
                                   InputIterator curves_end,
                                   OutputIterator subcurves,
@@ -67,8 +83,14 @@ each subcurve is reported only once. The `Traits` type must be a model
 of the `ArrangementTraits_2` concept, such that the value-type of
 `InputIterator` is `Traits::Curve_2`, and the value-type of
 `OutputIterator` is `Traits::X_monotone_curve_2`.
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+With `CGAL::Parallel_tag`, the plane is split into vertical slabs, which are
+swept concurrently, each with the curves that meet it, and the subcurves are
+reported curve by curve, in the order of the input curves.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+The default value is `Sequential_tag`.
 */
-template <class InputIterator, class OutputIterator, class Traits>
+template <class ConcurrencyTag = Sequential_tag, class InputIterator, class OutputIterator, class Traits>
 OutputIterator compute_subcurves (InputIterator curves_begin,
                                   InputIterator curves_end,
                                   OutputIterator subcurves,
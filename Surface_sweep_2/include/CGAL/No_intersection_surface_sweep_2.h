@@ -407,6 +407,13 @@ public:
   /*! Check if the event queue is empty. */
   bool is_event_queue_empty() const { return m_queue->empty(); }
 
+  /*! Get the index of a subcurve that is associated with an input curve,
+   * that is, the position of this curve in the input range.
+   * \pre sc does not represent an overlap.
+   */
+  std::size_t subcurve_index(const Subcurve* sc) const
+  { return static_cast<std::size_t>(sc - m_subCurves); }
+
   /*! Stop the sweep by erasing the event queue (except for the current event).
    * This function may called by the visitor during 'arter_handle_event' in
    * order to stop the sweep-line process.
@@ -0,0 +1,194 @@
+// Copyright (c) 2026 agent.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent
+
+#ifndef CGAL_SURFACE_SWEEP_2_SLAB_EVENTS_VISITOR_H
+#define CGAL_SURFACE_SWEEP_2_SLAB_EVENTS_VISITOR_H
+
+#include <CGAL/license/Surface_sweep_2.h>
+
+/*! \file
+ *
+ * Definition of a surface-sweep visitor that records the events that lie in
+ * a vertical slab.
+ */
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <CGAL/Surface_sweep_2/Default_visitor.h>
+
+namespace CGAL {
+namespace Surface_sweep_2 {
+
+/*! \class Slab_events_visitor
+ *
+ * A surface-sweep visitor that records the events that lie in a vertical
+ * slab, given by two points p and q, namely the events e such that
+ * p <= e < q in the xy-lexicographic order. A missing bound stands for an
+ * unbounded slab. For each event, the visitor records its point, if it is an
+ * intersection point (or if all points are required), and, on demand, the
+ * indices of the input curves that contain the point. The sweep is stopped at
+ * the first event that lies past the slab. Used by the parallel
+ * compute_intersection_points() and compute_subcurves(), which sweep each
+ * slab with the curves that meet it.
+ */
+template <typename GeometryTraits_2, typename Allocator_ = CGAL_ALLOCATOR(int)>
+class Slab_events_visitor :
+  public Default_visitor<Slab_events_visitor<GeometryTraits_2, Allocator_>,
+                         GeometryTraits_2, Allocator_>
+{
+public:
+  typedef GeometryTraits_2                              Geometry_traits_2;
+  typedef Allocator_                                    Allocator;
+
+private:
+  typedef Geometry_traits_2                             Gt2;
+  typedef Slab_events_visitor<Gt2, Allocator>           Self;
+  typedef Default_visitor<Self, Gt2, Allocator>         Base;
+
+public:
+  typedef typename Base::Event                          Event;
+  typedef typename Base::Subcurve                       Subcurve;
+
+  typedef typename Subcurve::Status_line_iterator       Status_line_iterator;
+
+  typedef typename Gt2::X_monotone_curve_2              X_monotone_curve_2;
+  typedef typename Gt2::Point_2                         Point_2;
+
+  typedef typename Base::Surface_sweep_2                Surface_sweep_2;
+
+  // An input curve (given by its index) that contains an event point.
+  typedef std::pair<std::size_t, Point_2>               Curve_event;
+
+protected:
+  // Data members:
+  const Point_2* m_min;                  // The slab bounds (or nullptr).
+  const Point_2* m_max;
+  bool m_includeEndPoints;               // Should we include endpoints.
+  bool m_record_curves;                  // Should we record the curves.
+  std::size_t m_nb_events;               // The number of handled events.
+
+  std::vector<Point_2> m_points;         // The recorded points.
+  std::vector<Curve_event> m_curve_events;
+                                         // The recorded curves of the events.
+  std::vector<std::size_t> m_overlapping_curves;
+                                         // The curves that overlap others.
+  std::vector<Subcurve*> m_leaves;       // A buffer for the incident curves.
+  std::vector<std::size_t> m_indices;    // A buffer for their indices.
+
+public:
+  Slab_events_visitor(const Point_2* min, const Point_2* max,
+                      bool endpoints, bool record_curves) :
+    m_min(min),
+    m_max(max),
+    m_includeEndPoints(endpoints),
+    m_record_curves(record_curves),
+    m_nb_events(0)
+  {}
+
+  bool after_handle_event(Event* event,
+                          Status_line_iterator /* iter */,
+                          bool /* flag */)
+  {
+    ++m_nb_events;
+    if (! event->is_closed()) return true;
+
+    // The events are handled in xy-lexicographic order, so the remaining
+    // ones are past the slab as well.
+    if (is_past_slab(event->point())) {
+      this->surface_sweep()->stop_sweep();
+      return true;
+    }
+    if (! is_in_slab(event->point())) return true;
+
+    if (m_includeEndPoints ||
+        event->is_intersection() ||
+        event->is_weak_intersection())
+      m_points.push_back(event->point());
+
+    if (! m_record_curves) return true;
+
+    // A curve that goes through the event is both to its left and to its
+    // right, so it is reported once.
+    m_leaves.clear();
+    for (auto it = event->left_curves_begin(); it != event->left_curves_end();
+         ++it)
+      (*it)->all_leaves(std::back_inserter(m_leaves));
+    for (auto it = event->right_curves_begin();
+         it != event->right_curves_end(); ++it)
+      (*it)->all_leaves(std::back_inserter(m_leaves));
+
+    m_indices.clear();
+    for (Subcurve* sc : m_leaves)
+      m_indices.push_back(this->surface_sweep()->subcurve_index(sc));
+    std::sort(m_indices.begin(), m_indices.end());
+    m_indices.erase(std::unique(m_indices.begin(), m_indices.end()),
+                    m_indices.end());
+
+    for (std::size_t index : m_indices)
+      m_curve_events.push_back(Curve_event(index, event->point()));
+    return true;
+  }
+
+  void found_overlap(Subcurve* /* sc1 */,
+                     Subcurve* /* sc2 */,
+                     Subcurve* ov_sc)
+  {
+    if (! m_record_curves) return;
+
+    m_leaves.clear();
+    ov_sc->all_leaves(std::back_inserter(m_leaves));
+    for (Subcurve* sc : m_leaves)
+      m_overlapping_curves.push_back(this->surface_sweep()->subcurve_index(sc));
+  }
+
+  /*! Obtain the recorded points, in xy-lexicographic order. */
+  const std::vector<Point_2>& points() const { return m_points; }
+
+  /*! Obtain the recorded pairs of curve indices and points, in the
+   * xy-lexicographic order of the points.
+   */
+  std::vector<Curve_event>& curve_events() { return m_curve_events; }
+
+  const std::vector<Curve_event>& curve_events() const
+  { return m_curve_events; }
+
+  /*! Obtain the indices of the curves that overlap other curves. */
+  std::vector<std::size_t>& overlapping_curves()
+  { return m_overlapping_curves; }
+
+  const std::vector<std::size_t>& overlapping_curves() const
+  { return m_overlapping_curves; }
+
+  /*! Obtain the number of events handled by the sweep. */
+  std::size_t number_of_events() const { return m_nb_events; }
+
+protected:
+  bool is_in_slab(const Point_2& pt)
+  {
+    auto compare_xy = this->traits()->compare_xy_2_object();
+    return ((m_min == nullptr) || (compare_xy(pt, *m_min) != SMALLER)) &&
+      ((m_max == nullptr) || (compare_xy(pt, *m_max) == SMALLER));
+  }
+
+  bool is_past_slab(const Point_2& pt)
+  {
+    auto compare_xy = this->traits()->compare_xy_2_object();
+    return (m_max != nullptr) && (compare_xy(pt, *m_max) == LARGER);
+  }
+};
+
+} // namespace Surface_sweep_2
+} // namespace CGAL
+
+#endif
@@ -0,0 +1,301 @@
+// Copyright (c) 2026 agent.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent
+
+#ifndef CGAL_SURFACE_SWEEP_2_SLAB_SURFACE_SWEEP_2_H
+#define CGAL_SURFACE_SWEEP_2_SLAB_SURFACE_SWEEP_2_H
+
+#include <CGAL/license/Surface_sweep_2.h>
+
+/*! \file
+ *
+ * Utilities that sweep a set of x-monotone curves in vertical slabs,
+ * concurrently, and split the curves at the events found by the slab sweeps.
+ */
+
+#include <CGAL/Surface_sweep_2.h>
+#include <CGAL/Surface_sweep_2/Slab_events_visitor.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/task_arena.h>
+#endif
+
+namespace CGAL {
+namespace Surface_sweep_2 {
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+/*! Sweep the given x-monotone curves and isolated points in vertical slabs,
+ * concurrently. The slab bounds are chosen among the left endpoints of the
+ * curves, such that the slabs have about the same number of curves. Each slab
+ * is swept with the curves whose x-range meets the (closed) slab, which
+ * contain all the curves that go through the events of the slab, and the
+ * visitor of the slab records these events only. The curve indices recorded
+ * by the visitors refer to the input range.
+ * \return false (and sweep nothing) if there are too few curves to make the
+ *         slabs worth it.
+ */
+template <typename Traits>
+bool slab_sweep(const std::vector<typename Traits::X_monotone_curve_2>& xcurves,
+                const std::vector<typename Traits::Point_2>& iso_points,
+                bool report_endpoints, bool record_curves, const Traits& tr,
+                std::vector<typename Traits::Point_2>& bounds,
+                std::vector<Slab_events_visitor<Traits> >& visitors)
+{
+  typedef typename Traits::X_monotone_curve_2           X_monotone_curve_2;
+  typedef typename Traits::Point_2                      Point_2;
+  typedef Slab_events_visitor<Traits>                   Visitor;
+  typedef Surface_sweep_2<Visitor>                      Surface_sweep;
+
+  // minimal number of curves per slab, below which the slab sweeps cost
+  // more than they save
+  const std::size_t min_slab_size = 1024;
+
+  const std::size_t nb_slabs =
+    (std::min)(std::size_t(4 * tbb::this_task_arena::max_concurrency()),
+               xcurves.size() / min_slab_size);
+  if (nb_slabs < 2) return false;
+
+  auto compare_x = tr.compare_x_2_object();
+  auto compare_xy = tr.compare_xy_2_object();
+  auto min_vertex = tr.construct_min_vertex_2_object();
+  auto max_vertex = tr.construct_max_vertex_2_object();
+
+  // Pick the bounds among a sample of the left endpoints.
+  std::vector<Point_2> sample;
+  const std::size_t step = (std::max)(std::size_t(1),
+                                      xcurves.size() / (64 * nb_slabs));
+  for (std::size_t i = 0; i < xcurves.size(); i += step)
+    sample.push_back(min_vertex(xcurves[i]));
+  std::sort(sample.begin(), sample.end(),
+            [&](const Point_2& p, const Point_2& q)
+            { return compare_xy(p, q) == SMALLER; });
+
+  bounds.clear();
+  for (std::size_t i = 1; i < nb_slabs; ++i) {
+    const Point_2& p = sample[i * sample.size() / nb_slabs];
+    if (bounds.empty() || (compare_xy(bounds.back(), p) == SMALLER))
+      bounds.push_back(p);
+  }
+  if (bounds.empty()) return false;
+
+  // The slab i lies between bounds[i-1] and bounds[i]. Find the range of
+  // slabs met by each curve.
+  std::vector<std::pair<std::size_t, std::size_t> > ranges(xcurves.size());
+  tbb::parallel_for(std::size_t(0), xcurves.size(), [&](std::size_t i)
+  {
+    const Point_2& min = min_vertex(xcurves[i]);
+    const Point_2& max = max_vertex(xcurves[i]);
+    ranges[i].first = std::partition_point(bounds.begin(), bounds.end(),
+                                           [&](const Point_2& p)
+                                           { return compare_x(p, min) == SMALLER; }) -
+      bounds.begin();
+    ranges[i].second = std::partition_point(bounds.begin(), bounds.end(),
+                                            [&](const Point_2& p)
+                                            { return compare_x(p, max) != LARGER; }) -
+      bounds.begin();
+  });
+
+  std::vector<std::vector<std::size_t> > slab_curves(bounds.size() + 1);
+  for (std::size_t i = 0; i < xcurves.size(); ++i)
+    for (std::size_t j = ranges[i].first; j <= ranges[i].second; ++j)
+      slab_curves[j].push_back(i);
+
+  visitors.clear();
+  visitors.reserve(slab_curves.size());
+  for (std::size_t i = 0; i < slab_curves.size(); ++i)
+    visitors.push_back(Visitor((i == 0) ? nullptr : &bounds[i - 1],
+                               (i == bounds.size()) ? nullptr : &bounds[i],
+                               report_endpoints, record_curves));
+
+  tbb::parallel_for(std::size_t(0), slab_curves.size(), [&](std::size_t i)
+  {
+    std::vector<X_monotone_curve_2> slab_xcurves;
+    slab_xcurves.reserve(slab_curves[i].size());
+    for (std::size_t index : slab_curves[i])
+      slab_xcurves.push_back(xcurves[index]);
+
+    std::vector<Point_2> slab_iso_points;
+    for (const Point_2& pt : iso_points)
+      if (((i == 0) || (compare_x(pt, bounds[i - 1]) != SMALLER)) &&
+          ((i == bounds.size()) || (compare_x(pt, bounds[i]) != LARGER)))
+        slab_iso_points.push_back(pt);
+
+    Surface_sweep surface_sweep(&tr, &visitors[i]);
+    surface_sweep.sweep(slab_xcurves.begin(), slab_xcurves.end(),
+                        slab_iso_points.begin(), slab_iso_points.end());
+
+    // Map the indices of the slab curves to the input indices.
+    for (auto& curve_event : visitors[i].curve_events())
+      curve_event.first = slab_curves[i][curve_event.first];
+    for (std::size_t& index : visitors[i].overlapping_curves())
+      index = slab_curves[i][index];
+  });
+
+  return true;
+}
+
+/*! Split the x-monotone curves, concurrently, at the events recorded (with
+ * their curves) by slab_sweep() in their interiors.
+ * The subcurves of the i-th curve are stored, from left to right, in
+ * pieces[first[i]], ..., pieces[first[i+1]-1].
+ */
+template <typename Traits>
+void split_at_slab_events(const std::vector<typename Traits::X_monotone_curve_2>& xcurves,
+                          const std::vector<Slab_events_visitor<Traits> >& visitors,
+                          const Traits& tr,
+                          std::vector<typename Traits::X_monotone_curve_2>& pieces,
+                          std::vector<std::size_t>& first)
+{
+  typedef typename Traits::X_monotone_curve_2           X_monotone_curve_2;
+  typedef typename Traits::Point_2                      Point_2;
+
+  // Gather the events of each curve. The slabs are ordered, so the events of
+  // a curve are sorted along it.
+  std::vector<std::size_t> offsets(xcurves.size() + 1, 0);
+  for (const auto& visitor : visitors)
+    for (const auto& curve_event : visitor.curve_events())
+      ++offsets[curve_event.first + 1];
+  for (std::size_t i = 0; i < xcurves.size(); ++i)
+    offsets[i + 1] += offsets[i];
+
+  std::vector<const Point_2*> events(offsets.back());
+  {
+    std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+    for (const auto& visitor : visitors)
+      for (const auto& curve_event : visitor.curve_events())
+        events[next[curve_event.first]++] = &curve_event.second;
+  }
+
+  auto compare_xy = tr.compare_xy_2_object();
+  auto min_vertex = tr.construct_min_vertex_2_object();
+  auto max_vertex = tr.construct_max_vertex_2_object();
+  auto split = tr.split_2_object();
+
+  // The i-th curve has at most one more subcurve than events, so its
+  // subcurves are first stored from offsets[i] + i on.
+  std::vector<X_monotone_curve_2> slots(offsets.back() + xcurves.size());
+  first.assign(xcurves.size() + 1, 0);
+  tbb::parallel_for(std::size_t(0), xcurves.size(), [&](std::size_t i)
+  {
+    const std::size_t slot = offsets[i] + i;
+    std::size_t nb_pieces = 0;
+    X_monotone_curve_2 xcv = xcurves[i];
+    for (std::size_t j = offsets[i]; j < offsets[i + 1]; ++j) {
+      if ((compare_xy(*events[j], min_vertex(xcv)) != LARGER) ||
+          (compare_xy(*events[j], max_vertex(xcv)) != SMALLER))
+        continue;
+      X_monotone_curve_2 right;
+      split(xcv, *events[j], slots[slot + nb_pieces++], right);
+      xcv = right;
+    }
+    slots[slot + nb_pieces++] = xcv;
+    first[i + 1] = nb_pieces;
+  });
+
+  for (std::size_t i = 0; i < xcurves.size(); ++i)
+    first[i + 1] += first[i];
+
+  pieces.resize(first.back());
+  tbb::parallel_for(std::size_t(0), xcurves.size(), [&](std::size_t i)
+  {
+    std::copy(slots.begin() + offsets[i] + i,
+              slots.begin() + offsets[i] + i + (first[i + 1] - first[i]),
+              pieces.begin() + first[i]);
+  });
+}
+
+/*! Find the subcurves obtained by split_at_slab_events() that an overlap
+ * made identical.
+ * \param same Output: same[j] is the smallest index of a subcurve that is
+ *             identical to pieces[j] (j itself if there is none).
+ */
+template <typename Traits>
+void find_identical_pieces(const std::vector<typename Traits::X_monotone_curve_2>& pieces,
+                           const std::vector<std::size_t>& first,
+                           const std::vector<Slab_events_visitor<Traits> >& visitors,
+                           const Traits& tr,
+                           std::vector<std::size_t>& same)
+{
+  typedef typename Traits::Point_2                      Point_2;
+
+  auto compare_xy = tr.compare_xy_2_object();
+  auto min_vertex = tr.construct_min_vertex_2_object();
+  auto max_vertex = tr.construct_max_vertex_2_object();
+  auto equal = tr.equal_2_object();
+
+  same.resize(pieces.size());
+  for (std::size_t j = 0; j < pieces.size(); ++j) same[j] = j;
+
+  // Only the subcurves of the overlapping curves may be identical.
+  std::vector<bool> overlapping(first.size() - 1, false);
+  for (const auto& visitor : visitors)
+    for (std::size_t index : visitor.overlapping_curves())
+      overlapping[index] = true;
+
+  std::vector<std::size_t> candidates;
+  for (std::size_t i = 0; i + 1 < first.size(); ++i)
+    if (overlapping[i])
+      for (std::size_t j = first[i]; j < first[i + 1]; ++j)
+        candidates.push_back(j);
+
+  // Sort the candidates by their endpoints, which are constructed once.
+  std::vector<std::pair<Point_2, Point_2> > ends(candidates.size());
+  tbb::parallel_for(std::size_t(0), candidates.size(), [&](std::size_t i)
+  {
+    ends[i].first = min_vertex(pieces[candidates[i]]);
+    ends[i].second = max_vertex(pieces[candidates[i]]);
+  });
+
+  auto compare_ends = [&](std::size_t a, std::size_t b)
+  {
+    Comparison_result res = compare_xy(ends[a].first, ends[b].first);
+    if (res == EQUAL) res = compare_xy(ends[a].second, ends[b].second);
+    return res;
+  };
+  std::vector<std::size_t> order(candidates.size());
+  for (std::size_t i = 0; i < order.size(); ++i) order[i] = i;
+  tbb::parallel_sort(order.begin(), order.end(),
+                     [&](std::size_t a, std::size_t b)
+                     {
+                       const Comparison_result res = compare_ends(a, b);
+                       return (res == SMALLER) || ((res == EQUAL) && (a < b));
+                     });
+
+  for (std::size_t i = 0; i < order.size(); ) {
+    std::size_t end = i + 1;
+    while ((end < order.size()) && (compare_ends(order[i], order[end]) == EQUAL))
+      ++end;
+    for (std::size_t j = i + 1; j < end; ++j) {
+      const std::size_t piece = candidates[order[j]];
+      for (std::size_t k = i; k < j; ++k) {
+        const std::size_t other = candidates[order[k]];
+        if ((same[other] == other) && equal(pieces[other], pieces[piece])) {
+          same[piece] = other;
+          break;
+        }
+      }
+    }
+    i = end;
+  }
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+} // namespace Surface_sweep_2
+} // namespace CGAL
+
+#endif
@@ -26,6 +26,9 @@
 #include <CGAL/Surface_sweep_2/Intersection_points_visitor.h>
 #include <CGAL/Surface_sweep_2/Subcurves_visitor.h>
 #include <CGAL/Surface_sweep_2/Do_interior_intersect_visitor.h>
+#include <CGAL/Surface_sweep_2/Slab_surface_sweep_2.h>
+#include <CGAL/Arr_tags.h>
+#include <CGAL/tags.h>
 
 #include <CGAL/Segment_2.h>
 #include <CGAL/Arr_segment_traits_2.h>
@@ -34,6 +37,10 @@
 #include <CGAL/Arr_circle_segment_traits_2.h>
 #include <CGAL/Arr_linear_traits_2.h>
 
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
 namespace CGAL {
 
 namespace Ss2 = Surface_sweep_2;
@@ -96,6 +103,122 @@ struct Default_arr_traits<CGAL::Arr_linear_object_2<Kernel> >
   typedef CGAL::Arr_linear_traits_2<Kernel>                             Traits;
 };
 
+#ifdef CGAL_LINKED_WITH_TBB
+namespace internal {
+
+template <typename OutputIterator, typename Traits>
+OutputIterator
+parallel_compute_intersection_points(const std::vector<typename Traits::X_monotone_curve_2>& xcurves,
+                                     const std::vector<typename Traits::Point_2>& iso_points,
+                                     OutputIterator points,
+                                     bool report_endpoints, Traits& tr,
+                                     Arr_all_sides_oblivious_tag)
+{
+  typedef typename Traits::Point_2                      Point_2;
+
+  std::vector<Point_2> bounds;
+  std::vector<Ss2::Slab_events_visitor<Traits> > visitors;
+  if (! Ss2::slab_sweep(xcurves, iso_points, report_endpoints, false, tr,
+                        bounds, visitors))
+    return parallel_compute_intersection_points(xcurves, iso_points, points,
+                                                report_endpoints, tr,
+                                                Arr_not_all_sides_oblivious_tag());
+
+  // The slabs are ordered, so are the points.
+  for (const auto& visitor : visitors)
+    for (const Point_2& pt : visitor.points())
+      *points++ = pt;
+  return points;
+}
+
+// With unbounded curves or on a surface, the curves are swept at once.
+template <typename OutputIterator, typename Traits>
+OutputIterator
+parallel_compute_intersection_points(const std::vector<typename Traits::X_monotone_curve_2>& xcurves,
+                                     const std::vector<typename Traits::Point_2>& iso_points,
+                                     OutputIterator points,
+                                     bool report_endpoints, Traits& tr,
+                                     Arr_not_all_sides_oblivious_tag)
+{
+  typedef Ss2::Intersection_points_visitor<Traits, OutputIterator>
+                                                                Visitor;
+  typedef Ss2::Surface_sweep_2<Visitor>                         Surface_sweep;
+
+  Visitor visitor(points, report_endpoints);
+  Surface_sweep surface_sweep(&tr, &visitor);
+  surface_sweep.sweep(xcurves.begin(), xcurves.end(),
+                      iso_points.begin(), iso_points.end());
+  return visitor.output_iterator();
+}
+
+template <typename OutputIterator, typename Traits>
+OutputIterator
+parallel_compute_subcurves(const std::vector<typename Traits::X_monotone_curve_2>& xcurves,
+                           const std::vector<typename Traits::Point_2>& iso_points,
+                           OutputIterator subcurves,
+                           bool mult_overlaps, Traits& tr,
+                           Arr_all_sides_oblivious_tag)
+{
+  typedef typename Traits::X_monotone_curve_2           X_monotone_curve_2;
+  typedef typename Traits::Point_2                      Point_2;
+
+  std::vector<Point_2> bounds;
+  std::vector<Ss2::Slab_events_visitor<Traits> > visitors;
+  if (! Ss2::slab_sweep(xcurves, iso_points, false, true, tr,
+                        bounds, visitors))
+    return parallel_compute_subcurves(xcurves, iso_points, subcurves,
+                                      mult_overlaps, tr,
+                                      Arr_not_all_sides_oblivious_tag());
+
+  std::vector<X_monotone_curve_2> pieces;
+  std::vector<std::size_t> first;
+  Ss2::split_at_slab_events(xcurves, visitors, tr, pieces, first);
+
+  // Unless overlaps are reported once per curve, keep the first of the
+  // pieces that an overlap made identical.
+  if (mult_overlaps) return std::copy(pieces.begin(), pieces.end(), subcurves);
+
+  std::vector<std::size_t> same;
+  Ss2::find_identical_pieces(pieces, first, visitors, tr, same);
+  for (std::size_t j = 0; j < pieces.size(); ++j)
+    if (same[j] == j) *subcurves++ = pieces[j];
+  return subcurves;
+}
+
+// With unbounded curves or on a surface, the curves are swept at once.
+template <typename OutputIterator, typename Traits>
+OutputIterator
+parallel_compute_subcurves(const std::vector<typename Traits::X_monotone_curve_2>& xcurves,
+                           const std::vector<typename Traits::Point_2>& iso_points,
+                           OutputIterator subcurves,
+                           bool mult_overlaps, Traits& tr,
+                           Arr_not_all_sides_oblivious_tag)
+{
+  typedef Ss2::Subcurves_visitor<Traits, OutputIterator>        Visitor;
+  typedef Ss2::Surface_sweep_2<Visitor>                         Surface_sweep;
+
+  Visitor visitor(subcurves, mult_overlaps);
+  Surface_sweep surface_sweep(&tr, &visitor);
+  surface_sweep.sweep(xcurves.begin(), xcurves.end(),
+                      iso_points.begin(), iso_points.end());
+  return visitor.output_iterator();
+}
+
+template <typename Traits>
+struct Slab_sweep_category
+{
+  typedef Arr_traits_basic_adaptor_2<Traits>            Traits_adaptor_2;
+
+  typedef typename Arr_all_sides_oblivious_category<
+    typename Traits_adaptor_2::Left_side_category,
+    typename Traits_adaptor_2::Bottom_side_category,
+    typename Traits_adaptor_2::Top_side_category,
+    typename Traits_adaptor_2::Right_side_category>::result     type;
+};
+
+} // namespace internal
+#endif
+
 /*! Compute all intersection points induced by a range of input curves.
  * The intersections are calculated using the surface-sweep algorithm.
  * \param begin An input iterator for the first curve in the range.
@@ -106,14 +229,35 @@ struct Default_arr_traits<CGAL::Arr_linear_object_2<Kernel> >
  *                         reported as intersection points.
  * \pre The value-type of CurveInputIterator is Traits::Curve_2, and the
  *      value-type of OutputIterator is Traits::Point_2.
+ * \tparam ConcurrencyTag If `Parallel_tag`, the plane is split into vertical
+ *      slabs, which are swept concurrently.
  */
-template <typename CurveInputIterator, typename OutputIterator, typename Traits>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename CurveInputIterator, typename OutputIterator, typename Traits>
 OutputIterator compute_intersection_points(CurveInputIterator curves_begin,
                                            CurveInputIterator curves_end,
                                            OutputIterator points,
                                            bool report_endpoints,
                                            Traits &tr)
 {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                "Parallel_tag is enabled but TBB is unavailable.");
+#else
+  if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+    std::vector<typename Traits::X_monotone_curve_2> xcurves;
+    std::vector<typename Traits::Point_2> iso_points;
+    Ss2::make_x_monotone(curves_begin, curves_end,
+                         std::back_inserter(xcurves),
+                         std::back_inserter(iso_points), &tr);
+    typedef typename internal::Slab_sweep_category<Traits>::type Category;
+    return internal::parallel_compute_intersection_points(xcurves, iso_points,
+                                                          points,
+                                                          report_endpoints,
+                                                          tr, Category());
+  }
+#endif
+
   // Define the surface-sweep types:
   typedef Ss2::Intersection_points_visitor<Traits, OutputIterator>
                                                                 Visitor;
@@ -127,7 +271,8 @@ OutputIterator compute_intersection_points(CurveInputIterator curves_begin,
   return visitor.output_iterator();
 }
 
-template <typename CurveInputIterator, typename OutputIterator>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename CurveInputIterator, typename OutputIterator>
 OutputIterator compute_intersection_points(CurveInputIterator curves_begin,
                                            CurveInputIterator curves_end,
                                            OutputIterator points,
@@ -137,8 +282,9 @@ OutputIterator compute_intersection_points(CurveInputIterator curves_begin,
 
   typename Default_arr_traits<Curve>::Traits   traits;
 
-  return compute_intersection_points(curves_begin, curves_end, points,
-                                     report_endpoints, traits);
+  return compute_intersection_points<ConcurrencyTag>(curves_begin, curves_end,
+                                                     points, report_endpoints,
+                                                     traits);
 }
 
 /*! Compute all x-monotone subcurves that are disjoint in their interiors
@@ -151,13 +297,33 @@ OutputIterator compute_intersection_points(CurveInputIterator curves_begin,
  *                      multiple times.
  * \pre The value-type of CurveInputIterator is Traits::Curve_2, and the
  *      value-type of OutputIterator is Traits::X_monotone_curve_2.
+ * \tparam ConcurrencyTag If `Parallel_tag`, the plane is split into vertical
+ *      slabs, which are swept concurrently, and the subcurves are reported
+ *      curve by curve, in the order of the input curves.
  */
-template <typename CurveInputIterator, typename OutputIterator, typename Traits>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename CurveInputIterator, typename OutputIterator, typename Traits>
 OutputIterator compute_subcurves(CurveInputIterator curves_begin,
                                  CurveInputIterator curves_end,
                                  OutputIterator subcurves,
                                  bool mult_overlaps, Traits& tr)
 {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                "Parallel_tag is enabled but TBB is unavailable.");
+#else
+  if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+    std::vector<typename Traits::X_monotone_curve_2> xcurves;
+    std::vector<typename Traits::Point_2> iso_points;
+    Ss2::make_x_monotone(curves_begin, curves_end,
+                         std::back_inserter(xcurves),
+                         std::back_inserter(iso_points), &tr);
+    typedef typename internal::Slab_sweep_category<Traits>::type Category;
+    return internal::parallel_compute_subcurves(xcurves, iso_points, subcurves,
+                                                mult_overlaps, tr, Category());
+  }
+#endif
+
   // Define the surface-sweep types:
   typedef Ss2::Subcurves_visitor<Traits, OutputIterator>        Visitor;
   typedef Ss2::Surface_sweep_2<Visitor>                         Surface_sweep;
@@ -170,7 +336,8 @@ OutputIterator compute_subcurves(CurveInputIterator curves_begin,
   return visitor.output_iterator();
 }
 
-template <typename CurveInputIterator, typename OutputIterator>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename CurveInputIterator, typename OutputIterator>
 OutputIterator compute_subcurves(CurveInputIterator curves_begin,
                                  CurveInputIterator curves_end,
                                  OutputIterator subcurves,
@@ -178,8 +345,8 @@ OutputIterator compute_subcurves(CurveInputIterator curves_begin,
 {
   typedef typename std::iterator_traits<CurveInputIterator>::value_type  Curve;
   typename Default_arr_traits<Curve>::Traits m_traits;
-  return compute_subcurves(curves_begin, curves_end, subcurves, mult_overlaps,
-                           m_traits);
+  return compute_subcurves<ConcurrencyTag>(curves_begin, curves_end, subcurves,
+                                           mult_overlaps, m_traits);
 }
 
 /*! Determine if there occurs an intersection between any pair of curves in
@@ -0,0 +1,192 @@
+#include <CGAL/config.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Surface_sweep_2_algorithms.h>
+#include <CGAL/Surface_sweep_2/Slab_events_visitor.h>
+#include <CGAL/Random.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+#endif
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel     Kernel;
+typedef Kernel::Point_2                                       Point_2;
+typedef CGAL::Arr_segment_traits_2<Kernel>                    Traits;
+typedef Traits::Curve_2                                       Segment_2;
+typedef Traits::X_monotone_curve_2                            X_monotone_curve_2;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+// Short segments, with shared endpoints, vertical segments, and a few
+// overlaps of two segments.
+std::list<Segment_2> random_segments(CGAL::Random& rnd, int n)
+{
+  std::list<Segment_2> segments;
+  for (int i = 0; i < n; ++i) {
+    const Point_2 p(rnd.get_int(0, 1000), rnd.get_int(0, 1000));
+    Point_2 q(p.x() + rnd.get_int(-20, 20), p.y() + rnd.get_int(-20, 20));
+    if (i % 50 == 0)
+      q = Point_2(p.x(), p.y() + rnd.get_int(1, 20));
+    if (p == q)
+      continue;
+    segments.push_back(Segment_2(p, q));
+    if (i % 100 == 1)
+      segments.push_back(Segment_2(CGAL::midpoint(p, q), q + (q - p)));
+    if (i % 100 == 2)
+      segments.push_back(Segment_2(q, q + Kernel::Vector_2(7, 3)));
+  }
+  return segments;
+}
+
+bool less_xcv(const X_monotone_curve_2& c1, const X_monotone_curve_2& c2)
+{
+  Traits traits;
+  CGAL::Comparison_result res =
+    traits.compare_xy_2_object()(c1.left(), c2.left());
+  if (res == CGAL::EQUAL)
+    res = traits.compare_xy_2_object()(c1.right(), c2.right());
+  return res == CGAL::SMALLER;
+}
+
+void test_intersection_points(const std::list<Segment_2>& segments,
+                              bool report_endpoints)
+{
+  std::vector<Point_2> seq_points, par_points;
+  CGAL::compute_intersection_points(segments.begin(), segments.end(),
+                                    std::back_inserter(seq_points),
+                                    report_endpoints);
+  CGAL::compute_intersection_points<Concurrency_tag>(segments.begin(),
+                                                     segments.end(),
+                                                     std::back_inserter(par_points),
+                                                     report_endpoints);
+
+  std::cout << "  " << par_points.size() << " points ("
+            << seq_points.size() << " sequentially)" << std::endl;
+
+  // same points, in the same order
+  assert(par_points == seq_points);
+}
+
+void test_subcurves(const std::list<Segment_2>& segments, bool mult_overlaps)
+{
+  std::vector<X_monotone_curve_2> seq_curves, par_curves;
+  CGAL::compute_subcurves(segments.begin(), segments.end(),
+                          std::back_inserter(seq_curves), mult_overlaps);
+  CGAL::compute_subcurves<Concurrency_tag>(segments.begin(), segments.end(),
+                                           std::back_inserter(par_curves),
+                                           mult_overlaps);
+
+  std::cout << "  " << par_curves.size() << " subcurves ("
+            << seq_curves.size() << " sequentially)" << std::endl;
+
+  // same subcurves, possibly in another order
+  assert(par_curves.size() == seq_curves.size());
+  std::sort(seq_curves.begin(), seq_curves.end(), less_xcv);
+  std::sort(par_curves.begin(), par_curves.end(), less_xcv);
+  Traits traits;
+  for (std::size_t i = 0; i < seq_curves.size(); ++i)
+    assert(traits.equal_2_object()(par_curves[i], seq_curves[i]));
+}
+
+// The sweep of a slab stops at the first event past the slab.
+void test_slab_events(const std::list<Segment_2>& segments)
+{
+  typedef CGAL::Surface_sweep_2::Slab_events_visitor<Traits>  Visitor;
+  typedef CGAL::Surface_sweep_2::Surface_sweep_2<Visitor>     Surface_sweep;
+
+  // all the event points, in xy-lexicographic order
+  std::vector<Point_2> points;
+  CGAL::compute_intersection_points(segments.begin(), segments.end(),
+                                    std::back_inserter(points), true);
+
+  std::vector<X_monotone_curve_2> xcurves;
+  CGAL::compute_subcurves(segments.begin(), segments.end(),
+                          std::back_inserter(xcurves));
+
+  const std::size_t nb_slabs = 4;
+  std::vector<std::size_t> bounds;
+  for (std::size_t i = 1; i < nb_slabs; ++i)
+    bounds.push_back(i * points.size() / nb_slabs);
+
+  Traits traits;
+  for (std::size_t i = 0; i < nb_slabs; ++i) {
+    const std::size_t min = (i == 0) ? 0 : bounds[i - 1];
+    const std::size_t max = (i + 1 == nb_slabs) ? points.size() : bounds[i];
+    Visitor visitor((i == 0) ? nullptr : &points[min],
+                    (i + 1 == nb_slabs) ? nullptr : &points[max],
+                    true, false);
+    Surface_sweep surface_sweep(&traits, &visitor);
+    surface_sweep.sweep(xcurves.begin(), xcurves.end());
+
+    // the events before the slab, the events of the slab, the event at the
+    // upper bound, and the first event past it
+    const std::size_t expected =
+      (i + 1 == nb_slabs) ? points.size() : (std::min)(max + 2, points.size());
+    std::cout << "  slab " << i << ": " << visitor.number_of_events()
+              << " events (" << points.size() << " in total)" << std::endl;
+    assert(visitor.number_of_events() == expected);
+    assert(std::equal(visitor.points().begin(), visitor.points().end(),
+                      points.begin() + min, points.begin() + max) &&
+           (visitor.points().size() == max - min));
+  }
+}
+
+void test(CGAL::Random& rnd)
+{
+  std::cout << "== few curves" << std::endl;
+  const std::list<Segment_2> few_segments = random_segments(rnd, 100);
+  test_intersection_points(few_segments, false);
+  test_subcurves(few_segments, false);
+
+  std::cout << "== many curves" << std::endl;
+  const std::list<Segment_2> segments = random_segments(rnd, 10000);
+  test_intersection_points(segments, false);
+  test_intersection_points(segments, true);
+  test_subcurves(segments, false);
+  test_subcurves(segments, true);
+  test_slab_events(segments);
+
+  // The parallel functions must agree with do_curves_intersect()
+  std::list<Segment_2> disjoint_segments;
+  for (int i = 0; i < 5000; ++i)
+    disjoint_segments.push_back(Segment_2(Point_2(i % 13, i), Point_2(100 + i % 7, i)));
+  std::cout << "== disjoint curves" << std::endl;
+  assert(! CGAL::do_curves_intersect(disjoint_segments.begin(),
+                                     disjoint_segments.end()));
+  std::vector<Point_2> points;
+  CGAL::compute_intersection_points<Concurrency_tag>(disjoint_segments.begin(),
+                                                     disjoint_segments.end(),
+                                                     std::back_inserter(points));
+  assert(points.empty());
+  test_subcurves(disjoint_segments, false);
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // use several slabs and threads, whatever the number of cores
+  tbb::global_control c(tbb::global_control::max_allowed_parallelism, 8);
+  tbb::task_arena arena(8);
+  arena.execute([&]{ test(rnd); });
+#else
+  test(rnd);
+#endif
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -155,6 +155,25 @@ template < class PointInputIterator >
 std::ptrdiff_t
 insert(PointInputIterator first, PointInputIterator last);
 
+/*!
+inserts the points in the range `[first,last)`, possibly in parallel.
+Returns the number of inserted points.
+The points are spatially sorted and dispatched into several lanes; the conflict
+zones of the next point of each lane are computed concurrently, and the zones that
+do not share any vertex are then retriangulated.
+The result is a Delaunay triangulation of the same points as the one obtained with
+the sequential insertion. When four or more points are cocircular, the two
+triangulations may differ, since the triangulation of such points depends on the
+insertion order.
+
+\tparam ConcurrencyTag enables sequential versus parallel insertion.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+\tparam PointInputIterator must be an input iterator with the value type `Point`.
+*/
+template < class ConcurrencyTag, class PointInputIterator >
+std::ptrdiff_t
+insert(PointInputIterator first, PointInputIterator last);
+
 /*!
 inserts the points in the iterator range `[first,last)`. Returns the number of inserted points.
 Note that this function is not guaranteed to insert the points
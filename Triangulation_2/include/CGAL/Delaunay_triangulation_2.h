@@ -19,6 +19,17 @@
 #include <CGAL/Triangulation_2.h>
 #include <CGAL/iterator.h>
 #include <CGAL/Object.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <numeric>
+#include <unordered_set>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/parallel_for.h>
+# include <tbb/task_arena.h>
+#endif
 
 #ifndef CGAL_TRIANGULATION_2_DONT_INSERT_RANGE_OF_POINTS_WITH_INFO
 #include <CGAL/Spatial_sort_traits_adapter_2.h>
@@ -324,6 +335,191 @@ public:
     return this->number_of_vertices() - n;
   }
 
+  // Inserts the range of points using the concurrency policy `ConcurrencyTag`.
+  //
+  // With `Parallel_tag`, the spatially sorted points are split into lanes of
+  // consecutive points, and the lanes are processed in rounds. In each round, the
+  // location and the conflict zone of the next point of every lane are computed in
+  // parallel, which is where most of the time is spent. The points are then inserted
+  // sequentially by starring their zone, unless their zone shares a vertex with the zone
+  // of a point already inserted during the round, in which case they are postponed to
+  // the next round. Inserting a point p does not modify the conflict zone of a point
+  // whose zone shares no vertex with the zone of p, since the circumscribing disk of a
+  // new face is covered by the disks of the two faces sharing its edge opposite to p
+  // before the insertion. The result is thus a Delaunay triangulation of the points,
+  // which is the one obtained by a sequential insertion unless four or more points are
+  // cocircular: the triangulation of such points depends on the insertion order.
+  // The geometric traits must be safe to use concurrently, which is the case of
+  // `Exact_predicates_inexact_constructions_kernel`.
+  template < class ConcurrencyTag, class InputIterator >
+  std::ptrdiff_t
+  insert(InputIterator first, InputIterator last,
+         std::enable_if_t<
+           std::is_convertible<
+             typename std::iterator_traits<InputIterator>::value_type,
+             Point
+           >::value &&
+           std::is_convertible<ConcurrencyTag, Sequential_tag>::value
+         >* = nullptr)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+    return insert(first, last);
+#else
+    if(!std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+      return insert(first, last);
+
+    size_type n = this->number_of_vertices();
+    std::vector<Point> points (first, last);
+    spatial_sort<Parallel_tag> (points.begin(), points.end(), geom_traits());
+    parallel_insert_sorted_points(points);
+    return this->number_of_vertices() - n;
+#endif
+  }
+
+private:
+#ifdef CGAL_LINKED_WITH_TBB
+  // Conflict zone of a point, computed concurrently in `parallel_insert_sorted_points()`
+  struct Parallel_insertion_zone
+  {
+    Locate_type lt;
+    Face_handle fh;
+    int li;
+    // the vertex at the point if `lt == VERTEX`: unlike `fh`, it is still valid
+    // once the zones of other lanes have been starred, since insertions remove no vertex
+    Vertex_handle vertex;
+    std::vector<Face_handle> faces;
+    std::vector<Edge> boundary_edges;
+    // false if the point must be inserted with `insert()`: the zone contains
+    // infinite faces, or the point is outside the convex hull
+    bool can_be_starred;
+  };
+
+  void compute_parallel_insertion_zone(const Point& p,
+                                       Vertex_handle hint,
+                                       Parallel_insertion_zone& zone) const
+  {
+    zone.faces.clear();
+    zone.boundary_edges.clear();
+    zone.can_be_starred = false;
+    zone.fh = this->locate(p, zone.lt, zone.li,
+                           (hint == Vertex_handle()) ? Face_handle() : hint->face());
+    zone.vertex = (zone.lt == Triangulation::VERTEX) ? zone.fh->vertex(zone.li) : Vertex_handle();
+    if(zone.lt != Triangulation::FACE && zone.lt != Triangulation::EDGE)
+      return;
+
+    zone.faces.push_back(zone.fh);
+    auto pit = std::make_pair(std::back_inserter(zone.faces),
+                              std::back_inserter(zone.boundary_edges));
+    pit = propagate_conflicts(p, zone.fh, 0, pit);
+    pit = propagate_conflicts(p, zone.fh, 1, pit);
+    pit = propagate_conflicts(p, zone.fh, 2, pit);
+
+    for(Face_handle f : zone.faces)
+      if(this->is_infinite(f))
+        return;
+    zone.can_be_starred = true;
+  }
+
+  void parallel_insert_sorted_points(const std::vector<Point>& points)
+  {
+    const std::size_t nb_points = points.size();
+    const std::size_t nb_lanes =
+      8 * static_cast<std::size_t>(tbb::this_task_arena::max_concurrency());
+
+    // Insert the first points sequentially, until the triangulation is large
+    // enough for the zones of the lanes to be mostly independent
+    const std::size_t nb_sequential_points = (std::min)(nb_points, 64 * nb_lanes);
+    Face_handle f;
+    std::size_t i = 0;
+    for(; i<nb_sequential_points || (i<nb_points && this->dimension() < 2); ++i)
+      f = insert(points[i], f)->face();
+
+    if(i == nb_points)
+      return;
+
+    // lane `l` inserts the points [lane_begin[l], lane_end[l][
+    const std::size_t lane_size = (nb_points - i + nb_lanes - 1) / nb_lanes;
+    std::vector<std::size_t> lane_begin, lane_end;
+    std::vector<Vertex_handle> lane_hint;
+    for(std::size_t b=i; b<nb_points; b+=lane_size)
+    {
+      lane_begin.push_back(b);
+      lane_end.push_back((std::min)(b + lane_size, nb_points));
+      lane_hint.push_back(f->vertex(0));
+    }
+
+    std::vector<Parallel_insertion_zone> zones(lane_begin.size());
+    std::vector<std::size_t> active_lanes(lane_begin.size());
+    std::iota(active_lanes.begin(), active_lanes.end(), std::size_t(0));
+    std::unordered_set<Vertex_handle> marked_vertices;
+
+    while(active_lanes.size() > 1)
+    {
+      tbb::parallel_for(std::size_t(0), active_lanes.size(), [&](std::size_t k)
+      {
+        const std::size_t l = active_lanes[k];
+        compute_parallel_insertion_zone(points[lane_begin[l]], lane_hint[l], zones[l]);
+      });
+
+      marked_vertices.clear();
+      for(std::size_t l : active_lanes)
+      {
+        Parallel_insertion_zone& zone = zones[l];
+        const Point& p = points[lane_begin[l]];
+
+        if(zone.lt == Triangulation::VERTEX)
+        {
+          lane_hint[l] = zone.vertex;
+        }
+        else if(!zone.can_be_starred)
+        {
+          // the zone is unknown, and thus cannot be marked: the other zones of this
+          // round would no longer be valid, so this is only done for the first lane
+          if(!marked_vertices.empty())
+            continue;
+          lane_hint[l] = insert(p, zone.lt, zone.fh, zone.li);
+          ++lane_begin[l];
+          break;
+        }
+        else
+        {
+          bool is_free = true;
+          for(Face_handle fh : zone.faces)
+            for(int j=0; j<3 && is_free; ++j)
+              is_free = (marked_vertices.count(fh->vertex(j)) == 0);
+          if(!is_free)
+            continue; // postponed to the next round
+
+          for(Face_handle fh : zone.faces)
+            for(int j=0; j<3; ++j)
+              marked_vertices.insert(fh->vertex(j));
+
+          lane_hint[l] = this->star_hole(p,
+                                         zone.boundary_edges.begin(), zone.boundary_edges.end(),
+                                         zone.faces.begin(), zone.faces.end());
+        }
+        ++lane_begin[l];
+      }
+
+      active_lanes.erase(std::remove_if(active_lanes.begin(), active_lanes.end(),
+                                        [&](std::size_t l){ return lane_begin[l] == lane_end[l]; }),
+                         active_lanes.end());
+    }
+
+    // finish the last lane sequentially
+    for(std::size_t l : active_lanes)
+    {
+      Face_handle hint = lane_hint[l]->face();
+      for(std::size_t j=lane_begin[l]; j<lane_end[l]; ++j)
+        hint = insert(points[j], hint)->face();
+    }
+  }
+#endif // CGAL_LINKED_WITH_TBB
+
+public:
+
 #ifndef CGAL_TRIANGULATION_2_DONT_INSERT_RANGE_OF_POINTS_WITH_INFO
 
 private:
@@ -0,0 +1,98 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/point_generators_2.h>
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <array>
+#include <algorithm>
+#include <cassert>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_2 Point;
+typedef CGAL::Delaunay_triangulation_2<K> Dt;
+
+// returns the set of finite faces, described by their sorted points
+std::set<std::array<Point, 3> > faces(const Dt& dt)
+{
+  std::set<std::array<Point, 3> > res;
+  for(Dt::Face_handle f : dt.finite_face_handles())
+  {
+    std::array<Point, 3> a = { f->vertex(0)->point(), f->vertex(1)->point(), f->vertex(2)->point() };
+    std::sort(a.begin(), a.end());
+    res.insert(a);
+  }
+  return res;
+}
+
+void test(const std::vector<Point>& points, bool check_same_faces)
+{
+  Dt sequential_dt;
+  sequential_dt.insert(points.begin(), points.end());
+
+  Dt dt;
+  std::ptrdiff_t nb = dt.insert<CGAL::Parallel_if_available_tag>(points.begin(), points.end());
+  assert(dt.is_valid());
+  assert(nb == std::ptrdiff_t(dt.number_of_vertices()));
+  assert(dt.number_of_vertices() == sequential_dt.number_of_vertices());
+  assert(dt.number_of_faces() == sequential_dt.number_of_faces());
+  if(check_same_faces)
+    assert(faces(dt) == faces(sequential_dt));
+
+  // inserting again the same points does not change anything
+  nb = dt.insert<CGAL::Parallel_if_available_tag>(points.begin(), points.end());
+  assert(nb == 0);
+  assert(dt.is_valid());
+}
+
+int main()
+{
+  std::vector<Point> points;
+
+  // random points
+  CGAL::Random rnd(0);
+  CGAL::Random_points_in_square_2<Point> gen(1., rnd);
+  std::copy_n(gen, 100000, std::back_inserter(points));
+  test(points, true);
+
+  // duplicated points
+  std::vector<Point> duplicated(points.begin(), points.begin() + 20000);
+  duplicated.insert(duplicated.end(), points.begin(), points.begin() + 20000);
+  test(duplicated, true);
+
+  // points already in the triangulation, spread across all the lanes among new points
+  {
+    const std::vector<Point> half(points.begin(), points.begin() + 50000);
+    Dt sequential_dt;
+    sequential_dt.insert(half.begin(), half.end());
+    sequential_dt.insert(points.begin(), points.end());
+
+    Dt dt;
+    dt.insert<CGAL::Parallel_if_available_tag>(half.begin(), half.end());
+    std::ptrdiff_t nb = dt.insert<CGAL::Parallel_if_available_tag>(points.begin(), points.end());
+    assert(dt.is_valid());
+    assert(nb == 50000);
+    assert(faces(dt) == faces(sequential_dt));
+  }
+
+  // cocircular points on a grid, the faces depend on the insertion order
+  points.clear();
+  for(int i=0; i<200; ++i)
+    for(int j=0; j<200; ++j)
+      points.emplace_back(i, j);
+  test(points, false);
+
+  // collinear points
+  points.clear();
+  for(int i=0; i<5000; ++i)
+    points.emplace_back(i, 2*i);
+  test(points, true);
+
+  // few points
+  points.resize(3);
+  test(points, true);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}